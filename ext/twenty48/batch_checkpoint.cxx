@@ -0,0 +1,130 @@
+#include "batch_checkpoint.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace twenty48 {
+
+//
+// The checkpoint is a text file with one line per fragment, giving its size
+// in bytes and its pathname, and then an `end` line.
+//
+static const char *CHECKPOINT_END = "end";
+
+static bool file_size(const std::string &pathname, size_t &size) {
+  struct stat stat_buf;
+  if (stat(pathname.c_str(), &stat_buf) != 0) return false;
+  size = stat_buf.st_size;
+  return true;
+}
+
+static bool parse_size(const std::string &string, size_t &size) {
+  if (string.empty()) return false;
+  if (string.find_first_not_of("0123456789") != std::string::npos) return false;
+  errno = 0;
+  size = strtoull(string.c_str(), NULL, 10);
+  return errno == 0;
+}
+
+static std::string directory_pathname(const std::string &pathname) {
+  size_t slash = pathname.rfind('/');
+  if (slash == std::string::npos) return ".";
+  if (slash == 0) return "/";
+  return pathname.substr(0, slash);
+}
+
+//
+// Flush a file or directory to disk, so that it survives a crash, and return
+// its size once flushed. For a directory, this makes the entries created or
+// renamed in it durable.
+//
+static size_t sync_pathname(const std::string &pathname) {
+  int fd = open(pathname.c_str(), O_RDONLY);
+  if (fd == -1) {
+    throw std::runtime_error("write_batch_checkpoint: cannot open " +
+      pathname);
+  }
+  struct stat stat_buf;
+  int result = fsync(fd);
+  if (result == 0) result = fstat(fd, &stat_buf);
+  close(fd);
+  if (result != 0) {
+    throw std::runtime_error("write_batch_checkpoint: fsync failed for " +
+      pathname);
+  }
+  return stat_buf.st_size;
+}
+
+static std::string part_info_pathname(const std::string &fragment_pathname) {
+  size_t slash = fragment_pathname.rfind('/');
+  if (slash == std::string::npos) return "info.json";
+  return fragment_pathname.substr(0, slash + 1) + "info.json";
+}
+
+void write_batch_checkpoint(const char *pathname,
+  const std::vector<std::string> &fragment_pathnames)
+{
+  // The fragments must be on disk before the checkpoint that vouches for
+  // them, and so must their directory entries.
+  std::set<std::string> directory_pathnames;
+  std::vector<size_t> sizes(fragment_pathnames.size());
+  for (size_t i = 0; i < fragment_pathnames.size(); ++i) {
+    sizes[i] = sync_pathname(fragment_pathnames[i]);
+    directory_pathnames.insert(directory_pathname(fragment_pathnames[i]));
+  }
+  for (std::set<std::string>::const_iterator it =
+    directory_pathnames.begin(); it != directory_pathnames.end(); ++it) {
+    sync_pathname(*it);
+  }
+
+  std::string temp_pathname = std::string(pathname) + ".tmp";
+  {
+    std::ofstream os(temp_pathname.c_str());
+    for (size_t i = 0; i < fragment_pathnames.size(); ++i) {
+      os << sizes[i] << ' ' << fragment_pathnames[i] << '\n';
+    }
+    os << CHECKPOINT_END << '\n';
+    os.close();
+    if (!os) throw std::runtime_error("write_batch_checkpoint: write failed");
+  }
+  sync_pathname(temp_pathname);
+  if (std::rename(temp_pathname.c_str(), pathname) != 0) {
+    throw std::runtime_error("write_batch_checkpoint: rename failed");
+  }
+  sync_pathname(directory_pathname(pathname));
+}
+
+bool check_batch_checkpoint(const char *pathname) {
+  std::ifstream is(pathname);
+  if (!is) return false;
+
+  std::string line;
+  while (std::getline(is, line)) {
+    if (line == CHECKPOINT_END) return true;
+
+    size_t space = line.find(' ');
+    if (space == std::string::npos) return false;
+    size_t expected_size;
+    if (!parse_size(line.substr(0, space), expected_size)) return false;
+    std::string fragment_pathname = line.substr(space + 1);
+
+    size_t size;
+    if (file_size(fragment_pathname, size)) {
+      if (size != expected_size) return false;
+    } else {
+      if (!file_size(part_info_pathname(fragment_pathname), size)) {
+        return false;
+      }
+    }
+  }
+  return false;
+}
+
+}
@@ -0,0 +1,30 @@
+#ifndef TWENTY48_BATCH_CHECKPOINT_HPP
+
+#include <string>
+#include <vector>
+
+namespace twenty48 {
+
+/**
+ * Record that a batch of a layer part has been built, so a build that is
+ * restarted can skip it. The checkpoint lists the batch's output fragments
+ * and their sizes. It is written to a temporary file and then renamed, so it
+ * either exists in full or not at all. The fragments, the checkpoint and
+ * their directories are flushed to disk first, so a checkpoint that
+ * survives a crash vouches only for fragments that survived too.
+ */
+void write_batch_checkpoint(const char *pathname,
+  const std::vector<std::string> &fragment_pathnames);
+
+/**
+ * Check that a batch checkpoint exists and that its fragments are still
+ * complete: each fragment must have the recorded size, or, if it has gone,
+ * it must have been merged into its part, which has an info.json once the
+ * merge is done.
+ */
+bool check_batch_checkpoint(const char *pathname);
+
+}
+
+#define TWENTY48_BATCH_CHECKPOINT_HPP
+#endif
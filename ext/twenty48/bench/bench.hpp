@@ -0,0 +1,200 @@
+#ifndef TWENTY48_BENCH_BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../state.hpp"
+#include "../start_states.hpp"
+#include "../vbyte_reader.hpp"
+
+namespace twenty48 {
+namespace bench {
+  /**
+   * Generate a corpus of realistic states by playing random games from the
+   * start states until we have the requested number of states. The states
+   * are returned in the order visited, so neighbouring states are related,
+   * much as they are in a sorted layer file.
+   */
+  template <int size>
+  std::vector<state_t<size> > random_play_states(
+    size_t num_states, uint64_t seed = 42)
+  {
+    std::mt19937_64 rng(seed);
+    std::vector<state_t<size> > start_states = generate_start_states<size>();
+    std::vector<state_t<size> > result;
+    result.reserve(num_states);
+
+    while (result.size() < num_states) {
+      state_t<size> state = start_states[rng() % start_states.size()];
+      for (;;) {
+        result.push_back(state);
+        if (result.size() >= num_states) break;
+
+        state_t<size> moved_states[4];
+        bool moved[4];
+        if (!state.move_all(moved_states, moved)) break;
+
+        size_t direction;
+        do { direction = rng() % 4; } while (!moved[direction]);
+        state_t<size> moved_state = moved_states[direction];
+
+        uint8_t value = rng() % 10 == 0 ? 2 : 1;
+        state = moved_state.place(
+          rng() % moved_state.cells_available(), value);
+      }
+    }
+    return result;
+  }
+
+  /**
+   * Sample a corpus of states uniformly from the states in the given layer
+   * files (vbyte files of sorted states, as written by the layer builder).
+   * The sample is sorted, so it is processed in the same order as the layer.
+   */
+  template <int size>
+  std::vector<state_t<size> > layer_states(
+    const std::vector<std::string> &pathnames, size_t num_states,
+    uint64_t seed = 42)
+  {
+    std::mt19937_64 rng(seed);
+    std::vector<state_t<size> > result;
+    result.reserve(num_states);
+
+    // Reservoir sampling, so we only have to read each file once.
+    size_t states_seen = 0;
+    for (size_t i = 0; i < pathnames.size(); ++i) {
+      vbyte_reader_t vbyte_reader(pathnames[i].c_str());
+      for (;;) {
+        uint64_t nybbles = vbyte_reader.read();
+        if (nybbles == 0) break;
+        states_seen += 1;
+        if (result.size() < num_states) {
+          result.push_back(state_t<size>(nybbles));
+        } else {
+          size_t j = rng() % states_seen;
+          if (j < num_states) result[j] = state_t<size>(nybbles);
+        }
+      }
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  /**
+   * Settings for a benchmark run, and where to report the results.
+   */
+  struct context_t {
+    context_t() :
+      size(0), corpus("random_play"), num_states(0), min_seconds(0.5),
+      csv(false) { }
+
+    int size;
+    std::string corpus;
+    size_t num_states;
+    double min_seconds;
+    bool csv;
+
+    void header() const {
+      if (csv) {
+        std::cout << "benchmark,size,isa,corpus,states,ns_per_op,states_per_s"
+          << std::endl;
+      }
+    }
+
+    void section(const std::string &name) const {
+      if (csv) return;
+      std::cout << "# " << name << " " << size << "x" << size << ": "
+        << num_states << " states from " << corpus << std::endl;
+    }
+
+    void speedup(const std::string &name, double before, double after) const {
+      if (csv) return;
+      std::cout << "# " << name << " speedup: " << std::setprecision(2)
+        << before / after << "x" << std::endl;
+    }
+
+    /**
+     * Print the time per state and throughput for one benchmark. The `isa`
+     * is the instruction set that the code under test used.
+     */
+    double report(const std::string &name, const std::string &isa,
+      double elapsed, size_t ops, uint64_t sink) const
+    {
+      double ns_per_op = 1e9 * elapsed / ops;
+      double states_per_s = ops / elapsed;
+      if (csv) {
+        std::cout << name << ',' << size << ',' << isa << ',' << corpus << ','
+          << num_states << ',' << std::fixed << std::setprecision(3)
+          << ns_per_op << ',' << std::setprecision(0) << states_per_s
+          << std::endl;
+      } else {
+        std::cout << std::left << std::setw(32) << name
+          << std::setw(8) << isa << std::right
+          << std::fixed << std::setprecision(2)
+          << std::setw(10) << ns_per_op << " ns/op"
+          << std::setw(14) << std::setprecision(0) << states_per_s
+          << " states/s  (" << std::hex << (sink & 0xF) << std::dec << ")"
+          << std::endl;
+      }
+      return ns_per_op;
+    }
+  };
+
+  /**
+   * Time `op` over each state in the corpus, repeating until at least
+   * `min_seconds` have elapsed, and report ns/op and states/s. The op returns
+   * a value that we accumulate so the compiler cannot optimise it away.
+   */
+  template <typename State, typename Op>
+  double time_op(const context_t &context, const std::string &name,
+    const std::vector<State> &states, Op op, const std::string &isa = "scalar")
+  {
+    typedef std::chrono::steady_clock bench_clock_t;
+    uint64_t sink = 0;
+    size_t ops = 0;
+    bench_clock_t::time_point start = bench_clock_t::now();
+    double elapsed = 0;
+    do {
+      for (size_t i = 0; i < states.size(); ++i) sink += op(states[i]);
+      ops += states.size();
+      elapsed = std::chrono::duration<double>(
+        bench_clock_t::now() - start).count();
+    } while (elapsed < context.min_seconds);
+
+    return context.report(name, isa, elapsed, ops, sink);
+  }
+
+  /**
+   * Time `op` on the whole buffer of `n` states, repeating until at least
+   * `min_seconds` have elapsed, and report the time per state.
+   */
+  template <typename Op>
+  double time_batch(const context_t &context, const std::string &name,
+    size_t n, Op op, const std::string &isa = "scalar")
+  {
+    typedef std::chrono::steady_clock bench_clock_t;
+    uint64_t sink = 0;
+    size_t ops = 0;
+    bench_clock_t::time_point start = bench_clock_t::now();
+    double elapsed = 0;
+    do {
+      sink += op();
+      ops += n;
+      elapsed = std::chrono::duration<double>(
+        bench_clock_t::now() - start).count();
+    } while (elapsed < context.min_seconds);
+
+    return context.report(name, isa, elapsed, ops, sink);
+  }
+
+}
+}
+
+#define TWENTY48_BENCH_BENCH_HPP
+#endif
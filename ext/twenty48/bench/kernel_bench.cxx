@@ -0,0 +1,653 @@
+//
+// Microbenchmarks for the state_t and valuer_t kernels and the layer builder's
+// output sets. Build with `make` in this directory (or `rake bench` from the
+// project root); no Ruby is needed.
+//
+// Usage: kernel_bench [-c] [-k] [-n num_states] [-s size] [-t min_seconds]
+//   [-e max_exponent] [-d max_depth] [layer.vbyte ...]
+//
+// By default, each benchmark runs on states from random games on the 3x3 and
+// 4x4 boards. If layer files are given, the states are instead sampled from
+// them, and the board size must be given with -s. With -c, the results are
+// written as CSV, for comparing runs. The batch kernels are run with each
+// instruction set that the CPU supports; see cpu_features.hpp to limit them.
+// Before timing them, it checks that each gives the same results as the
+// scalar code, and exits with an error if not. With -k, it only runs these
+// checks, on the 2x2 board as well (`make check`).
+// The valuer is run at each depth up to max_depth (default 2).
+//
+#include <cstdlib>
+#include <unistd.h>
+
+#include "bench.hpp"
+#include "../layer_output.hpp"
+#include "../state_batch.hpp"
+#include "../valuer.hpp"
+
+using namespace twenty48;
+using namespace twenty48::bench;
+
+template <int size>
+void bench_moves(const context_t &context,
+  const std::vector<state_t<size> > &states)
+{
+  context.section("moves");
+
+  const char *direction_names[4] = {
+    "move left", "move right", "move up", "move down" };
+  for (size_t i = 0; i < 4; ++i) {
+    direction_t direction = (direction_t)i;
+    time_op(context, direction_names[i], states,
+      [direction](const state_t<size> &state) -> uint64_t {
+        return state.move(direction).get_nybbles();
+      });
+  }
+
+  double separate = time_op(context, "move x4", states,
+    [](const state_t<size> &state) -> uint64_t {
+      uint64_t result = 0;
+      for (size_t i = 0; i < 4; ++i) {
+        state_t<size> moved_state = state.move((direction_t)i);
+        if (moved_state == state) continue;
+        result += moved_state.get_nybbles();
+      }
+      return result;
+    });
+
+  double fused = time_op(context, "move_all", states,
+    [](const state_t<size> &state) -> uint64_t {
+      state_t<size> moved_states[4];
+      bool moved[4];
+      state.move_all(moved_states, moved);
+      uint64_t result = 0;
+      for (size_t i = 0; i < 4; ++i) {
+        if (moved[i]) result += moved_states[i].get_nybbles();
+      }
+      return result;
+    });
+
+  context.speedup("move_all", separate, fused);
+}
+
+template <int size>
+void bench_properties(const context_t &context,
+  const std::vector<state_t<size> > &states)
+{
+  context.section("properties");
+
+  time_op(context, "lose", states,
+    [](const state_t<size> &state) -> uint64_t {
+      return state.lose();
+    });
+
+  time_op(context, "legal_moves", states,
+    [](const state_t<size> &state) -> uint64_t {
+      return state.legal_moves();
+    });
+
+  time_op(context, "cells_available", states,
+    [](const state_t<size> &state) -> uint64_t {
+      return state.cells_available();
+    });
+
+  time_op(context, "sum", states,
+    [](const state_t<size> &state) -> uint64_t {
+      return state.sum();
+    });
+
+  time_op(context, "max_value", states,
+    [](const state_t<size> &state) -> uint64_t {
+      return state.max_value();
+    });
+
+  time_op(context, "has_adjacent_pair", states,
+    [](const state_t<size> &state) -> uint64_t {
+      return state.has_adjacent_pair(state.max_value());
+    });
+}
+
+template <int size>
+void bench_canonicalize(const context_t &context,
+  const std::vector<state_t<size> > &states)
+{
+  context.section("canonicalize");
+
+  // Canonicalize the successors of each state in one batch, as the builder
+  // does, and report the time per successor.
+  std::vector<uint64_t> successors;
+  for (size_t i = 0; i < states.size(); ++i) {
+    for (size_t j = 0; j < size * size; ++j) {
+      if (states[i][j] == 0) {
+        successors.push_back(states[i].new_state_with_tile(j, 1).get_nybbles());
+      }
+    }
+  }
+  if (successors.empty()) return;
+
+  std::vector<state_t<size> > successor_states(
+    successors.begin(), successors.end());
+  double single = time_op(context, "canonicalize", successor_states,
+    [](const state_t<size> &state) -> uint64_t {
+      return state.canonicalize().get_nybbles();
+    });
+  std::vector<uint64_t> output(successors.size());
+  for (int i = CPU_ISA_SCALAR; i <= cpu_isa(); ++i) {
+    cpu_isa_t isa = (cpu_isa_t)i;
+    double batch = time_batch(context, "canonicalize_batch",
+      successors.size(), [&]() -> uint64_t {
+        state_batch_t<size>::canonicalize_batch(
+          successors.data(), output.data(), successors.size(), isa);
+        return output[0];
+      }, cpu_isa_name(isa));
+    context.speedup(std::string("canonicalize_batch ") + cpu_isa_name(isa),
+      single, batch);
+  }
+}
+
+static void check_failed(const std::string &name, cpu_isa_t isa, size_t n,
+  size_t i, uint64_t nybbles, int64_t expected, int64_t actual)
+{
+  std::cerr << "kernel_bench: " << name << " (" << cpu_isa_name(isa) <<
+    ") does not match scalar at state " << i << " of " << n << " (0x" <<
+    std::hex << nybbles << "): expected 0x" << expected << ", got 0x" <<
+    actual << std::dec << std::endl;
+  exit(1);
+}
+
+/**
+ * Run a batch kernel with the given ISA and compare its output with the
+ * scalar kernel's, on short batches, which are mostly tail handling, and on
+ * the whole input. Also check that it writes nothing past the end of the
+ * batch.
+ */
+template <typename Output, typename Kernel>
+void check_kernel(const std::string &name, cpu_isa_t isa,
+  const std::vector<uint64_t> &input, Kernel kernel)
+{
+  const Output GUARD = (Output)0x5A5A5A5A5A5A5A5AULL;
+  std::vector<Output> expected(input.size());
+  kernel(input.data(), expected.data(), input.size(), CPU_ISA_SCALAR);
+
+  std::vector<size_t> lengths;
+  for (size_t n = 0; n < 40 && n < input.size(); ++n) lengths.push_back(n);
+  lengths.push_back(input.size());
+
+  std::vector<Output> output(input.size() + 1);
+  for (size_t k = 0; k < lengths.size(); ++k) {
+    size_t n = lengths[k];
+    std::fill(output.begin(), output.end(), GUARD);
+    kernel(input.data(), output.data(), n, isa);
+    for (size_t i = 0; i < n; ++i) {
+      if (output[i] == expected[i]) continue;
+      check_failed(name, isa, n, i, input[i], expected[i], output[i]);
+    }
+    if (output[n] != GUARD) {
+      check_failed(name + " past end", isa, n, n, 0, GUARD, output[n]);
+    }
+  }
+}
+
+/**
+ * As check_kernel, but for kernels that output states, which may run in
+ * place, so check that too.
+ */
+template <typename Kernel>
+void check_states_kernel(const std::string &name, cpu_isa_t isa,
+  const std::vector<uint64_t> &input, Kernel kernel)
+{
+  check_kernel<uint64_t>(name, isa, input, kernel);
+
+  std::vector<uint64_t> expected(input.size());
+  kernel(input.data(), expected.data(), input.size(), CPU_ISA_SCALAR);
+  std::vector<uint64_t> output(input);
+  kernel(output.data(), output.data(), output.size(), isa);
+  for (size_t i = 0; i < output.size(); ++i) {
+    if (output[i] == expected[i]) continue;
+    check_failed(name + " in place", isa, output.size(), i, input[i],
+      expected[i], output[i]);
+  }
+}
+
+/**
+ * Check each batch kernel that the CPU supports against the scalar one, and
+ * exit if any differs; there is no point in timing a wrong kernel. Random
+ * games rarely have big tiles, so also check boards with random tiles.
+ */
+template <int size>
+void check_batch(const context_t &context,
+  const std::vector<state_t<size> > &states)
+{
+  std::vector<uint64_t> input;
+  for (size_t i = 0; i < states.size(); ++i) {
+    input.push_back(states[i].get_nybbles());
+  }
+  std::mt19937_64 rng(42);
+  std::vector<uint8_t> cells(size * size);
+  for (size_t i = 0; i < states.size(); ++i) {
+    for (size_t j = 0; j < cells.size(); ++j) cells[j] = rng() % 16;
+    input.push_back(state_t<size>(cells).get_nybbles());
+  }
+
+  const char *direction_names[4] = {
+    "move_batch left", "move_batch right", "move_batch up", "move_batch down"
+  };
+  for (int i = CPU_ISA_SCALAR + 1; i <= cpu_isa(); ++i) {
+    cpu_isa_t isa = (cpu_isa_t)i;
+    for (size_t j = 0; j < 4; ++j) {
+      direction_t direction = (direction_t)j;
+      check_states_kernel(direction_names[j], isa, input,
+        [direction](const uint64_t *in, uint64_t *out, size_t n,
+          cpu_isa_t kernel_isa) {
+          state_batch_t<size>::move_batch(in, out, n, direction, kernel_isa);
+        });
+    }
+    check_states_kernel("canonicalize_batch", isa, input,
+      state_batch_t<size>::canonicalize_batch);
+    check_kernel<uint8_t>("lose_batch", isa, input,
+      state_batch_t<size>::lose_batch);
+    check_kernel<int>("sum_batch", isa, input,
+      state_batch_t<size>::sum_batch);
+    check_kernel<uint8_t>("max_value_batch", isa, input,
+      state_batch_t<size>::max_value_batch);
+  }
+
+  if (!context.csv) {
+    std::cout << "# " << size << "x" << size << " batch kernels match " <<
+      "scalar on " << input.size() << " states, up to " <<
+      cpu_isa_name(cpu_isa()) << std::endl;
+  }
+}
+
+template <int size>
+void bench_batch(const context_t &context,
+  const std::vector<state_t<size> > &states)
+{
+  context.section("batch kernels");
+
+  std::vector<uint64_t> input;
+  for (size_t i = 0; i < states.size(); ++i) {
+    input.push_back(states[i].get_nybbles());
+  }
+  size_t n = input.size();
+  std::vector<uint64_t> output(n);
+  std::vector<uint8_t> output_8(n);
+  std::vector<int> output_int(n);
+
+  const char *direction_names[4] = {
+    "move_batch left", "move_batch right", "move_batch up", "move_batch down"
+  };
+  for (int i = CPU_ISA_SCALAR; i <= cpu_isa(); ++i) {
+    cpu_isa_t isa = (cpu_isa_t)i;
+    for (size_t j = 0; j < 4; ++j) {
+      direction_t direction = (direction_t)j;
+      time_batch(context, direction_names[j], n, [&]() -> uint64_t {
+        state_batch_t<size>::move_batch(
+          input.data(), output.data(), n, direction, isa);
+        return output[0];
+      }, cpu_isa_name(isa));
+    }
+
+    time_batch(context, "lose_batch", n, [&]() -> uint64_t {
+      state_batch_t<size>::lose_batch(input.data(), output_8.data(), n, isa);
+      return output_8[0];
+    }, cpu_isa_name(isa));
+
+    time_batch(context, "sum_batch", n, [&]() -> uint64_t {
+      state_batch_t<size>::sum_batch(input.data(), output_int.data(), n, isa);
+      return output_int[0];
+    }, cpu_isa_name(isa));
+
+    time_batch(context, "max_value_batch", n, [&]() -> uint64_t {
+      state_batch_t<size>::max_value_batch(
+        input.data(), output_8.data(), n, isa);
+      return output_8[0];
+    }, cpu_isa_name(isa));
+  }
+}
+
+template <int size>
+void bench_random_transitions(const context_t &context,
+  const std::vector<state_t<size> > &states)
+{
+  typedef typename state_t<size>::transitions_t transitions_t;
+  typedef typename state_t<size>::transition_array_t transition_array_t;
+
+  context.section("random_transitions");
+
+  double map = time_op(context, "random_transitions (map)", states,
+    [](const state_t<size> &state) -> uint64_t {
+      transitions_t transitions = state.random_transitions();
+      return transitions.size();
+    });
+
+  double array = time_op(context, "random_transitions (array)", states,
+    [](const state_t<size> &state) -> uint64_t {
+      transition_array_t transitions;
+      state.random_transitions(transitions);
+      return transitions.size();
+    });
+
+  context.speedup("random_transitions array", map, array);
+}
+
+template <int size>
+void bench_successors(const context_t &context,
+  const std::vector<state_t<size> > &states)
+{
+  typedef typename state_t<size>::nybbles_t nybbles_t;
+
+  context.section("successors");
+
+  double scratch = time_op(context, "successors (canonicalize each)", states,
+    [](const state_t<size> &state) -> uint64_t {
+      uint64_t result = 0;
+      for (size_t i = 0; i < size * size; ++i) {
+        if (state[i] != 0) continue;
+        result += state.new_state_with_tile(i, 1).canonicalize().get_nybbles();
+        result += state.new_state_with_tile(i, 2).canonicalize().get_nybbles();
+      }
+      return result;
+    });
+
+  double incremental = time_op(context, "successors (incremental)", states,
+    [](const state_t<size> &state) -> uint64_t {
+      nybbles_t successors_1[size * size];
+      nybbles_t successors_2[size * size];
+      uint8_t weights[size * size];
+      size_t n = state.successors(successors_1, successors_2, weights);
+      uint64_t result = 0;
+      for (size_t i = 0; i < n; ++i) {
+        result += successors_1[i] + successors_2[i];
+      }
+      return result;
+    });
+
+  context.speedup("incremental successors", scratch, incremental);
+}
+
+template <int size>
+void bench_valuer(const context_t &context,
+  const std::vector<state_t<size> > &states, int max_exponent,
+  int max_depth)
+{
+  typedef typename state_t<size>::transition_array_t transition_array_t;
+
+  context.section("valuer");
+
+  // The builder values every successor of every state, and any that are
+  // resolved are left out of the next layer, so report how many successors
+  // each depth resolves, and what it costs. The same successor comes up many
+  // times, so also compare with and without the cache. Keep to about as many
+  // successors as there are states.
+  std::vector<state_t<size> > successors;
+  for (size_t i = 0; i < states.size() && successors.size() < states.size();
+    ++i) {
+    state_t<size> moved_states[4];
+    bool moved[4];
+    states[i].move_all(moved_states, moved);
+    for (size_t j = 0; j < 4; ++j) {
+      if (!moved[j]) continue;
+      transition_array_t transitions;
+      moved_states[j].random_transitions(transitions);
+      for (typename transition_array_t::const_iterator it =
+        transitions.begin(); it != transitions.end(); ++it) {
+        successors.push_back(it->first);
+      }
+    }
+  }
+
+  for (int depth = 0; depth <= max_depth; ++depth) {
+    std::string suffix = " (depth " + std::to_string(depth);
+    valuer_t<size> valuer(max_exponent, depth, 0.95);
+    time_op(context, "valuer value" + suffix + ")", states,
+      [&valuer](const state_t<size> &state) -> uint64_t {
+        double value = valuer.value(state);
+        return std::isnan(value) ? 0 : uint64_t(1e6 * value);
+      });
+    if (successors.empty()) continue;
+
+    double single = time_op(context, "successors" + suffix + ")", successors,
+      [&valuer](const state_t<size> &state) -> uint64_t {
+        double value = valuer.value(state);
+        return std::isnan(value) ? 0 : uint64_t(1e6 * value);
+      });
+
+    // At depth zero, the valuer does not use the cache.
+    valuer_t<size> cached(max_exponent, depth, 0.95, 1 << 20);
+    if (depth > 0) {
+      double memoized = time_op(context, "successors" + suffix + ", cached)",
+        successors, [&cached](const state_t<size> &state) -> uint64_t {
+          double value = cached.value(state);
+          return std::isnan(value) ? 0 : uint64_t(1e6 * value);
+        });
+      context.speedup("valuer cache", single, memoized);
+    }
+    if (context.csv) continue;
+
+    // The timing loop makes several passes, so count on one.
+    cached.clear_cache();
+    size_t wins = 0, losses = 0;
+    for (size_t i = 0; i < successors.size(); ++i) {
+      double value = cached.value(successors[i]);
+      if (value == 0) {
+        ++losses;
+      } else if (!std::isnan(value)) {
+        ++wins;
+      }
+    }
+    size_t lookups = cached.get_cache_hits() + cached.get_cache_misses();
+    std::cout << std::setprecision(2) << "# depth " << depth << " resolves " <<
+      100.0 * (wins + losses) / successors.size() << "% of " <<
+      successors.size() << " successors (" <<
+      100.0 * wins / successors.size() << "% wins, " <<
+      100.0 * losses / successors.size() << "% losses)";
+    if (lookups > 0) {
+      std::cout << "; cache hit rate " <<
+        100.0 * cached.get_cache_hits() / lookups << "%";
+    }
+    std::cout << std::endl;
+  }
+}
+
+template <int size>
+void bench_outputs(const context_t &context,
+  const std::vector<state_t<size> > &states)
+{
+  typedef typename state_t<size>::nybbles_t nybbles_t;
+
+  context.section("layer outputs");
+
+  // Collect the successors of each state, as the layer builder does, and
+  // write them out sorted and without duplicates.
+  std::vector<nybbles_t> successors;
+  for (size_t i = 0; i < states.size(); ++i) {
+    state_t<size> moved_states[4];
+    bool moved[4];
+    states[i].move_all(moved_states, moved);
+    for (size_t j = 0; j < 4; ++j) {
+      if (!moved[j]) continue;
+      nybbles_t successors_1[size * size];
+      nybbles_t successors_2[size * size];
+      uint8_t weights[size * size];
+      size_t n = moved_states[j].successors(
+        successors_1, successors_2, weights);
+      successors.insert(successors.end(), successors_1, successors_1 + n);
+      successors.insert(successors.end(), successors_2, successors_2 + n);
+    }
+  }
+  if (successors.empty()) return;
+
+  // Sort on one thread, then on more, up to one per core.
+  std::vector<size_t> thread_counts(1, 0);
+  for (size_t threads = 1; threads < default_num_threads(); threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(default_num_threads());
+
+  std::vector<size_t> bytes_used;
+  std::vector<double> times;
+  for (size_t i = 0; i < thread_counts.size(); ++i) {
+    size_t threads = thread_counts[i];
+    bool sorted = threads > 0;
+    std::string name = sorted ?
+      "sorted output (" + std::to_string(threads) + " threads)" :
+      "btree output";
+    size_t bytes = 0;
+    times.push_back(time_batch(context, name, successors.size(),
+      [&]() -> uint64_t {
+        layer_output_t<size> output(sorted, threads);
+        for (size_t j = 0; j < successors.size(); ++j) {
+          output.insert(state_t<size>(successors[j]));
+        }
+        bytes = output.bytes_used();
+        output.write("/dev/null");
+        return bytes;
+      }));
+    bytes_used.push_back(bytes);
+  }
+  context.speedup("sorted output", times[0], times[1]);
+  if (!context.csv) {
+    std::cout << std::setprecision(2) <<
+      "# output bytes per successor: btree " <<
+      double(bytes_used[0]) / successors.size() << ", sorted " <<
+      double(bytes_used[1]) / successors.size() << std::endl;
+  }
+
+  // Put the filter of recent successors in front of the btree, as the layer
+  // builder does, with a range of sizes, to see how often it hits.
+  std::vector<double> hit_rates;
+  std::vector<double> filter_times;
+  const size_t filter_sets[] = { 0, 1 << 6, 1 << 8, 1 << 10, 1 << 12, 1 << 14 };
+  for (size_t i = 0; i < sizeof(filter_sets) / sizeof(filter_sets[0]); ++i) {
+    std::string name = "btree + filter " + std::to_string(2 * filter_sets[i]);
+    double hit_rate = 0;
+    filter_times.push_back(time_batch(context, name, successors.size(),
+      [&]() -> uint64_t {
+        layer_output_t<size> output(false, 1, filter_sets[i]);
+        for (size_t j = 0; j < successors.size(); ++j) {
+          state_t<size> successor(successors[j]);
+          if (output.inserted_recently(successor)) continue;
+          output.insert(successor);
+        }
+        hit_rate = double(output.get_filter().get_num_hits()) /
+          successors.size();
+        size_t num_states = output.num_states();
+        output.clear();
+        return num_states;
+      }));
+    hit_rates.push_back(hit_rate);
+  }
+  context.speedup("filtered output", filter_times[0], filter_times[3]);
+  if (context.csv) return;
+  std::cout << "# filter hit rate by ways:";
+  for (size_t i = 1; i < hit_rates.size(); ++i) {
+    std::cout << " " << 2 * filter_sets[i] << ": " <<
+      std::setprecision(3) << hit_rates[i];
+  }
+  std::cout << std::endl;
+}
+
+template <int size>
+void run(context_t context, const std::vector<std::string> &layer_pathnames,
+  size_t num_states, int max_exponent, int max_depth, bool check_only)
+{
+  std::vector<state_t<size> > states;
+  if (layer_pathnames.empty()) {
+    states = random_play_states<size>(num_states);
+  } else {
+    states = layer_states<size>(layer_pathnames, num_states);
+    std::string pathname = layer_pathnames[0];
+    context.corpus = pathname.substr(pathname.find_last_of('/') + 1);
+    if (layer_pathnames.size() > 1) {
+      context.corpus += "+" + std::to_string(layer_pathnames.size() - 1);
+    }
+  }
+  if (states.empty()) {
+    std::cerr << "no states for " << size << "x" << size << std::endl;
+    return;
+  }
+
+  context.size = size;
+  context.num_states = states.size();
+  if (max_exponent == 0) max_exponent = size == 4 ? 11 : size == 3 ? 10 : 5;
+
+  check_batch<size>(context, states);
+  if (check_only) return;
+
+  bench_moves<size>(context, states);
+  bench_properties<size>(context, states);
+  bench_canonicalize<size>(context, states);
+  bench_batch<size>(context, states);
+  bench_random_transitions<size>(context, states);
+  bench_successors<size>(context, states);
+  bench_valuer<size>(context, states, max_exponent, max_depth);
+  bench_outputs<size>(context, states);
+}
+
+static void usage() {
+  std::cerr << "usage: kernel_bench [-c] [-k] [-n num_states] [-s size] "
+    "[-t min_seconds] [-e max_exponent] [-d max_depth] [layer.vbyte ...]"
+    << std::endl;
+  exit(1);
+}
+
+int main(int argc, char **argv) {
+  context_t context;
+  size_t num_states = 1000000;
+  int board_size = 0;
+  int max_exponent = 0;
+  int max_depth = 2;
+  bool check_only = false;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "ckn:s:t:e:d:")) != -1) {
+    switch (opt) {
+      case 'c': context.csv = true; break;
+      case 'k': check_only = true; break;
+      case 'n': num_states = strtoul(optarg, NULL, 10); break;
+      case 's': board_size = atoi(optarg); break;
+      case 't': context.min_seconds = atof(optarg); break;
+      case 'e': max_exponent = atoi(optarg); break;
+      case 'd': max_depth = atoi(optarg); break;
+      default: usage();
+    }
+  }
+
+  std::vector<std::string> layer_pathnames(argv + optind, argv + argc);
+  if (!layer_pathnames.empty() && board_size == 0) {
+    std::cerr << "board size (-s) is required with layer files" << std::endl;
+    usage();
+  }
+
+  if (!check_only) context.header();
+  if (!context.csv) {
+    std::cout << "# isa: " << cpu_isa_name(cpu_isa()) << std::endl;
+  }
+
+  switch (board_size) {
+    case 0:
+      if (check_only) {
+        run<2>(context, layer_pathnames, num_states, max_exponent, max_depth,
+          check_only);
+      }
+      run<3>(context, layer_pathnames, num_states, max_exponent, max_depth,
+        check_only);
+      run<4>(context, layer_pathnames, num_states, max_exponent, max_depth,
+        check_only);
+      break;
+    case 2:
+      run<2>(context, layer_pathnames, num_states, max_exponent, max_depth,
+        check_only);
+      break;
+    case 3:
+      run<3>(context, layer_pathnames, num_states, max_exponent, max_depth,
+        check_only);
+      break;
+    case 4:
+      run<4>(context, layer_pathnames, num_states, max_exponent, max_depth,
+        check_only);
+      break;
+    default: usage();
+  }
+  return 0;
+}
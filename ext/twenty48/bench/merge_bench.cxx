@@ -0,0 +1,453 @@
+//
+// Benchmark for merge_states, which reduces the fragments that the layer
+// builder writes for each output part. Build with `make` in this directory;
+// no Ruby is needed.
+//
+// Usage: merge_bench [-c] [-f num_fragments] [-j num_threads]
+//   [-n states_per_fragment] [-s size] [-t min_seconds]
+//
+// The fragments are written to a temporary folder. Each one holds the sorted
+// successors of a run of states from random games, as a batch of the layer
+// builder would, so the fragments overlap much as real ones do. The merge is
+// compared with a priority queue of single-value vbyte readers, which is how
+// merge_states used to work, and then with a parallel merge on `-j` threads
+// (default one per core).
+//
+// The same fragments, with a probability for each state, are then merged
+// with merge_state_probabilities, as the tranche builder does, and compared
+// with a priority queue of binary readers.
+//
+// Finally, the merged states are read back with vbyte_reader_t, one at a time
+// and in batches, and compared with a reader that decodes from a 16-byte
+// buffer, which is how vbyte_reader_t used to work.
+//
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "bench.hpp"
+#include "../binary_reader.hpp"
+#include "../binary_writer.hpp"
+#include "../merge_state_probabilities.hpp"
+#include "../merge_states.hpp"
+#include "../state_value.hpp"
+#include "../threads.hpp"
+#include "../vbyte.h"
+#include "../vbyte_reader.hpp"
+#include "../vbyte_writer.hpp"
+
+using namespace twenty48;
+using namespace twenty48::bench;
+
+/**
+ * The old merge, for comparison: a heap of readers that decode one value at
+ * a time.
+ */
+size_t priority_queue_merge(const std::vector<std::string> &input_pathnames,
+  const char *output_pathname, size_t index_stride, vbyte_index_t &index)
+{
+  typedef std::pair<uint64_t, size_t> head_t;
+  typedef std::priority_queue<head_t, std::vector<head_t>,
+    std::greater<head_t> > head_queue_t;
+
+  std::vector<std::unique_ptr<vbyte_reader_t> > readers;
+  head_queue_t heads;
+  for (size_t i = 0; i < input_pathnames.size(); ++i) {
+    readers.emplace_back(new vbyte_reader_t(input_pathnames[i].c_str()));
+    uint64_t value = readers[i]->read();
+    if (value != 0) heads.push(head_t(value, i));
+  }
+
+  vbyte_writer_t vbyte_writer(output_pathname);
+  size_t num_states = 0;
+  uint64_t previous = 0;
+  while (!heads.empty()) {
+    head_t head = heads.top();
+    heads.pop();
+    if (head.first != previous) {
+      vbyte_writer.write(head.first);
+      previous = head.first;
+      num_states += 1;
+      if (num_states % index_stride == 0) {
+        index.push_back(vbyte_index_entry_t(
+          vbyte_writer.get_bytes_written(), vbyte_writer.get_previous()));
+      }
+    }
+    uint64_t value = readers[head.second]->read();
+    if (value != 0) heads.push(head_t(value, head.second));
+  }
+  return num_states;
+}
+
+/**
+ * The old merge_state_probabilities, for comparison: a heap of readers that
+ * read one record at a time.
+ */
+size_t priority_queue_probability_merge(
+  const std::vector<std::string> &input_pathnames,
+  const char *output_pathname)
+{
+  typedef binary_reader_t<state_value_t> reader_t;
+  typedef std::pair<uint64_t, size_t> head_t;
+  typedef std::priority_queue<head_t, std::vector<head_t>,
+    std::greater<head_t> > head_queue_t;
+
+  std::vector<std::unique_ptr<reader_t> > readers;
+  std::vector<double> values(input_pathnames.size());
+  head_queue_t heads;
+  for (size_t i = 0; i < input_pathnames.size(); ++i) {
+    readers.emplace_back(new reader_t(input_pathnames[i].c_str()));
+    if (readers[i]->done()) continue;
+    state_value_t state_value = readers[i]->read();
+    values[i] = state_value.value;
+    heads.push(head_t(state_value.state, i));
+  }
+
+  binary_writer_t<state_value_t> writer(output_pathname);
+  size_t num_states = 0;
+  state_value_t state_value;
+  state_value.state = 0;
+  state_value.value = 0;
+  while (!heads.empty()) {
+    head_t head = heads.top();
+    heads.pop();
+    if (head.first == state_value.state) {
+      state_value.value += values[head.second];
+    } else {
+      if (state_value.state != 0) writer.write(state_value);
+      state_value.state = head.first;
+      state_value.value = values[head.second];
+      num_states += 1;
+    }
+    reader_t &reader = *readers[head.second];
+    if (reader.done()) continue;
+    state_value_t next = reader.read();
+    values[head.second] = next.value;
+    heads.push(head_t(next.state, head.second));
+  }
+  if (state_value.state != 0) writer.write(state_value);
+  return num_states;
+}
+
+/**
+ * The old vbyte_reader_t, for comparison: it reads the file through a 16-byte
+ * buffer and shifts the buffer after decoding each value.
+ */
+struct byte_buffer_vbyte_reader_t {
+  explicit byte_buffer_vbyte_reader_t(const char *pathname) :
+    is(pathname, std::ios::in | std::ios::binary), previous(0),
+    buffer_length(0), eof(false) { }
+
+  uint64_t read() {
+    if (!eof) {
+      is.read(reinterpret_cast<char *>(buffer + buffer_length),
+        BUFFER_SIZE - buffer_length);
+      buffer_length += is.gcount();
+      if (!is) eof = true;
+    }
+    if (buffer_length == 0) return 0;
+
+    uint64_t value;
+    size_t bytes_in = vbyte_uncompress_sorted64(buffer, &value, previous, 1);
+    for (size_t i = 0; i + bytes_in < BUFFER_SIZE; ++i) {
+      buffer[i] = buffer[i + bytes_in];
+    }
+    buffer_length -= bytes_in;
+    previous = value;
+    return value;
+  }
+
+private:
+  static const int BUFFER_SIZE = 2 * sizeof(uint64_t);
+  std::ifstream is;
+  uint64_t previous;
+  uint8_t buffer[BUFFER_SIZE];
+  size_t buffer_length;
+  bool eof;
+};
+
+/**
+ * Write each vbyte fragment out again as (state, probability) records.
+ */
+std::vector<std::string> write_probability_fragments(
+  const std::vector<std::string> &pathnames)
+{
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<double> probability(0, 1e-6);
+  std::vector<std::string> probability_pathnames;
+  for (size_t i = 0; i < pathnames.size(); ++i) {
+    probability_pathnames.push_back(pathnames[i] + ".pr");
+    vbyte_reader_t vbyte_reader(pathnames[i].c_str());
+    binary_writer_t<state_value_t> writer(probability_pathnames[i].c_str());
+    for (;;) {
+      state_value_t state_value;
+      state_value.state = vbyte_reader.read();
+      if (state_value.state == 0) break;
+      state_value.value = probability(random);
+      writer.write(state_value);
+    }
+  }
+  return probability_pathnames;
+}
+
+/**
+ * The probabilities may be added up in a different order, so they need only
+ * be close.
+ */
+bool same_probabilities(const std::string &pathname,
+  const std::string &check_pathname)
+{
+  binary_reader_t<state_value_t> reader(pathname.c_str());
+  binary_reader_t<state_value_t> check_reader(check_pathname.c_str());
+  while (!reader.done() && !check_reader.done()) {
+    state_value_t state_value = reader.read();
+    state_value_t check_state_value = check_reader.read();
+    if (state_value.state != check_state_value.state) return false;
+    if (std::fabs(state_value.value - check_state_value.value) >
+      1e-12 * check_state_value.value) return false;
+  }
+  return reader.done() && check_reader.done();
+}
+
+bool same_index(const vbyte_index_t &a, const vbyte_index_t &b) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].byte_offset != b[i].byte_offset) return false;
+    if (a[i].previous != b[i].previous) return false;
+  }
+  return true;
+}
+
+bool same_merge(const std::string &pathname, const vbyte_index_t &index,
+  const std::string &check_pathname, const vbyte_index_t &check_index)
+{
+  std::string cmp = "cmp -s " + pathname + " " + check_pathname;
+  return system(cmp.c_str()) == 0 && same_index(index, check_index);
+}
+
+template <int size>
+std::vector<std::string> write_fragments(const std::string &folder,
+  size_t num_fragments, size_t states_per_fragment, size_t &num_states)
+{
+  // Each fragment comes from a run of states that is about a tenth of its
+  // size, since each state has many successors.
+  size_t run_length = std::max(states_per_fragment / 10, (size_t)1);
+  std::vector<state_t<size> > states =
+    random_play_states<size>(num_fragments * run_length);
+
+  std::vector<std::string> pathnames;
+  num_states = 0;
+  for (size_t i = 0; i < num_fragments; ++i) {
+    std::vector<uint64_t> successors;
+    for (size_t j = i * run_length; j < (i + 1) * run_length; ++j) {
+      state_t<size> moved_states[4];
+      bool moved[4];
+      states[j].move_all(moved_states, moved);
+      for (size_t k = 0; k < 4; ++k) {
+        if (!moved[k]) continue;
+        uint64_t successors_1[size * size];
+        uint64_t successors_2[size * size];
+        uint8_t weights[size * size];
+        size_t n = moved_states[k].successors(
+          successors_1, successors_2, weights);
+        successors.insert(successors.end(), successors_1, successors_1 + n);
+      }
+    }
+    std::sort(successors.begin(), successors.end());
+    successors.erase(std::unique(successors.begin(), successors.end()),
+      successors.end());
+
+    pathnames.push_back(folder + "/fragment-" + std::to_string(i) + ".vbyte");
+    vbyte_writer_t vbyte_writer(pathnames.back().c_str());
+    for (size_t j = 0; j < successors.size(); ++j) {
+      vbyte_writer.write(successors[j]);
+    }
+    num_states += successors.size();
+  }
+  return pathnames;
+}
+
+template <int size>
+void run(context_t context, size_t num_fragments, size_t states_per_fragment,
+  size_t num_threads)
+{
+  char folder[] = "/tmp/merge_bench.XXXXXX";
+  if (!mkdtemp(folder)) {
+    std::cerr << "merge_bench: failed to make temporary folder" << std::endl;
+    exit(1);
+  }
+
+  size_t num_states;
+  std::vector<std::string> pathnames = write_fragments<size>(folder,
+    num_fragments, states_per_fragment, num_states);
+  context.size = size;
+  context.corpus = std::to_string(num_fragments) + "_fragments";
+  context.num_states = num_states;
+  context.section("merge");
+
+  std::string output_pathname = std::string(folder) + "/merged.vbyte";
+  std::string check_pathname = std::string(folder) + "/check.vbyte";
+  std::string parallel_pathname = std::string(folder) + "/parallel.vbyte";
+  size_t index_stride = 1 << 16;
+  vbyte_index_t index;
+  vbyte_index_t check_index;
+  vbyte_index_t parallel_index;
+
+  double before = time_batch(context, "priority queue merge", num_states,
+    [&]() -> uint64_t {
+      check_index.clear();
+      return priority_queue_merge(pathnames, check_pathname.c_str(),
+        index_stride, check_index);
+    });
+  size_t num_merged_states = 0;
+  double after = time_batch(context, "merge_states", num_states,
+    [&]() -> uint64_t {
+      index.clear();
+      num_merged_states = merge_states(pathnames, output_pathname.c_str(),
+        index_stride, index);
+      return num_merged_states;
+    });
+  context.speedup("merge_states", before, after);
+
+  double parallel = time_batch(context, "parallel merge_states", num_states,
+    [&]() -> uint64_t {
+      parallel_index.clear();
+      return merge_states(pathnames, parallel_pathname.c_str(),
+        index_stride, parallel_index, num_threads);
+    });
+  context.speedup("parallel merge_states", after, parallel);
+
+  if (!same_merge(output_pathname, index, check_pathname, check_index) ||
+    !same_merge(parallel_pathname, parallel_index, check_pathname,
+      check_index)) {
+    std::cerr << "merge_bench: merges differ" << std::endl;
+    exit(1);
+  }
+
+  context.section("merge probabilities");
+  std::vector<std::string> probability_pathnames =
+    write_probability_fragments(pathnames);
+  std::string probability_pathname = std::string(folder) + "/merged.pr";
+  std::string probability_check_pathname = std::string(folder) + "/check.pr";
+
+  before = time_batch(context, "priority queue merge", num_states,
+    [&]() -> uint64_t {
+      return priority_queue_probability_merge(probability_pathnames,
+        probability_check_pathname.c_str());
+    });
+  after = time_batch(context, "merge_state_probabilities", num_states,
+    [&]() -> uint64_t {
+      return merge_state_probabilities(probability_pathnames,
+        probability_pathname.c_str());
+    });
+  context.speedup("merge_state_probabilities", before, after);
+
+  if (!same_probabilities(probability_pathname, probability_check_pathname)) {
+    std::cerr << "merge_bench: probability merges differ" << std::endl;
+    exit(1);
+  }
+
+  context.section("read");
+  uint64_t check_sum = 0;
+  before = time_batch(context, "16-byte buffer read", num_merged_states,
+    [&]() -> uint64_t {
+      byte_buffer_vbyte_reader_t reader(output_pathname.c_str());
+      uint64_t sum = 0;
+      for (uint64_t value = reader.read(); value; value = reader.read()) {
+        sum += value;
+      }
+      check_sum = sum;
+      return sum;
+    });
+  bool same_sums = true;
+  after = time_batch(context, "vbyte_reader_t read", num_merged_states,
+    [&]() -> uint64_t {
+      vbyte_reader_t reader(output_pathname.c_str());
+      uint64_t sum = 0;
+      for (uint64_t value = reader.read(); value; value = reader.read()) {
+        sum += value;
+      }
+      same_sums = same_sums && sum == check_sum;
+      return sum;
+    });
+  context.speedup("vbyte_reader_t read", before, after);
+  after = time_batch(context, "vbyte_reader_t read_batch", num_merged_states,
+    [&]() -> uint64_t {
+      vbyte_reader_t reader(output_pathname.c_str());
+      std::vector<uint64_t> values(4096);
+      uint64_t sum = 0;
+      for (;;) {
+        size_t n = reader.read_batch(values.data(), values.size());
+        if (n == 0) break;
+        for (size_t i = 0; i < n; ++i) sum += values[i];
+      }
+      same_sums = same_sums && sum == check_sum;
+      return sum;
+    });
+  context.speedup("vbyte_reader_t read_batch", before, after);
+  if (!same_sums) {
+    std::cerr << "merge_bench: reads differ" << std::endl;
+    exit(1);
+  }
+
+  pathnames.insert(pathnames.end(), probability_pathnames.begin(),
+    probability_pathnames.end());
+  pathnames.push_back(output_pathname);
+  pathnames.push_back(check_pathname);
+  pathnames.push_back(parallel_pathname);
+  pathnames.push_back(probability_pathname);
+  pathnames.push_back(probability_check_pathname);
+  for (size_t i = 0; i < pathnames.size(); ++i) unlink(pathnames[i].c_str());
+  rmdir(folder);
+}
+
+static void usage() {
+  std::cerr << "usage: merge_bench [-c] [-f num_fragments] [-j num_threads] "
+    "[-n states_per_fragment] [-s size] [-t min_seconds]" << std::endl;
+  exit(1);
+}
+
+int main(int argc, char **argv) {
+  context_t context;
+  size_t num_fragments = 2000;
+  size_t states_per_fragment = 2000;
+  size_t num_threads = default_num_threads();
+  int board_size = 4;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "cf:j:n:s:t:")) != -1) {
+    switch (opt) {
+      case 'c': context.csv = true; break;
+      case 'f': num_fragments = strtoul(optarg, NULL, 10); break;
+      case 'j': num_threads = strtoul(optarg, NULL, 10); break;
+      case 'n': states_per_fragment = strtoul(optarg, NULL, 10); break;
+      case 's': board_size = atoi(optarg); break;
+      case 't': context.min_seconds = atof(optarg); break;
+      default: usage();
+    }
+  }
+
+  // We need a file descriptor for each fragment.
+  struct rlimit limit;
+  if (getrlimit(RLIMIT_NOFILE, &limit) == 0 &&
+    limit.rlim_cur < limit.rlim_max) {
+    limit.rlim_cur = limit.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &limit);
+  }
+
+  context.header();
+  switch (board_size) {
+    case 3:
+      run<3>(context, num_fragments, states_per_fragment, num_threads);
+      break;
+    case 4:
+      run<4>(context, num_fragments, states_per_fragment, num_threads);
+      break;
+    default: usage();
+  }
+  return 0;
+}
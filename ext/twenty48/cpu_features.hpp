@@ -0,0 +1,93 @@
+#ifndef TWENTY48_CPU_FEATURES_HPP
+
+#include <cstdlib>
+#include <cstring>
+
+#include "twenty48.hpp"
+
+//
+// Instruction set extensions that we can select at runtime. Kernels that use
+// them are compiled with a target attribute, rather than by passing -mavx2 for
+// the whole extension, so the extension still runs on CPUs without them.
+//
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TWENTY48_HAVE_AVX2_TARGET 1
+#define TWENTY48_TARGET_AVX2 __attribute__((target("avx2")))
+#define TWENTY48_HAVE_AVX512_TARGET 1
+#define TWENTY48_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#else
+#define TWENTY48_HAVE_AVX2_TARGET 0
+#define TWENTY48_TARGET_AVX2
+#define TWENTY48_HAVE_AVX512_TARGET 0
+#define TWENTY48_TARGET_AVX512
+#endif
+
+namespace twenty48 {
+  /**
+   * The instruction sets for which we have kernels, from worst to best.
+   */
+  enum cpu_isa_t {
+    CPU_ISA_SCALAR,
+    CPU_ISA_AVX2,
+    CPU_ISA_AVX512
+  };
+
+  inline const char *cpu_isa_name(cpu_isa_t isa) {
+    switch (isa) {
+      case CPU_ISA_AVX2: return "avx2";
+      case CPU_ISA_AVX512: return "avx512";
+      default: return "scalar";
+    }
+  }
+
+  inline cpu_isa_t detect_cpu_isa() {
+    cpu_isa_t result = CPU_ISA_SCALAR;
+#if TWENTY48_HAVE_AVX2_TARGET
+    if (__builtin_cpu_supports("avx2")) result = CPU_ISA_AVX2;
+#endif
+#if TWENTY48_HAVE_AVX512_TARGET
+    if (__builtin_cpu_supports("avx512f") &&
+      __builtin_cpu_supports("avx512bw")) result = CPU_ISA_AVX512;
+#endif
+
+    // Allow the user to cap the instruction set, e.g. for testing.
+    if (getenv("TWENTY48_NO_SIMD")) return CPU_ISA_SCALAR;
+    const char *cap = getenv("TWENTY48_ISA");
+    if (cap) {
+      for (int isa = CPU_ISA_SCALAR; isa < result; ++isa) {
+        if (strcmp(cap, cpu_isa_name((cpu_isa_t)isa)) == 0) {
+          return (cpu_isa_t)isa;
+        }
+      }
+    }
+    return result;
+  }
+
+  /**
+   * The best instruction set that this CPU supports. Set the TWENTY48_NO_SIMD
+   * environment variable to force the scalar code paths, or set TWENTY48_ISA
+   * to `scalar` or `avx2` to use at most that instruction set, e.g. for
+   * testing or benchmarking.
+   */
+  inline cpu_isa_t cpu_isa() {
+    static const cpu_isa_t result = detect_cpu_isa();
+    return result;
+  }
+
+  /**
+   * Does this CPU support AVX2 (and are we allowed to use it)?
+   */
+  inline bool cpu_has_avx2() {
+    return cpu_isa() >= CPU_ISA_AVX2;
+  }
+
+  /**
+   * Does this CPU support AVX-512 F and BW (and are we allowed to use it)?
+   */
+  inline bool cpu_has_avx512() {
+    return cpu_isa() >= CPU_ISA_AVX512;
+  }
+}
+
+#define TWENTY48_CPU_FEATURES_HPP
+#endif
@@ -0,0 +1,739 @@
+//
+// Build the states for a layer model natively, from the start states to the
+// last layer. This does the same as LayerBuilder#build_start_state_layers and
+// LayerBuilder#build with the `threads` option, but without Ruby, and it
+// writes the same files in the same layout, so the Ruby tooling (the solver,
+// tranche builder, and so on) can carry on from its output. Build with `make`
+// in this directory (or `rake driver` from the project root).
+//
+// Usage: layer_build [-v] [-p] [-b batch_size] [-t threads]
+//   [-m working_memory] [-l start_layer_sum] [-r data_root]
+//   board_size max_exponent max_depth
+//
+// The options are as for LayerBuilder: -t is the number of threads (default:
+// one per core), -m is the memory budget for successors in bytes, and -p
+// merges the successors that stay in the same max value straight from memory.
+// With -l, the build resumes from the given layer, as for LayerBuilder#build
+// with `start_layer_sum` and `resume`: parts that have valid checkpoints from
+// a build that stopped are skipped. The default data root is `data`, as for
+// Twenty48::Data.
+//
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <glob.h>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../batch_checkpoint.hpp"
+#include "../layer_builder.hpp"
+#include "../merge_states.hpp"
+#include "../start_states.hpp"
+#include "../vbyte_index.hpp"
+#include "../vbyte_writer.hpp"
+
+using namespace twenty48;
+
+namespace {
+  struct options_t {
+    options_t() : board_size(0), max_exponent(0), max_depth(0),
+      batch_size(1 << 16), num_threads(0), max_bytes(0), start_layer_sum(4),
+      resume(false), pipeline(false), verbose(false), data_root("data") { }
+
+    int board_size;
+    int max_exponent;
+    int max_depth;
+    size_t batch_size;
+    size_t num_threads;
+    size_t max_bytes;
+    int start_layer_sum;
+    bool resume;
+    bool pipeline;
+    bool verbose;
+    std::string data_root;
+  };
+
+  std::string format(const char *format, ...) {
+    char buffer[1024];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    return buffer;
+  }
+
+  std::vector<std::string> glob_pathnames(const std::string &pattern) {
+    std::vector<std::string> pathnames;
+    glob_t glob_result;
+    if (glob(pattern.c_str(), 0, NULL, &glob_result) == 0) {
+      for (size_t i = 0; i < glob_result.gl_pathc; ++i) {
+        pathnames.push_back(glob_result.gl_pathv[i]);
+      }
+    }
+    globfree(&glob_result);
+    return pathnames; // glob sorts them
+  }
+
+  void make_folder(const std::string &pathname) {
+    if (mkdir(pathname.c_str(), 0777) == 0 || errno == EEXIST) return;
+    throw std::runtime_error("layer_build: failed to mkdir " + pathname);
+  }
+
+  void remove_file(const std::string &pathname) {
+    if (std::remove(pathname.c_str()) == 0) return;
+    throw std::runtime_error("layer_build: failed to remove " + pathname);
+  }
+
+  void rename_file(const std::string &from, const std::string &to) {
+    if (std::rename(from.c_str(), to.c_str()) == 0) return;
+    throw std::runtime_error("layer_build: failed to rename " + from);
+  }
+
+  bool file_exists(const std::string &pathname) {
+    struct stat stat_buf;
+    return stat(pathname.c_str(), &stat_buf) == 0;
+  }
+
+  size_t file_size(const std::string &pathname) {
+    struct stat stat_buf;
+    if (stat(pathname.c_str(), &stat_buf) != 0) return 0;
+    return stat_buf.st_size;
+  }
+
+  /**
+   * Find the maximum number of files we can open, after raising the soft
+   * limit as far as we are allowed. A merge with more fragments than this
+   * needs extra passes. As in LayerBuilder#max_files, leave some for other
+   * uses.
+   */
+  size_t find_max_files() {
+    const size_t GRACE = 16;
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0) return 256 - GRACE;
+    if (limit.rlim_cur < limit.rlim_max) {
+      limit.rlim_cur = limit.rlim_max;
+      setrlimit(RLIMIT_NOFILE, &limit);
+      getrlimit(RLIMIT_NOFILE, &limit);
+    }
+    return limit.rlim_cur > GRACE ? limit.rlim_cur - GRACE : 1;
+  }
+
+  /**
+   * The contents of a part's info.json: its size and index.
+   */
+  struct part_info_t {
+    part_info_t() : num_states(0), batch_size(0) { }
+
+    size_t num_states;
+    size_t batch_size;
+    vbyte_index_t index;
+  };
+
+  /**
+   * Names of the files in a layer model, as laid out by Twenty48::Data.
+   */
+  struct layer_files_t {
+    explicit layer_files_t(const options_t &options) {
+      std::string game = options.data_root + format(
+        "/game-board_size-%d.max_exponent-%x",
+        options.board_size, options.max_exponent);
+      model = game + format("/layer_model-max_depth-%d", options.max_depth);
+      make_folder(options.data_root);
+      make_folder(game);
+      make_folder(model);
+    }
+
+    std::string part(int sum, int max_value) const {
+      return model + format("/part-sum-%04d.max_value-%x", sum, max_value);
+    }
+
+    std::string states(int sum, int max_value) const {
+      return part(sum, max_value) + "/states.vbyte";
+    }
+
+    std::string info(int sum, int max_value) const {
+      return part(sum, max_value) + "/info.json";
+    }
+
+    std::string fragment(int sum, int max_value,
+      int input_sum, int input_max_value, size_t batch, size_t spill) const
+    {
+      return part(sum, max_value) + format(
+        "/fragment-input_sum-%04d.input_max_value-%x"
+        ".batch-%04zu.spill-%04zu.vbyte",
+        input_sum, input_max_value, batch, spill);
+    }
+
+    std::vector<std::string> fragments(int sum, int max_value) const {
+      return glob_pathnames(part(sum, max_value) + "/fragment-*.vbyte");
+    }
+
+    std::vector<std::string> batch_fragments(int sum, int max_value,
+      int input_sum, int input_max_value, size_t batch) const
+    {
+      return glob_pathnames(part(sum, max_value) + format(
+        "/fragment-input_sum-%04d.input_max_value-%x.batch-%04zu.spill-*"
+        ".vbyte", input_sum, input_max_value, batch));
+    }
+
+    std::string checkpoint(int sum, int max_value, size_t batch) const {
+      return part(sum, max_value) +
+        format("/checkpoint-batch-%04zu.txt", batch);
+    }
+
+    std::vector<std::string> checkpoints(int sum, int max_value) const {
+      return glob_pathnames(part(sum, max_value) + "/checkpoint-*.txt");
+    }
+
+    /**
+     * The max values of the parts in the given layer, in ascending order.
+     */
+    std::vector<int> find_max_values(int sum) const {
+      std::vector<int> max_values;
+      std::vector<std::pair<int, int> > parts = find_parts();
+      for (size_t i = 0; i < parts.size(); ++i) {
+        if (parts[i].first == sum) max_values.push_back(parts[i].second);
+      }
+      std::sort(max_values.begin(), max_values.end());
+      return max_values;
+    }
+
+    std::vector<std::pair<int, int> > find_parts() const {
+      std::vector<std::pair<int, int> > parts;
+      std::vector<std::string> pathnames =
+        glob_pathnames(model + "/part-sum-*.max_value-*");
+      for (size_t i = 0; i < pathnames.size(); ++i) {
+        const char *name = pathnames[i].c_str() + model.size() + 1;
+        int sum, max_value;
+        if (sscanf(name, "part-sum-%d.max_value-%x", &sum, &max_value) == 2) {
+          parts.push_back(std::make_pair(sum, max_value));
+        }
+      }
+      return parts;
+    }
+
+    void make_part(int sum, int max_value) const {
+      make_folder(part(sum, max_value));
+    }
+
+    void remove_part(int sum, int max_value) const {
+      std::string pathname = part(sum, max_value);
+      std::vector<std::string> files = glob_pathnames(pathname + "/*");
+      for (size_t i = 0; i < files.size(); ++i) remove_file(files[i]);
+      if (rmdir(pathname.c_str()) != 0) {
+        throw std::runtime_error("layer_build: failed to rmdir " + pathname);
+      }
+    }
+
+    /**
+     * Write the info in the same form as LayerBuilder; like it, leave out the
+     * implicit first entry in the index, which is at the start of the file.
+     * It is written last, when a part is complete, so it is renamed into
+     * place.
+     */
+    void write_info(int sum, int max_value, size_t batch_size,
+      size_t num_states, const vbyte_index_t &index) const
+    {
+      std::string pathname = info(sum, max_value);
+      write_info_file(pathname + ".tmp", batch_size, num_states, index);
+      rename_file(pathname + ".tmp", pathname);
+    }
+
+    /**
+     * Read an info file as written by write_info (or by JSON.dump). This is
+     * not a general JSON parser. The index includes the implicit first entry.
+     * Returns false if there is no info file.
+     */
+    bool read_info(int sum, int max_value, part_info_t &info) const {
+      std::ifstream is(this->info(sum, max_value).c_str());
+      if (!is) return false;
+      std::stringstream ss;
+      ss << is.rdbuf();
+      std::string json = ss.str();
+      json.erase(std::remove_if(json.begin(), json.end(), ::isspace),
+        json.end());
+
+      info = part_info_t();
+      info.num_states = read_number(json, "\"num_states\":", 0);
+      info.batch_size = read_number(json, "\"batch_size\":", 0);
+      info.index.push_back(vbyte_index_entry_t());
+      size_t offset = 0;
+      for (;;) {
+        offset = json.find("\"byte_offset\":", offset);
+        if (offset == std::string::npos) break;
+        size_t byte_offset = read_number(json, "\"byte_offset\":", offset);
+        size_t previous_offset = json.find("\"previous\":\"", offset);
+        if (previous_offset == std::string::npos) {
+          throw std::runtime_error("layer_build: bad index in info");
+        }
+        uint64_t previous = strtoull(
+          json.c_str() + previous_offset + strlen("\"previous\":\""), NULL, 16);
+        info.index.push_back(vbyte_index_entry_t(byte_offset, previous));
+        offset = previous_offset;
+      }
+      return true;
+    }
+
+  private:
+    std::string model;
+
+    static void write_info_file(const std::string &pathname,
+      size_t batch_size, size_t num_states, const vbyte_index_t &index)
+    {
+      std::ofstream os(pathname.c_str());
+      os << "{\"num_states\":" << num_states <<
+        ",\"batch_size\":" << batch_size << ",\"index\":[";
+      for (size_t i = 0; i < index.size(); ++i) {
+        if (i > 0) os << ',';
+        os << "{\"byte_offset\":" << index[i].byte_offset <<
+          ",\"previous\":\"" << std::hex << index[i].previous << std::dec <<
+          "\"}";
+      }
+      os << "]}";
+      if (!os) throw std::runtime_error("layer_build: failed to write info");
+    }
+
+    static size_t read_number(const std::string &json, const char *key,
+      size_t offset)
+    {
+      offset = json.find(key, offset);
+      if (offset == std::string::npos) {
+        throw std::runtime_error(std::string("layer_build: no ") + key);
+      }
+      return strtoull(json.c_str() + offset + strlen(key), NULL, 10);
+    }
+  };
+
+  template <int size> struct driver_t {
+    typedef std::vector<state_t<size> > state_vector_t;
+
+    explicit driver_t(const options_t &options) :
+      options(options), files(options),
+      valuer(options.max_exponent, options.max_depth, 1.0),
+      max_files(find_max_files()) { }
+
+    /**
+     * Build the first 3 layers, which have sums 4, 6, and 8, as in
+     * LayerBuilder#build_start_state_layers.
+     */
+    void build_start_state_layers() {
+      state_vector_t start_states = generate_start_states<size>();
+      for (int layer_sum = 4; layer_sum <= 8; layer_sum += 2) {
+        std::map<int, std::vector<uint64_t> > states_by_max_value;
+        for (size_t i = 0; i < start_states.size(); ++i) {
+          if (start_states[i].sum() != layer_sum) continue;
+          states_by_max_value[start_states[i].max_value()].push_back(
+            start_states[i].get_nybbles());
+        }
+
+        for (auto it = states_by_max_value.begin();
+          it != states_by_max_value.end(); ++it) {
+          int max_value = it->first;
+          files.make_part(layer_sum, max_value);
+          if (layer_sum == 4) {
+            // The sum 4 layer is complete.
+            vbyte_index_t index;
+            write_states(files.states(layer_sum, max_value), it->second,
+              index);
+            files.write_info(layer_sum, max_value, options.batch_size,
+              it->second.size(), index);
+          } else {
+            // The sum 6 and 8 layers are reachable from the 4 layer, so we
+            // need to output fragments for them.
+            vbyte_index_t index;
+            write_states(files.fragment(layer_sum, max_value,
+              layer_sum, max_value, 0, 0), it->second, index);
+          }
+        }
+      }
+    }
+
+    /**
+     * Build each layer after the start state layers, until there are two
+     * empty layers in a row, as in LayerBuilder#build. Returns the total
+     * number of states.
+     */
+    size_t build(int start_layer_sum) {
+      size_t total_states = 0;
+      int skips = 0;
+      int layer_sum = start_layer_sum;
+      while (skips < 2) {
+        size_t num_states = build_layer(layer_sum);
+        if (num_states > 0) {
+          skips = 0;
+        } else {
+          skips += 1;
+        }
+        total_states += num_states;
+        layer_sum += 2;
+      }
+      remove_empty_layer_parts(layer_sum + 4);
+      return total_states;
+    }
+
+  private:
+    const options_t &options;
+    layer_files_t files;
+    valuer_t<size> valuer;
+    size_t max_files;
+
+    void write_states(const std::string &pathname,
+      const std::vector<uint64_t> &states, vbyte_index_t &index)
+    {
+      vbyte_writer_t vbyte_writer(pathname.c_str());
+      for (size_t i = 0; i < states.size(); ++i) {
+        vbyte_writer.write(states[i]);
+        if ((i + 1) % options.batch_size == 0) {
+          index.push_back(vbyte_index_entry_t(
+            vbyte_writer.get_bytes_written(), vbyte_writer.get_previous()));
+        }
+      }
+    }
+
+    size_t build_layer(int layer_sum) {
+      std::vector<int> max_values = files.find_max_values(layer_sum);
+      if (max_values.empty()) return 0;
+
+      size_t num_states = 0;
+      for (size_t i = 0; i < max_values.size(); ++i) {
+        build_layer_part(layer_sum, max_values[i]);
+        reduce_layer_parts(layer_sum, max_values[i]);
+        num_states += count_states(layer_sum, max_values[i]);
+      }
+      reduce_layer_parts(layer_sum, max_values.back() + 1);
+      remove_layer_checkpoints(layer_sum, max_values);
+      return num_states;
+    }
+
+    size_t count_states(int sum, int max_value) {
+      part_info_t info;
+      if (!files.read_info(sum, max_value, info)) return 0;
+      return info.num_states;
+    }
+
+    void build_layer_part(int sum, int max_value) {
+      part_info_t info;
+      bool found = files.read_info(sum, max_value, info);
+      size_t num_batches = found && info.num_states > 0 ? info.index.size() : 0;
+      log(format("build %d-%x: %zu states (%zu batches)",
+        sum, max_value, info.num_states, num_batches));
+      if (num_batches == 0) return;
+
+      // The threads share out the batches, so the whole part is one batch
+      // for the purposes of checkpoints and fragment names.
+      if (skip_batch(sum, max_value, 0)) return;
+
+      std::string pathnames[4];
+      for (size_t i = 0; i < 4; ++i) {
+        int output_sum = sum + 2 * OUTPUT_STEPS[i];
+        int output_max_value = max_value + OUTPUT_JUMPS[i];
+        files.make_part(output_sum, output_max_value);
+        pathnames[i] = files.fragment(output_sum, output_max_value,
+          sum, max_value, 0, 0);
+      }
+
+      layer_builder_t<size> builder(max_value,
+        pathnames[0].c_str(), pathnames[1].c_str(),
+        pathnames[2].c_str(), pathnames[3].c_str(),
+        valuer, false, 1, options.max_bytes);
+      std::string input_pathname = files.states(sum, max_value);
+      if (options.pipeline && !resume_reduced(sum + 2, max_value)) {
+        expand_and_merge_layer_part(builder, info, input_pathname,
+          sum + 2, max_value);
+      } else {
+        builder.expand_all_threaded(input_pathname.c_str(), info.index,
+          info.batch_size, options.num_threads);
+      }
+      rename_spills(pathnames, sum, max_value);
+      write_checkpoint(sum, max_value, 0);
+
+      size_t num_lookups = builder.get_num_filter_lookups();
+      log(format("filter %d-%x: %.1f%% of %zu successors were repeats",
+        sum, max_value, num_lookups == 0 ? 0.0 :
+        100.0 * builder.get_num_filter_hits() / num_lookups, num_lookups));
+    }
+
+    std::vector<std::string> batch_fragments(int sum, int max_value,
+      size_t batch)
+    {
+      std::vector<std::string> pathnames;
+      for (size_t i = 0; i < 4; ++i) {
+        std::vector<std::string> output_pathnames = files.batch_fragments(
+          sum + 2 * OUTPUT_STEPS[i], max_value + OUTPUT_JUMPS[i],
+          sum, max_value, batch);
+        pathnames.insert(pathnames.end(),
+          output_pathnames.begin(), output_pathnames.end());
+      }
+      return pathnames;
+    }
+
+    void write_checkpoint(int sum, int max_value, size_t batch) {
+      write_batch_checkpoint(files.checkpoint(sum, max_value, batch).c_str(),
+        batch_fragments(sum, max_value, batch));
+    }
+
+    /**
+     * When resuming, skip a batch if its checkpoint is valid. Otherwise, its
+     * fragments may be incomplete, so remove them, and any spills that were
+     * not renamed, before it runs again.
+     */
+    bool skip_batch(int sum, int max_value, size_t batch) {
+      if (!options.resume) return false;
+      std::string checkpoint = files.checkpoint(sum, max_value, batch);
+      if (check_batch_checkpoint(checkpoint.c_str())) {
+        log(format("skip %d-%x: checkpoint", sum, max_value));
+        return true;
+      }
+
+      std::vector<std::string> pathnames = batch_fragments(sum, max_value,
+        batch);
+      for (size_t i = 0; i < 4; ++i) {
+        std::vector<std::string> spill_pathnames = glob_pathnames(
+          files.fragment(sum + 2 * OUTPUT_STEPS[i],
+            max_value + OUTPUT_JUMPS[i], sum, max_value, batch, 0) +
+          ".spill-*");
+        pathnames.insert(pathnames.end(),
+          spill_pathnames.begin(), spill_pathnames.end());
+      }
+      for (size_t i = 0; i < pathnames.size(); ++i) remove_file(pathnames[i]);
+      return false;
+    }
+
+    void remove_layer_checkpoints(int sum, const std::vector<int> &max_values)
+    {
+      for (size_t i = 0; i < max_values.size(); ++i) {
+        std::vector<std::string> pathnames =
+          files.checkpoints(sum, max_values[i]);
+        for (size_t j = 0; j < pathnames.size(); ++j) {
+          remove_file(pathnames[j]);
+        }
+      }
+    }
+
+    /**
+     * When resuming, an output part may already have been reduced, or it may
+     * have been partly written, in which case we remove it to start it again.
+     */
+    bool resume_reduced(int sum, int max_value) {
+      if (!options.resume) return false;
+      if (file_exists(files.info(sum, max_value))) return true;
+      std::remove(files.states(sum, max_value).c_str());
+      return false;
+    }
+
+    void expand_and_merge_layer_part(layer_builder_t<size> &builder,
+      const part_info_t &input_info, const std::string &input_pathname,
+      int output_sum, int output_max_value)
+    {
+      std::vector<std::string> fragment_pathnames =
+        files.fragments(output_sum, output_max_value);
+      std::string output_pathname = files.states(output_sum, output_max_value);
+      check_not_done(output_pathname);
+
+      vbyte_index_t index;
+      size_t num_states = builder.expand_all_threaded_and_merge(
+        input_pathname.c_str(), input_info.index, input_info.batch_size,
+        options.num_threads, fragment_pathnames, output_pathname.c_str(),
+        options.batch_size, index);
+      files.write_info(output_sum, output_max_value, options.batch_size,
+        num_states, index);
+
+      for (size_t i = 0; i < fragment_pathnames.size(); ++i) {
+        remove_file(fragment_pathnames[i]);
+      }
+    }
+
+    /**
+     * Give any runs that the builder spilled fragment names, so the reduce
+     * step finds them, as in LayerBuilder#rename_spills.
+     */
+    void rename_spills(const std::string pathnames[4], int sum,
+      int max_value)
+    {
+      for (size_t i = 0; i < 4; ++i) {
+        std::vector<std::string> spill_pathnames =
+          glob_pathnames(pathnames[i] + ".spill-*");
+        for (size_t j = 0; j < spill_pathnames.size(); ++j) {
+          rename_file(spill_pathnames[j], files.fragment(
+            sum + 2 * OUTPUT_STEPS[i], max_value + OUTPUT_JUMPS[i],
+            sum, max_value, 0, j + 1));
+        }
+      }
+    }
+
+    /**
+     * The max values are processed in ascending order, so once we've built
+     * successors from a part, all parts with layer_sum = this layer_sum + 2
+     * and max_value <= this max_value are done --- no other parts will add
+     * successors to them.
+     */
+    void reduce_layer_parts(int sum, int max_value) {
+      std::vector<int> max_values = files.find_max_values(sum + 2);
+      for (size_t i = 0; i < max_values.size(); ++i) {
+        if (max_values[i] > max_value) break;
+        reduce_output_part_fragments(sum + 2, max_values[i]);
+      }
+    }
+
+    void reduce_output_part_fragments(int sum, int max_value) {
+      std::vector<std::string> input_pathnames =
+        files.fragments(sum, max_value);
+      if (input_pathnames.empty()) return;
+
+      // Any fragments left in a part that was already reduced are merged.
+      if (resume_reduced(sum, max_value)) {
+        for (size_t i = 0; i < input_pathnames.size(); ++i) {
+          remove_file(input_pathnames[i]);
+        }
+        return;
+      }
+      log_reduce_step(sum, max_value, input_pathnames);
+
+      std::string output_pathname = files.states(sum, max_value);
+      check_not_done(output_pathname);
+
+      vbyte_index_t index;
+      size_t num_states = merge_states(input_pathnames,
+        output_pathname.c_str(), options.batch_size, index,
+        options.num_threads, max_files);
+      files.write_info(sum, max_value, options.batch_size, num_states, index);
+
+      for (size_t i = 0; i < input_pathnames.size(); ++i) {
+        remove_file(input_pathnames[i]);
+      }
+    }
+
+    /**
+     * The build process can leave some empty parts, and it's easiest to just
+     * clean them up at the end.
+     */
+    void remove_empty_layer_parts(int max_layer_sum) {
+      std::vector<std::pair<int, int> > parts = files.find_parts();
+      for (size_t i = 0; i < parts.size(); ++i) {
+        int sum = parts[i].first;
+        int max_value = parts[i].second;
+        if (sum > max_layer_sum) continue;
+        if (file_size(files.states(sum, max_value)) > 0) continue;
+        files.remove_part(sum, max_value);
+      }
+    }
+
+    void check_not_done(const std::string &pathname) {
+      if (!file_exists(pathname)) return;
+      throw std::runtime_error("layer_build: already done: " + pathname);
+    }
+
+    void log_reduce_step(int sum, int max_value,
+      const std::vector<std::string> &input_pathnames)
+    {
+      size_t total_size = 0;
+      size_t max_size = 0;
+      for (size_t i = 0; i < input_pathnames.size(); ++i) {
+        size_t size_i = file_size(input_pathnames[i]);
+        total_size += size_i;
+        max_size = std::max(max_size, size_i);
+      }
+      log(format("reduce %d-%x: %.1fMiB (%.1fMiB max)", sum, max_value,
+        total_size / 1048576.0, max_size / 1048576.0));
+    }
+
+    void log(const std::string &message) {
+      if (!options.verbose) return;
+      char time_string[64];
+      time_t now = time(NULL);
+      strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S %z",
+        localtime(&now));
+      std::cout << time_string << ": " << message << std::endl;
+    }
+
+    // The outputs of layer_builder_t, in order: 1_0, 1_1, 2_0, 2_1.
+    static const int OUTPUT_STEPS[4];
+    static const int OUTPUT_JUMPS[4];
+  };
+
+  template <int size> const int driver_t<size>::OUTPUT_STEPS[4] = {1, 1, 2, 2};
+  template <int size> const int driver_t<size>::OUTPUT_JUMPS[4] = {0, 1, 0, 1};
+
+  template <int size>
+  size_t run(const options_t &options) {
+    driver_t<size> driver(options);
+    if (!options.resume) driver.build_start_state_layers();
+    return driver.build(options.start_layer_sum);
+  }
+
+  void usage() {
+    std::cerr << "usage: layer_build [-v] [-p] [-b batch_size] [-t threads]"
+      " [-m working_memory] [-l start_layer_sum] [-r data_root]"
+      " board_size max_exponent max_depth" << std::endl;
+    exit(1);
+  }
+}
+
+int main(int argc, char **argv) {
+  options_t options;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "vpb:t:m:l:r:")) != -1) {
+    switch (opt) {
+      case 'v': options.verbose = true; break;
+      case 'p': options.pipeline = true; break;
+      case 'b': options.batch_size = strtoull(optarg, NULL, 10); break;
+      case 't': options.num_threads = strtoull(optarg, NULL, 10); break;
+      case 'm': options.max_bytes = strtoull(optarg, NULL, 10); break;
+      case 'l':
+        options.start_layer_sum = atoi(optarg);
+        options.resume = true;
+        break;
+      case 'r': options.data_root = optarg; break;
+      default: usage();
+    }
+  }
+  if (argc - optind != 3) usage();
+  options.board_size = atoi(argv[optind]);
+  options.max_exponent = atoi(argv[optind + 1]);
+  options.max_depth = atoi(argv[optind + 2]);
+
+  // Otherwise we cannot concatenate the policy files as binary files.
+  if (options.batch_size == 0 || options.batch_size % 4 != 0) {
+    std::cerr << "layer_build: batch size must be multiple of 4" << std::endl;
+    return 1;
+  }
+  if (options.start_layer_sum < 4 || options.start_layer_sum % 2 != 0) {
+    std::cerr << "layer_build: bad start layer sum" << std::endl;
+    return 1;
+  }
+
+  size_t num_states;
+  try {
+    switch (options.board_size) {
+      case 2: num_states = run<2>(options); break;
+      case 3: num_states = run<3>(options); break;
+      case 4: num_states = run<4>(options); break;
+      default:
+        std::cerr << "layer_build: bad board size" << std::endl;
+        return 1;
+    }
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  } catch (const std::exception *e) {
+    std::cerr << e->what() << std::endl;
+    return 1;
+  }
+
+  if (options.verbose) {
+    std::cout << "built " << num_states << " states" << std::endl;
+  }
+  return 0;
+}
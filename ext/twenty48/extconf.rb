@@ -4,8 +4,20 @@
 
 require 'mkmf'
 
-$CFLAGS += ' -mavx '
-$CXXFLAGS += ' -std=c++11 -mavx '
+# The vbyte decoder needs SSE4.1. The state kernels choose between scalar,
+# AVX2 and AVX-512 code at runtime (see cpu_features.hpp), so they do not need
+# any flags. To tune the whole extension for a particular CPU, set
+# TWENTY48_MARCH, e.g. to native.
+$CFLAGS += ' -msse4.1 '
+$CXXFLAGS += ' -std=c++11 '
+
+# The layer builder sorts its outputs on several threads.
+$CXXFLAGS += ' -pthread '
+$LDFLAGS += ' -pthread '
+if ENV['TWENTY48_MARCH']
+  $CFLAGS += " -march=#{ENV['TWENTY48_MARCH']} "
+  $CXXFLAGS += " -march=#{ENV['TWENTY48_MARCH']} "
+end
 $CXXFLAGS += ' -fno-omit-frame-pointer ' if ENV['PERF']
 
 # On Linux, it defaults to -O2, but -O3 still tests out OK.
@@ -1,12 +1,17 @@
 #ifndef TWENTY48_LAYER_BUILDER_HPP
 
+#include <array>
+#include <cstdio>
 #include <iostream>
 
-#include "btree_set.h"
-
 #include "twenty48.hpp"
 #include "state.hpp"
+#include "layer_output.hpp"
+#include "merge_states.hpp"
+#include "state_batch.hpp"
+#include "threads.hpp"
 #include "valuer.hpp"
+#include "vbyte_index.hpp"
 #include "vbyte_reader.hpp"
 #include "vbyte_writer.hpp"
 #include "policy_reader.hpp"
@@ -19,30 +24,151 @@ namespace twenty48 {
    * only progress to a state with sum N + 2 or N + 4 (or you can lose). That
    * means that we should never actually have to load the whole state space
    * at once.
+   *
+   * If `sort_outputs` is set, the successors are collected in buffers that
+   * are sorted when they are written, rather than in btree sets; see
+   * layer_output_t. The sorts use `sort_threads` threads.
+   *
+   * If `max_bytes` is positive, it is a budget for the memory used to hold
+   * the successors. Whenever they take more than that, they are written out
+   * as sorted runs (see spill_pathname) and cleared, so the build can carry
+   * on. The runs are merged later along with the other fragments. The budget
+   * does not include the temporary buffer needed to sort a sorted output.
    */
   template <int size> struct layer_builder_t {
     typedef std::vector<state_t<size> > state_vector_t;
-    typedef btree::btree_set<state_t<size> > state_set_t;
 
     layer_builder_t(
       uint8_t input_max_value,
       const char *pathname_1_0, const char *pathname_1_1,
       const char *pathname_2_0, const char *pathname_2_1,
-      const valuer_t<size> &valuer) :
+      const valuer_t<size> &valuer,
+      bool sort_outputs = false, size_t sort_threads = 1,
+      size_t max_bytes = 0) :
       input_max_value(input_max_value),
       pathname_1_0(pathname_1_0), pathname_1_1(pathname_1_1),
       pathname_2_0(pathname_2_0), pathname_2_1(pathname_2_1),
-      valuer(valuer) { }
+      valuer(valuer),
+      output_1_0(sort_outputs, sort_threads),
+      output_1_1(sort_outputs, sort_threads),
+      output_2_0(sort_outputs, sort_threads),
+      output_2_1(sort_outputs, sort_threads),
+      max_bytes(max_bytes), num_spills(0), spill_offset(0), spill_stride(1),
+      num_filter_lookups(0), num_filter_hits(0)
+      { }
 
-    void expand_all(twenty48::vbyte_reader_t &vbyte_reader) {
-      for (;;) {
-        uint64_t nybbles = vbyte_reader.read();
-        if (nybbles == 0) break;
-        expand(state_t<size>(nybbles));
+    /**
+     * The pathname for a sorted run that was spilled from the output with the
+     * given pathname. Spills are numbered from zero, but the numbers may have
+     * gaps when the builder runs on several threads.
+     */
+    static std::string spill_pathname(const char *pathname, size_t spill) {
+      return std::string(pathname) + ".spill-" + std::to_string(spill);
+    }
+
+    /**
+     * The number of successors that were looked up in the outputs' filters
+     * of recent successors, and the number that were found there and so
+     * skipped, including those on worker threads. The hit rate is a guide
+     * to the filter size; see layer_output_t.
+     */
+    size_t get_num_filter_lookups() const {
+      size_t total = num_filter_lookups;
+      for (size_t i = 0; i < 4; ++i) {
+        total += get_output(i).get_filter().get_num_lookups();
+      }
+      return total;
+    }
+
+    size_t get_num_filter_hits() const {
+      size_t total = num_filter_hits;
+      for (size_t i = 0; i < 4; ++i) {
+        total += get_output(i).get_filter().get_num_hits();
       }
+      return total;
+    }
+
+    void expand_all(twenty48::vbyte_reader_t &vbyte_reader) {
+      expand(vbyte_reader);
       write_all_states();
     }
 
+    /**
+     * Expand a whole input part on `num_threads` threads (or one per core, if
+     * zero), rather than one batch. Each entry in the part's index starts a
+     * batch of `batch_size` states, and the threads share out the batches
+     * with a work_queue_t. Each thread has its own copy of the valuer and its
+     * own sorted outputs, which are merged into the output files at the end.
+     * Each thread gets an equal share of the memory budget, if any.
+     */
+    void expand_all_threaded(const char *input_pathname,
+      const twenty48::vbyte_index_t &vbyte_index, size_t batch_size,
+      size_t num_threads)
+    {
+      std::vector<layer_builder_t> workers;
+      expand_threaded(input_pathname, vbyte_index, batch_size, num_threads,
+        workers);
+
+      // Each output goes to its own file, so we can merge them in parallel.
+      run_threads(4, [&](size_t i) {
+        write_merged(get_worker_outputs(workers, i),
+          get_output_pathname(i).c_str());
+      });
+    }
+
+    /**
+     * Like expand_all_threaded, but pipelined: once this part has been
+     * expanded, the output part for the `pathname_1_0` successors, which are
+     * in the next layer with the same max value, is complete. Rather than
+     * write those successors to a fragment and merge it later, merge them
+     * straight from memory, along with that part's other fragments, into its
+     * states file, `part_pathname`, and index it with the given stride. Only
+     * the other outputs, and any runs spilled to stay within the memory
+     * budget, go through fragment files. Returns the number of states in the
+     * output part.
+     */
+    size_t expand_all_threaded_and_merge(const char *input_pathname,
+      const twenty48::vbyte_index_t &vbyte_index, size_t batch_size,
+      size_t num_threads, const std::vector<std::string> &fragment_pathnames,
+      const char *part_pathname, size_t index_stride,
+      twenty48::vbyte_index_t &part_index)
+    {
+      std::vector<layer_builder_t> workers;
+      expand_threaded(input_pathname, vbyte_index, batch_size, num_threads,
+        workers);
+
+      size_t num_states = 0;
+      run_threads(4, [&](size_t i) {
+        std::vector<layer_output_t<size> *> outputs =
+          get_worker_outputs(workers, i);
+        if (i > 0) {
+          write_merged(outputs, get_output_pathname(i).c_str());
+          return;
+        }
+
+        std::vector<std::string> spill_pathnames;
+        for (size_t j = 0; j < workers.size(); ++j) {
+          workers[j].get_spill_pathnames(pathname_1_0, spill_pathnames);
+        }
+        std::vector<std::string> input_pathnames(fragment_pathnames);
+        input_pathnames.insert(input_pathnames.end(),
+          spill_pathnames.begin(), spill_pathnames.end());
+
+        std::vector<const std::vector<uint64_t> *> runs;
+        for (size_t j = 0; j < outputs.size(); ++j) {
+          runs.push_back(&outputs[j]->sorted_states());
+        }
+        num_states = merge_states(input_pathnames, runs, part_pathname,
+          index_stride, part_index);
+
+        for (size_t j = 0; j < outputs.size(); ++j) outputs[j]->clear();
+        for (size_t j = 0; j < spill_pathnames.size(); ++j) {
+          std::remove(spill_pathnames[j].c_str());
+        }
+      });
+      return num_states;
+    }
+
     void expand_with_policy(
       twenty48::vbyte_reader_t &vbyte_reader,
       twenty48::policy_reader_t &policy_reader)
@@ -57,6 +183,7 @@ namespace twenty48 {
             << " in " << direction << std::endl;
           throw std::runtime_error("layer_builder_t: no move from policy");
         }
+        spill_if_over_budget();
       }
       write_all_states();
     }
@@ -84,6 +211,7 @@ namespace twenty48 {
             }
           }
         }
+        spill_if_over_budget();
       }
       write_all_states();
     }
@@ -95,70 +223,174 @@ namespace twenty48 {
     std::string pathname_2_0;
     std::string pathname_2_1;
     valuer_t<size> valuer;
-    state_set_t output_1_0;
-    state_set_t output_1_1;
-    state_set_t output_2_0;
-    state_set_t output_2_1;
+    layer_output_t<size> output_1_0;
+    layer_output_t<size> output_1_1;
+    layer_output_t<size> output_2_0;
+    layer_output_t<size> output_2_1;
+    size_t max_bytes;
+    size_t num_spills;
+    size_t spill_offset;
+    size_t spill_stride;
+    size_t num_filter_lookups;
+    size_t num_filter_hits;
+
+    void expand_threaded(const char *input_pathname,
+      const twenty48::vbyte_index_t &vbyte_index, size_t batch_size,
+      size_t num_threads, std::vector<layer_builder_t> &workers)
+    {
+      if (num_threads == 0) num_threads = default_num_threads();
+
+      size_t worker_max_bytes =
+        max_bytes == 0 ? 0 : std::max(max_bytes / num_threads, (size_t)1);
+      workers.assign(num_threads, layer_builder_t(
+        input_max_value, pathname_1_0.c_str(), pathname_1_1.c_str(),
+        pathname_2_0.c_str(), pathname_2_1.c_str(), valuer, true, 1,
+        worker_max_bytes));
+      for (size_t i = 0; i < num_threads; ++i) {
+        workers[i].spill_offset = i;
+        workers[i].spill_stride = num_threads;
+      }
+
+      work_queue_t work_queue(vbyte_index.size(), num_threads);
+      run_threads(num_threads, [&](size_t i) {
+        size_t batch;
+        while (work_queue.pop(i, batch)) {
+          vbyte_reader_t vbyte_reader(input_pathname,
+            vbyte_index[batch].byte_offset, vbyte_index[batch].previous,
+            batch_size);
+          workers[i].expand(vbyte_reader);
+          workers[i].compact_all_states();
+          workers[i].spill_if_over_budget();
+        }
+      });
 
-    void expand(const state_t<size> &state) {
-      move(state, DIRECTION_UP);
-      move(state, DIRECTION_DOWN);
-      move(state, DIRECTION_LEFT);
-      move(state, DIRECTION_RIGHT);
+      for (size_t i = 0; i < num_threads; ++i) {
+        num_filter_lookups += workers[i].get_num_filter_lookups();
+        num_filter_hits += workers[i].get_num_filter_hits();
+      }
     }
 
-    bool move(const state_t<size> &state, direction_t direction)
+    static std::vector<layer_output_t<size> *> get_worker_outputs(
+      std::vector<layer_builder_t> &workers, size_t i)
     {
-      state_t<size> moved_state = state.move(direction);
-      if (moved_state == state) return false; // Cannot move in this direction.
+      std::vector<layer_output_t<size> *> outputs;
+      for (size_t j = 0; j < workers.size(); ++j) {
+        outputs.push_back(workers[j].get_outputs()[i]);
+      }
+      return outputs;
+    }
 
-      for (size_t i = 0; i < size * size; ++i) {
-        if (moved_state[i] != 0) continue;
-        add_successor(moved_state, i, 1);
-        add_successor(moved_state, i, 2);
+    const std::string &get_output_pathname(size_t i) const {
+      switch (i) {
+        case 0: return pathname_1_0;
+        case 1: return pathname_1_1;
+        case 2: return pathname_2_0;
+        default: return pathname_2_1;
       }
+    }
+
+    void get_spill_pathnames(const std::string &pathname,
+      std::vector<std::string> &spill_pathnames) const
+    {
+      for (size_t i = 0; i < num_spills; ++i) {
+        spill_pathnames.push_back(spill_pathname(pathname.c_str(),
+          spill_offset + i * spill_stride));
+      }
+    }
+
+    void expand(twenty48::vbyte_reader_t &vbyte_reader) {
+      state_block_t<size> block;
+      while (block.read(vbyte_reader) > 0) {
+        block.move_all();
+        for (size_t i = 0; i < block.get_length(); ++i) {
+          for (size_t j = 0; j < 4; ++j) {
+            direction_t direction = (direction_t)j;
+            if (!block.moved(i, direction)) continue;
+            add_successors(block.get_moved_state(i, direction));
+          }
+        }
+        spill_if_over_budget();
+      }
+    }
+
+    bool move(const state_t<size> &state, direction_t direction)
+    {
+      if (!state.can_move(direction)) return false;
+      add_successors(state.move(direction));
       return true;
     }
 
-    void add_successor(const state_t<size> &moved_state, size_t i, int step)
+    void add_successors(const state_t<size> &moved_state) {
+      typename state_t<size>::nybbles_t successors_1[size * size];
+      typename state_t<size>::nybbles_t successors_2[size * size];
+      uint8_t weights[size * size];
+      size_t n = moved_state.successors(successors_1, successors_2, weights);
+      for (size_t i = 0; i < n; ++i) {
+        add_successor(successors_1[i], 1);
+        add_successor(successors_2[i], 2);
+      }
+    }
+
+    void add_successor(const state_t<size> &successor, int step)
     {
-      state_t<size> successor =
-        moved_state.new_state_with_tile(i, step).canonicalize();
+      layer_output_t<size> *output;
+      bool same_max_value = input_max_value == successor.max_value();
+      if (step == 1) {
+        output = same_max_value ? &output_1_0 : &output_1_1;
+      } else {
+        output = same_max_value ? &output_2_0 : &output_2_1;
+      }
+
+      // A repeat of a recent successor does not need to be valued again.
+      if (output->inserted_recently(successor)) return;
       if (!std::isnan(valuer.value(successor))) return;
+      output->insert(successor);
+    }
 
-      uint8_t new_max_value = successor.max_value();
-      if (step == 1) {
-        if (input_max_value == new_max_value) {
-          output_1_0.insert(successor);
-        } else {
-          output_1_1.insert(successor);
-        }
-      } else if (step == 2) {
-        if (input_max_value == new_max_value) {
-          output_2_0.insert(successor);
-        } else {
-          output_2_1.insert(successor);
-        }
+    const layer_output_t<size> &get_output(size_t i) const {
+      switch (i) {
+        case 0: return output_1_0;
+        case 1: return output_1_1;
+        case 2: return output_2_0;
+        default: return output_2_1;
       }
     }
 
+    std::array<layer_output_t<size> *, 4> get_outputs() {
+      std::array<layer_output_t<size> *, 4> outputs = {{
+        &output_1_0, &output_1_1, &output_2_0, &output_2_1
+      }};
+      return outputs;
+    }
+
+    void compact_all_states() {
+      output_1_0.compact();
+      output_1_1.compact();
+      output_2_0.compact();
+      output_2_1.compact();
+    }
+
+    void spill_if_over_budget() {
+      if (max_bytes == 0) return;
+      size_t bytes = output_1_0.approximate_bytes_used() +
+        output_1_1.approximate_bytes_used() +
+        output_2_0.approximate_bytes_used() +
+        output_2_1.approximate_bytes_used();
+      if (bytes <= max_bytes) return;
+
+      size_t spill = spill_offset + num_spills * spill_stride;
+      output_1_0.write(spill_pathname(pathname_1_0.c_str(), spill).c_str());
+      output_1_1.write(spill_pathname(pathname_1_1.c_str(), spill).c_str());
+      output_2_0.write(spill_pathname(pathname_2_0.c_str(), spill).c_str());
+      output_2_1.write(spill_pathname(pathname_2_1.c_str(), spill).c_str());
+      num_spills += 1;
+    }
+
     void write_all_states() {
-      write_states(pathname_1_0.c_str(), output_1_0);
-      output_1_0.clear();
-      write_states(pathname_1_1.c_str(), output_1_1);
-      output_1_1.clear();
-      write_states(pathname_2_0.c_str(), output_2_0);
-      output_2_0.clear();
-      write_states(pathname_2_1.c_str(), output_2_1);
-      output_2_1.clear();
-    }
-
-    void write_states(const char *pathname, const state_set_t &layer) const {
-      vbyte_writer_t vbyte_writer(pathname);
-      for (typename state_set_t::const_iterator it = layer.begin();
-        it != layer.end(); ++it) {
-        vbyte_writer.write(it->get_nybbles());
-      }
+      output_1_0.write(pathname_1_0.c_str());
+      output_1_1.write(pathname_1_1.c_str());
+      output_2_0.write(pathname_2_0.c_str());
+      output_2_1.write(pathname_2_1.c_str());
     }
   };
 }
@@ -49,6 +49,11 @@ mmapped_layer_file_t::mmapped_layer_file_t(const char *pathname)
   // std::cout << "mmap " << file.pathname << " " << byte_size << "B" << std::hex << " @ " << (size_t)data << std::endl;
 }
 
+void mmapped_layer_file_t::advise_sequential() const {
+  // This is only advice, so it does not matter if it fails.
+  if (data != NULL) madvise(data, byte_size, MADV_SEQUENTIAL);
+}
+
 mmapped_layer_file_t::~mmapped_layer_file_t() {
   if (data == NULL) return;
   int rc = munmap(data, file.get_size());
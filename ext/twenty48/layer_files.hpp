@@ -31,6 +31,12 @@ struct mmapped_layer_file_t {
   size_t get_byte_size() const { return byte_size; }
 
   void *get_data() const { return data; }
+
+  /**
+   * Tell the kernel that we will read the file in order, so it can read
+   * ahead aggressively and drop pages behind us.
+   */
+  void advise_sequential() const;
 private:
   layer_file_t file;
   size_t byte_size;
@@ -0,0 +1,258 @@
+#ifndef TWENTY48_LAYER_OUTPUT_HPP
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "btree_set.h"
+
+#include "twenty48.hpp"
+#include "state.hpp"
+#include "loser_tree.hpp"
+#include "radix_sort.hpp"
+#include "vbyte_writer.hpp"
+
+namespace twenty48 {
+  /**
+   * A small two-way set associative cache of states that were inserted into
+   * a layer output recently. The successors of neighbouring states in a
+   * sorted layer overlap heavily, so many successors are repeats, and finding
+   * them here is much cheaper than a btree descent (or than appending them to
+   * a sorted buffer, only to remove them later). A miss is always safe: the
+   * state just goes on to the output as usual.
+   *
+   * Each set holds the most recently used state first. A zero (the empty
+   * board, which is never in a layer) marks an empty way. With zero sets,
+   * the filter is disabled.
+   */
+  struct recent_state_filter_t {
+    explicit recent_state_filter_t(size_t num_sets) :
+      shift(64), ways(2 * num_sets, 0), num_lookups(0), num_hits(0)
+    {
+      if (num_sets & (num_sets - 1)) {
+        throw std::invalid_argument("num_sets must be a power of two");
+      }
+      for (size_t n = num_sets; n > 1; n >>= 1) shift -= 1;
+    }
+
+    /**
+     * Whether the state is in the filter; counts the lookup and any hit.
+     */
+    bool contains(uint64_t nybbles) {
+      if (ways.empty()) return false;
+      num_lookups += 1;
+      uint64_t *set = find_set(nybbles);
+      if (set[0] == nybbles) {
+        num_hits += 1;
+        return true;
+      }
+      if (set[1] == nybbles) {
+        std::swap(set[0], set[1]);
+        num_hits += 1;
+        return true;
+      }
+      return false;
+    }
+
+    /**
+     * Add a state, evicting the least recently used state in its set.
+     */
+    void add(uint64_t nybbles) {
+      if (ways.empty()) return;
+      uint64_t *set = find_set(nybbles);
+      set[1] = set[0];
+      set[0] = nybbles;
+    }
+
+    void clear() {
+      std::fill(ways.begin(), ways.end(), 0);
+    }
+
+    size_t get_num_lookups() const { return num_lookups; }
+    size_t get_num_hits() const { return num_hits; }
+
+  private:
+    int shift;
+    std::vector<uint64_t> ways;
+    size_t num_lookups;
+    size_t num_hits;
+
+    uint64_t *find_set(uint64_t nybbles) {
+      // Fibonacci hashing; the low nybbles alone would cluster.
+      size_t set = shift == 64 ? 0 :
+        (nybbles * 0x9E3779B97F4A7C15ULL) >> shift;
+      return &ways[2 * set];
+    }
+  };
+
+  /**
+   * The states that a layer builder has generated for one output part, which
+   * are written out sorted and without duplicates.
+   *
+   * By default, the states are kept in a btree_set, which removes duplicates
+   * as they come in. If `sorted` is set, they are instead appended to a
+   * buffer, which is radix sorted and deduplicated when it is written. That
+   * takes 8 bytes per state, plus the same again while sorting, rather than
+   * the btree's per-node overhead, and each insert is just an append, but
+   * duplicates take space until the buffer is written or compacted.
+   *
+   * Callers can check inserted_recently before doing any expensive work on a
+   * state that they are about to insert; see recent_state_filter_t.
+   */
+  template <int size> struct layer_output_t {
+    typedef btree::btree_set<state_t<size> > state_set_t;
+
+    static const size_t DEFAULT_FILTER_SETS = 1 << 12;
+
+    explicit layer_output_t(bool sorted = false, size_t num_threads = 1,
+      size_t filter_sets = DEFAULT_FILTER_SETS) :
+      sorted(sorted), num_threads(num_threads), compacted_size(0),
+      filter(filter_sets) { }
+
+    /**
+     * Whether the state is certainly in the output already, because it was
+     * inserted recently. If not, it may or may not be.
+     */
+    bool inserted_recently(const state_t<size> &state) {
+      return filter.contains(state.get_nybbles());
+    }
+
+    void insert(const state_t<size> &state) {
+      filter.add(state.get_nybbles());
+      if (sorted) {
+        buffer.push_back(state.get_nybbles());
+      } else {
+        set.insert(state);
+      }
+    }
+
+    /**
+     * The number of states held, including any duplicates in the buffer.
+     */
+    size_t num_states() const {
+      return sorted ? buffer.size() : set.size();
+    }
+
+    /**
+     * The memory used to hold the states, not counting the temporary buffer
+     * needed to sort them.
+     */
+    size_t bytes_used() const {
+      return sorted ? buffer.capacity() * sizeof(uint64_t) : set.bytes_used();
+    }
+
+    /**
+     * Like bytes_used, but in constant time. For a btree, this assumes that
+     * the nodes are three quarters full.
+     */
+    size_t approximate_bytes_used() const {
+      if (sorted) return bytes_used();
+      return set.size() * state_set_t::average_bytes_per_value();
+    }
+
+    /**
+     * Sort the buffer and remove duplicates if it has doubled in size since
+     * that was last done, which bounds the space that duplicates can take.
+     */
+    void compact() {
+      const size_t MIN_COMPACT_SIZE = 1 << 16;
+      if (!sorted) return;
+      if (buffer.size() < std::max(2 * compacted_size, MIN_COMPACT_SIZE)) {
+        return;
+      }
+      radix_sort_unique(buffer, num_threads);
+      compacted_size = buffer.size();
+    }
+
+    /**
+     * Sort the buffer, remove duplicates, and return the states. Only for
+     * sorted outputs.
+     */
+    const std::vector<uint64_t> &sorted_states() {
+      if (!sorted) throw std::logic_error("layer_output_t: not sorted");
+      radix_sort_unique(buffer, num_threads);
+      compacted_size = buffer.size();
+      return buffer;
+    }
+
+    /**
+     * Write the states to a vbyte file, and clear them.
+     */
+    void write(const char *pathname) {
+      vbyte_writer_t vbyte_writer(pathname);
+      if (sorted) {
+        sorted_states();
+        for (size_t i = 0; i < buffer.size(); ++i) {
+          vbyte_writer.write(buffer[i]);
+        }
+      } else {
+        for (typename state_set_t::const_iterator it = set.begin();
+          it != set.end(); ++it) {
+          vbyte_writer.write(it->get_nybbles());
+        }
+      }
+      clear();
+    }
+
+    void clear() {
+      std::vector<uint64_t>().swap(buffer);
+      compacted_size = 0;
+      set.clear();
+      filter.clear();
+    }
+
+    const recent_state_filter_t &get_filter() const { return filter; }
+
+  private:
+    bool sorted;
+    size_t num_threads;
+    std::vector<uint64_t> buffer;
+    size_t compacted_size;
+    state_set_t set;
+    recent_state_filter_t filter;
+  };
+
+  /**
+   * Merge several sorted outputs, for example from different threads, into
+   * one vbyte file without duplicates, and clear them. Returns the number of
+   * states written.
+   */
+  template <int size>
+  size_t write_merged(const std::vector<layer_output_t<size> *> &outputs,
+    const char *pathname)
+  {
+    const uint64_t END_KEY = std::numeric_limits<uint64_t>::max();
+
+    std::vector<const std::vector<uint64_t> *> inputs;
+    std::vector<size_t> positions(outputs.size(), 0);
+    std::vector<uint64_t> keys;
+    for (size_t i = 0; i < outputs.size(); ++i) {
+      inputs.push_back(&outputs[i]->sorted_states());
+      keys.push_back(inputs[i]->empty() ? END_KEY : (*inputs[i])[0]);
+    }
+    loser_tree_t<uint64_t> tree(keys);
+
+    vbyte_writer_t vbyte_writer(pathname);
+    size_t num_states = 0;
+    uint64_t previous = 0;
+    while (!tree.empty() && tree.winner_key() != END_KEY) {
+      uint64_t key = tree.winner_key();
+      if (key != previous) {
+        vbyte_writer.write(key);
+        previous = key;
+        num_states += 1;
+      }
+
+      size_t i = tree.winner();
+      tree.replace_winner(++positions[i] < inputs[i]->size() ?
+        (*inputs[i])[positions[i]] : END_KEY);
+    }
+
+    for (size_t i = 0; i < outputs.size(); ++i) outputs[i]->clear();
+    return num_states;
+  }
+}
+
+#define TWENTY48_LAYER_OUTPUT_HPP
+#endif
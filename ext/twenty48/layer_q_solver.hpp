@@ -109,7 +109,7 @@ namespace twenty48 {
     }
 
   private:
-    typedef typename state_t<size>::transitions_t transitions_t;
+    typedef typename state_t<size>::transition_array_t transitions_t;
 
     struct q_values_t {
       double values[4];
@@ -134,7 +134,8 @@ namespace twenty48 {
       }
 
       bool changed = false;
-      transitions_t transitions = move_state.random_transitions();
+      transitions_t transitions;
+      move_state.random_transitions(transitions);
       for (typename transitions_t::const_iterator it = transitions.begin();
         it != transitions.end(); ++it)
       {
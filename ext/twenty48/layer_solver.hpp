@@ -8,6 +8,7 @@
 #include "mmap_value_reader.hpp"
 #include "solution_writer.hpp"
 #include "state.hpp"
+#include "state_batch.hpp"
 #include "valuer.hpp"
 #include "vbyte_reader.hpp"
 
@@ -127,18 +128,24 @@ namespace twenty48 {
       int sum, uint8_t max_value,
       twenty48::solution_writer_t &solution_writer)
     {
-      for (;;) {
-        uint64_t nybbles = vbyte_reader.read();
-        if (nybbles == 0) break;
-        state_t<size> state(nybbles);
-
-        double action_value[4];
-        for (size_t i = 0; i < 4; ++i) {
-          action_value[i] = backup_state_action(
-            state, sum, max_value, (direction_t)i);
+      state_block_t<size> block;
+      while (block.read(vbyte_reader) > 0) {
+        block.move_all();
+        for (size_t j = 0; j < block.get_length(); ++j) {
+          double action_value[4];
+          for (size_t i = 0; i < 4; ++i) {
+            direction_t direction = (direction_t)i;
+            if (block.moved(j, direction)) {
+              action_value[i] = backup_state_action(
+                block.get_moved_state(j, direction), sum, max_value);
+            } else {
+              // Cannot move in this direction.
+              action_value[i] = -std::numeric_limits<double>::infinity();
+            }
+          }
+
+          solution_writer.choose(block.get_nybbles(j), action_value);
         }
-
-        solution_writer.choose(nybbles, action_value);
       }
 
       solution_writer.flush();
@@ -146,7 +153,7 @@ namespace twenty48 {
 
   private:
     typedef double value_t;
-    typedef typename state_t<size>::transitions_t transitions_t;
+    typedef typename state_t<size>::transition_array_t transitions_t;
 
     valuer_t<size> valuer;
     int sum;
@@ -154,16 +161,11 @@ namespace twenty48 {
 
     std::unique_ptr<mmap_value_reader_t> value_readers[2][2];
 
-    double backup_state_action(const state_t<size> &state,
-      int sum, uint8_t max_value, direction_t direction) {
-      state_t<size> moved_state = state.move(direction);
-      if (moved_state == state) {
-        // Cannot move in this direction.
-        return -std::numeric_limits<double>::infinity();
-      }
-
+    double backup_state_action(const state_t<size> &moved_state,
+      int sum, uint8_t max_value) {
       double state_action_value = 0;
-      transitions_t transitions = moved_state.random_transitions();
+      transitions_t transitions;
+      moved_state.random_transitions(transitions);
       for (typename transitions_t::const_iterator it = transitions.begin();
         it != transitions.end(); ++it)
       {
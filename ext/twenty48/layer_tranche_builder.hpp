@@ -74,7 +74,8 @@ namespace twenty48 {
           for (size_t i = 0; i < 4; ++i) {
             if (!alternate_actions[i]) continue;
             state_t<size> move_state = state.move((direction_t)i);
-            transitions_t transitions = move_state.random_transitions();
+            transitions_t transitions;
+            move_state.random_transitions(transitions);
             for (typename transitions_t::const_iterator it =
               transitions.begin(); it != transitions.end(); ++it)
             {
@@ -83,7 +84,8 @@ namespace twenty48 {
           }
         } else {
           state_t<size> move_state = state.move(direction);
-          transitions_t transitions = move_state.random_transitions();
+          transitions_t transitions;
+          move_state.random_transitions(transitions);
           for (typename transitions_t::const_iterator it = transitions.begin();
             it != transitions.end(); ++it)
           {
@@ -114,7 +116,7 @@ namespace twenty48 {
 
   private:
     typedef btree::btree_map<state_t<size>, double> state_probability_map_t;
-    typedef typename state_t<size>::transitions_t transitions_t;
+    typedef typename state_t<size>::transition_array_t transitions_t;
 
     typedef std::pair<uint64_t, double> state_pr_t;
 
@@ -59,16 +59,13 @@ template <int size> class line_t {
    * get the `value + 1` tile.
    */
   bool has_adjacent_pair(uint8_t value) const {
-    bool found_first = false;
+    if (value == 0) return false;
+    uint8_t previous_value = 0;
     for (size_t i = 0; i < size; ++i) {
       uint8_t cell_value = (*this)[i];
-      if (found_first) {
-        if (cell_value == 0) continue;
-        return cell_value == value;
-      }
-      if (cell_value == value) {
-        found_first = true;
-      }
+      if (cell_value == 0) continue;
+      if (cell_value == value && previous_value == value) return true;
+      previous_value = cell_value;
     }
     return false;
   }
@@ -87,36 +84,96 @@ template <int size> class line_t {
     return result;
   }
 
+  /**
+   * Reverse the order of the cells in the line.
+   */
+  line_t<size> reverse() const {
+    uint16_t result = 0;
+    for (size_t i = 0; i < size; ++i) {
+      result = set_nybble(result, size - i - 1, (*this)[i]);
+    }
+    return line_t(result);
+  }
+
   #ifndef SWIG
   /**
-   * Precompute all possible moves. It only takes about 1MiB, even for the
-   * 4x4 board. This actually computes moves with tiles up to 2^15.
+   * Metadata about a line, so that state_t can compute things like the sum
+   * of its tiles with one table lookup per row instead of one step per cell.
+   */
+  struct info_t {
+    // Sum of the tile values (not their exponents) in the line.
+    uint32_t sum;
+    // Bit v is set iff has_adjacent_pair(v).
+    uint16_t adjacent_pairs;
+    uint8_t max_value;
+  };
+
+  /**
+   * Precompute all possible moves, both towards the start of the line (left)
+   * and towards the end (right), and the metadata for each line. It takes
+   * about 768KiB for the 4x4 board. This actually computes moves with tiles
+   * up to 2^15.
+   *
+   * The table is built once when the program starts, rather than on first
+   * use, so that looking it up does not need a guard in the inner loops.
+   *
+   * The vectorized moves in state_batch_t gather eight bytes from each
+   * two-byte entry, so they read up to six bytes past the last entry of
+   * `table` and `reverse_table`. Each is padded with spare entries so that
+   * those reads stay within it, whatever the order of the fields.
    */
   struct table_t {
     const static size_t TABLE_SIZE = UINT16_MAX >> 4 * (4 - size);
+    const static size_t TABLE_PADDING = 3;
 
-    uint16_t table[TABLE_SIZE + 1];
+    uint16_t table[TABLE_SIZE + 1 + TABLE_PADDING];
+    uint16_t reverse_table[TABLE_SIZE + 1 + TABLE_PADDING];
+    info_t info[TABLE_SIZE + 1];
+
+    static_assert(sizeof(table) >=
+      TABLE_SIZE * sizeof(uint16_t) + sizeof(uint64_t),
+      "a gather of the last table entry must not read past the table");
+    static_assert(sizeof(reverse_table) >=
+      TABLE_SIZE * sizeof(uint16_t) + sizeof(uint64_t),
+      "a gather of the last reverse_table entry must not read past it");
 
     table_t() {
       for (uint32_t nybbles = 0; nybbles <= TABLE_SIZE; ++nybbles) {
-        table[nybbles] = line_t(nybbles).move().get_nybbles();
+        line_t line(nybbles);
+        table[nybbles] = line.move().get_nybbles();
+        reverse_table[nybbles] =
+          line.reverse().move().reverse().get_nybbles();
+        info[nybbles] = line.info();
       }
     }
   };
+
+  static const table_t TABLE;
+
+  static const info_t &lookup_info(uint16_t nybbles) {
+    return TABLE.info[nybbles];
+  }
   #endif
 
   /**
    * Look up the result of moving the given line.
    */
   static uint16_t lookup_move(uint16_t nybbles) {
-    static table_t table;
-    return table.table[nybbles];
+    return TABLE.table[nybbles];
   };
 
   static uint16_t lookup_move(const line_t<size> &line) {
     return lookup_move(line.get_nybbles());
   };
 
+  /**
+   * Look up the result of moving the given line in the reverse direction,
+   * that is towards the end of the line.
+   */
+  static uint16_t lookup_reverse_move(uint16_t nybbles) {
+    return TABLE.reverse_table[nybbles];
+  };
+
   static uint8_t get_nybble(uint16_t nybbles, size_t i) {
     return twenty48::get_nybble(nybbles, i, size);
   }
@@ -129,8 +186,32 @@ private:
   void set_nybble(size_t i, uint8_t value) {
     nybbles = set_nybble(nybbles, i, value);
   }
+
+  #ifndef SWIG
+  info_t info() const {
+    info_t result;
+    result.sum = 0;
+    result.max_value = 0;
+    for (size_t i = 0; i < size; ++i) {
+      uint8_t value = (*this)[i];
+      if (value != 0) result.sum += 1 << value;
+      if (value > result.max_value) result.max_value = value;
+    }
+
+    result.adjacent_pairs = 0;
+    for (size_t value = 1; value <= 0xF; ++value) {
+      if (has_adjacent_pair(value)) result.adjacent_pairs |= 1 << value;
+    }
+    return result;
+  }
+  #endif
 };
 
+#ifndef SWIG
+template <int size>
+const typename line_t<size>::table_t line_t<size>::TABLE;
+#endif
+
 template <int size>
 std::ostream &operator << (std::ostream &os, const line_t<size> &line) {
   for (size_t i = 0; i < size; ++i) {
@@ -0,0 +1,68 @@
+#ifndef TWENTY48_LOSER_TREE_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include "twenty48.hpp"
+
+namespace twenty48 {
+  /**
+   * A tournament tree of losers, for merging k sorted inputs. Each input has
+   * a current key, and the winner is the input with the smallest key. When
+   * the caller takes the winner's key and gives it a new one, only the path
+   * from that input's leaf to the root has to be replayed, which is one
+   * comparison per level against the loser stored there, rather than the two
+   * per level that a binary heap needs to sift down.
+   *
+   * The leaves are numbered k..2k-1 and the internal nodes 1..k-1, as in a
+   * binary heap, so any k works. Node 0 holds the overall winner. An input
+   * that has run out should be given a key that is larger than any real key.
+   */
+  template <typename Key> struct loser_tree_t {
+    explicit loser_tree_t(const std::vector<Key> &initial_keys) :
+      keys(initial_keys), nodes(std::max(initial_keys.size(), (size_t)1), 0)
+    {
+      size_t k = keys.size();
+      if (k == 0) return;
+
+      // Play the initial tournament bottom up, keeping the winner of each
+      // match in a scratch array and the loser in the node.
+      std::vector<size_t> winners(2 * k);
+      for (size_t i = 0; i < k; ++i) winners[k + i] = i;
+      for (size_t node = k - 1; node > 0; --node) {
+        size_t left = winners[2 * node];
+        size_t right = winners[2 * node + 1];
+        if (keys[right] < keys[left]) std::swap(left, right);
+        winners[node] = left;
+        nodes[node] = right;
+      }
+      nodes[0] = k == 1 ? 0 : winners[1];
+    }
+
+    bool empty() const { return keys.empty(); }
+
+    size_t winner() const { return nodes[0]; }
+
+    const Key &winner_key() const { return keys[nodes[0]]; }
+
+    /**
+     * Give the winner a new key, which must not be smaller than its old one,
+     * and find the new winner.
+     */
+    void replace_winner(const Key &key) {
+      size_t input = nodes[0];
+      keys[input] = key;
+      for (size_t node = (input + keys.size()) >> 1; node > 0; node >>= 1) {
+        if (keys[nodes[node]] < keys[input]) std::swap(nodes[node], input);
+      }
+      nodes[0] = input;
+    }
+
+  private:
+    std::vector<Key> keys;
+    std::vector<size_t> nodes;
+  };
+}
+
+#define TWENTY48_LOSER_TREE_HPP
+#endif
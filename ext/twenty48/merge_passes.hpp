@@ -0,0 +1,140 @@
+#ifndef TWENTY48_MERGE_PASSES_HPP
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <string>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <vector>
+
+#include "twenty48.hpp"
+
+namespace twenty48 {
+  /**
+   * The number of files that a merge can have open at once by default: the
+   * soft limit on file descriptors, less some for other uses.
+   */
+  inline size_t default_max_merge_files() {
+    const size_t SPARE_FILES = 64;
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0) return 256 - SPARE_FILES;
+    if (limit.rlim_cur == RLIM_INFINITY) return 1 << 20;
+    if (limit.rlim_cur < SPARE_FILES + 3) return 3;
+    return limit.rlim_cur - SPARE_FILES;
+  }
+
+  /**
+   * Intermediate passes for a merge that has more input files than it can
+   * open at once. While there are too many, the smallest inputs are merged
+   * into a temporary file next to the output, as in a k-ary Huffman code, so
+   * the big inputs are read only once. The first pass may be short, so that
+   * the last pass, which the caller runs, is full.
+   *
+   * The temporary files are removed as they are merged, and the rest when
+   * this object goes away, so it must outlive the final merge.
+   */
+  struct merge_passes_t {
+    /**
+     * Plan and run the passes. The final merge and each pass may have
+     * `max_files` files open: its inputs and its output. If zero, use
+     * default_max_merge_files. The `merge` function takes a list of input
+     * pathnames and an output pathname.
+     */
+    template <typename Merge>
+    merge_passes_t(const std::vector<std::string> &input_pathnames,
+      const std::string &output_pathname, size_t max_files, Merge merge) :
+      pathnames(input_pathnames), num_passes(0)
+    {
+      if (max_files == 0) max_files = default_max_merge_files();
+      size_t fan_in = std::max(max_files, (size_t)3) - 1;
+      if (pathnames.size() <= fan_in) return;
+
+      typedef std::pair<size_t, std::string> input_t;
+      typedef std::priority_queue<input_t, std::vector<input_t>,
+        std::greater<input_t> > input_queue_t;
+
+      try {
+        input_queue_t inputs;
+        for (size_t i = 0; i < pathnames.size(); ++i) {
+          inputs.push(input_t(file_size(pathnames[i]), pathnames[i]));
+        }
+
+        size_t pass_size = (inputs.size() - fan_in) % (fan_in - 1) + 1;
+        if (pass_size == 1) pass_size = fan_in;
+        while (inputs.size() > fan_in) {
+          std::vector<std::string> pass_pathnames;
+          for (size_t i = 0; i < pass_size; ++i) {
+            pass_pathnames.push_back(inputs.top().second);
+            inputs.pop();
+          }
+
+          std::string pass_pathname =
+            output_pathname + ".pass-" + std::to_string(num_passes++);
+          temporary_pathnames.push_back(pass_pathname);
+          merge(pass_pathnames, pass_pathname.c_str());
+          for (size_t i = 0; i < pass_pathnames.size(); ++i) {
+            remove_temporary(pass_pathnames[i]);
+          }
+
+          inputs.push(input_t(file_size(pass_pathname), pass_pathname));
+          pass_size = fan_in;
+        }
+
+        pathnames.clear();
+        for (; !inputs.empty(); inputs.pop()) {
+          pathnames.push_back(inputs.top().second);
+        }
+      } catch (...) {
+        remove_temporaries();
+        throw;
+      }
+    }
+
+    merge_passes_t(const merge_passes_t &) = delete;
+    merge_passes_t &operator=(const merge_passes_t &) = delete;
+
+    ~merge_passes_t() {
+      remove_temporaries();
+    }
+
+    /**
+     * The inputs for the final merge.
+     */
+    const std::vector<std::string> &get_pathnames() const {
+      return pathnames;
+    }
+
+    size_t get_num_passes() const { return num_passes; }
+
+  private:
+    std::vector<std::string> pathnames;
+    std::vector<std::string> temporary_pathnames;
+    size_t num_passes;
+
+    static size_t file_size(const std::string &pathname) {
+      struct stat stat_buf;
+      if (stat(pathname.c_str(), &stat_buf) != 0) return 0;
+      return stat_buf.st_size;
+    }
+
+    void remove_temporary(const std::string &pathname) {
+      std::vector<std::string>::iterator it = std::find(
+        temporary_pathnames.begin(), temporary_pathnames.end(), pathname);
+      if (it == temporary_pathnames.end()) return;
+      std::remove(pathname.c_str());
+      temporary_pathnames.erase(it);
+    }
+
+    void remove_temporaries() {
+      for (size_t i = 0; i < temporary_pathnames.size(); ++i) {
+        std::remove(temporary_pathnames[i].c_str());
+      }
+      temporary_pathnames.clear();
+    }
+  };
+}
+
+#define TWENTY48_MERGE_PASSES_HPP
+#endif
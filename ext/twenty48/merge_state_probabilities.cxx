@@ -1,109 +1,160 @@
 #include "merge_state_probabilities.hpp"
 
-#include <queue>
-
-#include "binary_reader.hpp"
-#include "binary_writer.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+
+#include "layer_files.hpp"
+#include "loser_tree.hpp"
+#include "merge_passes.hpp"
 #include "state_value.hpp"
 
 namespace twenty48 {
 
-typedef binary_reader_t<state_value_t> state_value_reader_t;
-typedef binary_writer_t<state_value_t> state_value_writer_t;
-
 //
-// A wrapper for a state_value_reader_t that remembers the last state that we
-// read. We need to remember the state so we can put it into the appropriate
-// place in the priority queue.
+// An input to the merge: a file of (state, value) records, which we map into
+// memory and walk through in place.
 //
-struct state_pr_head_t {
-  state_pr_head_t(const char *input_pathname) : reader(input_pathname) {
-    head.state = 0;
-    head.value = 0.0;
+struct state_pr_input_t {
+  explicit state_pr_input_t(const char *pathname) : file(pathname) {
+    file.advise_sequential();
+    next = static_cast<const state_value_t *>(file.get_data());
+    end = next + file.get_byte_size() / sizeof(state_value_t);
   }
 
-  const state_value_t &peek() const {
-    return head;
+  /**
+   * The next record, or NULL at the end of the input.
+   */
+  const state_value_t *read() {
+    return next == end ? NULL : next++;
   }
 
-  bool done() const {
-    return reader.done();
+private:
+  mmapped_layer_file_t file;
+  const state_value_t *next;
+  const state_value_t *end;
+};
+
+//
+// Write records through a large buffer, rather than one at a time through a
+// stream.
+//
+struct state_pr_output_t {
+  explicit state_pr_output_t(const char *pathname) :
+    fd(open(pathname, O_WRONLY | O_CREAT | O_TRUNC, 0666)), size(0)
+  {
+    if (fd == -1) {
+      throw std::runtime_error(
+        std::string("merge_state_probabilities: failed to create ") +
+        pathname);
+    }
+    buffer.resize(BUFFER_SIZE);
   }
 
-  void read() {
-    head = reader.read();
+  ~state_pr_output_t() {
+    if (fd != -1) ::close(fd);
   }
 
-private:
-  state_value_reader_t reader;
-  state_value_t head;
-};
+  void write(const state_value_t &state_value) {
+    buffer[size++] = state_value;
+    if (size == BUFFER_SIZE) flush();
+  }
 
-typedef state_pr_head_t *state_pr_head_ptr;
+  void close() {
+    flush();
+    int rc = ::close(fd);
+    fd = -1;
+    if (rc != 0) {
+      throw std::runtime_error("merge_state_probabilities: close failed");
+    }
+  }
 
-struct state_pr_head_compare_t {
-  bool operator()(const state_pr_head_ptr &lhs, const state_pr_head_ptr &rhs) const {
-    return lhs->peek().state > rhs->peek().state;
+private:
+  static const size_t BUFFER_SIZE = 1 << 16;
+
+  int fd;
+  std::vector<state_value_t> buffer;
+  size_t size;
+
+  void flush() {
+    const char *data = reinterpret_cast<const char *>(buffer.data());
+    size_t length = size * sizeof(state_value_t);
+    while (length > 0) {
+      ssize_t bytes_written = ::write(fd, data, length);
+      if (bytes_written < 0) {
+        if (errno == EINTR) continue;
+        std::ostringstream oss;
+        oss << "merge_state_probabilities: write failed: " << errno << " " <<
+          strerror(errno);
+        throw std::runtime_error(oss.str());
+      }
+      data += bytes_written;
+      length -= bytes_written;
+    }
+    size = 0;
   }
 };
 
-typedef std::priority_queue<
-  state_pr_head_ptr, std::vector<state_pr_head_ptr>, state_pr_head_compare_t>
-  state_pr_head_queue_t;
-
-size_t merge_state_probabilities(
+static size_t merge_files(
   const std::vector<std::string> &input_pathnames,
   const char *output_pathname)
 {
+  // An input that has run out gets a key that sorts after all states.
+  const uint64_t END_KEY = std::numeric_limits<uint64_t>::max();
+
+  std::vector<std::unique_ptr<state_pr_input_t> > inputs;
+  std::vector<const state_value_t *> heads;
+  std::vector<uint64_t> keys;
+  for (size_t i = 0; i < input_pathnames.size(); ++i) {
+    inputs.emplace_back(new state_pr_input_t(input_pathnames[i].c_str()));
+    heads.push_back(inputs.back()->read());
+    keys.push_back(heads.back() ? heads.back()->state : END_KEY);
+  }
+
   size_t num_states = 0;
   state_value_t state_value;
   state_value.state = 0;
   state_value.value = 0.0;
 
-  state_value_writer_t writer(output_pathname);
-
-  // Open input files.
-  // Invariant: the inputs queue contains only heads for which the state is
-  // non-zero; a zero state indicates end of file, so this means that we are
-  // removing heads that reach end of file.
-  state_pr_head_queue_t inputs;
-  for (typename std::vector<std::string>::const_iterator it =
-    input_pathnames.begin(); it != input_pathnames.end(); ++it) {
-    state_pr_head_ptr head = new state_pr_head_t(it->c_str());
-    if (head->done()) {
-      delete head;
-    } else {
-      head->read();
-      inputs.push(head);
-    }
-  }
-
-  while (inputs.size() > 0) {
-    state_pr_head_ptr top = inputs.top();
-    inputs.pop();
+  state_pr_output_t output(output_pathname);
+  loser_tree_t<uint64_t> tree(keys);
+  while (!tree.empty() && tree.winner_key() != END_KEY) {
+    size_t winner = tree.winner();
+    const state_value_t *head = heads[winner];
 
-    if (top->peek().state == state_value.state) {
-      // If we pop the same state off multiple streams; add the probabilities.
-      state_value.value += top->peek().value;
+    if (head->state == state_value.state) {
+      // If we see the same state in multiple inputs, add the probabilities.
+      state_value.value += head->value;
     } else {
-      // We're done with this state; write it and read the next.
-      if (state_value.state != 0) writer.write(state_value);
+      // We're done with this state; write it and start the next.
+      if (state_value.state != 0) output.write(state_value);
       num_states += 1;
 
-      state_value = top->peek();
+      state_value = *head;
     }
 
-    if (top->done()) {
-      delete top;
-    } else {
-      top->read();
-      inputs.push(top);
-    }
+    heads[winner] = inputs[winner]->read();
+    tree.replace_winner(heads[winner] ? heads[winner]->state : END_KEY);
   }
 
-  if (state_value.state != 0) writer.write(state_value);
+  if (state_value.state != 0) output.write(state_value);
+  output.close();
 
   return num_states;
 }
 
+size_t merge_state_probabilities(
+  const std::vector<std::string> &input_pathnames,
+  const char *output_pathname, size_t max_files)
+{
+  merge_passes_t passes(input_pathnames, output_pathname, max_files,
+    merge_files);
+  return merge_files(passes.get_pathnames(), output_pathname);
+}
+
 }
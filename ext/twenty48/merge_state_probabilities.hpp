@@ -5,9 +5,16 @@
 
 namespace twenty48 {
 
+/**
+ * Merge sorted files of states and probabilities into one, adding up the
+ * probabilities for each state. Returns the number of states written.
+ *
+ * At most `max_files` files are open at once (by default, as many as the
+ * file descriptor limit allows); see merge_passes_t.
+ */
 size_t merge_state_probabilities(
   const std::vector<std::string> &input_pathnames,
-  const char *output_pathname);
+  const char *output_pathname, size_t max_files = 0);
 
 }
 
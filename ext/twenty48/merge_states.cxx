@@ -1,100 +1,513 @@
 #include "merge_states.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
 #include <limits>
-#include <queue>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
 
+#include "layer_files.hpp"
+#include "loser_tree.hpp"
+#include "merge_passes.hpp"
+#include "threads.hpp"
+#include "vbyte.h"
 #include "vbyte_reader.hpp"
 #include "vbyte_writer.hpp"
 
 namespace twenty48 {
 
 //
-// A wrapper for a vbyte_reader_t that just remembers the last value that we
-// read. We need to remember the value so we can put it into the appropriate
-// place in the priority queue.
+// An input to the merge: either a vbyte file, which a vbyte reader decodes a
+// block at a time, or a sorted run in memory. Inputs are held by value in
+// the merge's input vector, so they can be moved but not copied.
 //
-struct head_t {
-  head_t(const char *input_pathname) : reader(input_pathname) { read(); }
-
-  uint64_t peek() const {
-    return value;
+struct merge_input_t {
+  /**
+   * Read a vbyte file from the start, or from part way through, at an index
+   * entry.
+   */
+  explicit merge_input_t(const char *pathname,
+    const vbyte_index_entry_t &start = vbyte_index_entry_t()) :
+    reader(new vbyte_reader_t(pathname, start.byte_offset, start.previous,
+      std::numeric_limits<size_t>::max(), BUFFER_SIZE)),
+    next(NULL), end(NULL)
+  {
+    if (!reader->is_open()) {
+      throw std::invalid_argument(
+        std::string("merge_states: failed to open ") + pathname);
+    }
   }
 
-  void read() {
-    value = reader.read();
+  explicit merge_input_t(const std::vector<uint64_t> *run) :
+    next(run->data()), end(run->data() + run->size()) { }
+
+  merge_input_t(merge_input_t &&other) = default;
+
+  /**
+   * The next value, or zero at the end of the input.
+   */
+  uint64_t read() {
+    if (reader) return reader->read();
+    return next == end ? 0 : *next++;
   }
 
 private:
-  vbyte_reader_t reader;
-  uint64_t value;
+  // There may be thousands of inputs, so each gets a modest buffer.
+  static const size_t BUFFER_SIZE = 1 << 16;
+
+  std::unique_ptr<vbyte_reader_t> reader;
+  const uint64_t *next;
+  const uint64_t *end;
 };
 
-typedef head_t *head_ptr;
+// An input that has run out gets a key that sorts after all states. A board
+// full of 32768 tiles would also have this key, but it is never in a layer.
+static const uint64_t END_KEY = std::numeric_limits<uint64_t>::max();
+
+//
+// The next key from an input, or END_KEY if it has run out or reached the
+// end of the key range.
+//
+static uint64_t read_key(merge_input_t &input, uint64_t upper) {
+  uint64_t key = input.read();
+  return key == 0 || key >= upper ? END_KEY : key;
+}
 
-struct head_compare_t {
-  bool operator()(const head_ptr &lhs, const head_ptr &rhs) const {
-    return lhs->peek() > rhs->peek();
+//
+// Merge the keys in [lower, upper) from the inputs and call `emit` on each
+// distinct key in order.
+//
+template <typename Emit>
+static void merge_inputs(std::vector<merge_input_t> &inputs, uint64_t lower,
+  uint64_t upper, Emit emit)
+{
+  std::vector<uint64_t> keys(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    do {
+      keys[i] = read_key(inputs[i], upper);
+    } while (keys[i] < lower);
   }
+
+  uint64_t value = 0;
+  loser_tree_t<uint64_t> tree(keys);
+  while (!tree.empty() && tree.winner_key() != END_KEY) {
+    uint64_t key = tree.winner_key();
+
+    // We may see the same state in multiple inputs; only write it once.
+    if (key != value) {
+      value = key;
+      emit(value);
+    }
+
+    tree.replace_winner(read_key(inputs[tree.winner()], upper));
+  }
+}
+
+//
+// Decode up to `length` values, stopping at the end of the data. The 64-bit
+// decoder reads one byte at a time, so it does not overrun the data if we
+// ask it for no more values than there can be.
+//
+static size_t decode_values(const uint8_t *data, size_t byte_size,
+  size_t &byte_offset, uint64_t &previous, uint64_t *values, size_t length)
+{
+  const size_t MAX_VALUE_BYTES = 10;
+  size_t count = 0;
+  while (count < length && byte_offset < byte_size) {
+    size_t n = std::min(length - count,
+      std::max((byte_size - byte_offset) / MAX_VALUE_BYTES, (size_t)1));
+    byte_offset += vbyte_uncompress_sorted64(data + byte_offset,
+      values + count, previous, n);
+    previous = values[count + n - 1];
+    count += n;
+  }
+  return count;
+}
+
+//
+// Where a merge of a key range can start reading each input file. Every so
+// many states, we note the byte offset and value, so a range merge can start
+// at the last sample below the range. Each sample stands for `weight`
+// states, which we use to choose the ranges.
+//
+struct merge_samples_t {
+  merge_samples_t() : weight(0), min_key(END_KEY), max_key(0) { }
+
+  explicit merge_samples_t(const std::string &pathname) : merge_samples_t() {
+    mmapped_layer_file_t file(pathname.c_str());
+    const uint8_t *data = static_cast<const uint8_t *>(file.get_data());
+    size_t byte_size = file.get_byte_size();
+
+    // Aim for a few thousand samples per file, assuming about two bytes per
+    // state; more would just cost memory.
+    const size_t MIN_WEIGHT = 64;
+    weight = std::max(MIN_WEIGHT, byte_size >> 13);
+
+    const size_t BLOCK_SIZE = 1024;
+    uint64_t values[BLOCK_SIZE];
+    size_t byte_offset = 0;
+    uint64_t previous = 0;
+    size_t count = 0;
+    for (;;) {
+      size_t n = decode_values(data, byte_size, byte_offset, previous,
+        values, std::min(weight - count, BLOCK_SIZE));
+      if (n == 0) break;
+      if (min_key == END_KEY) min_key = values[0];
+      max_key = previous;
+      count += n;
+      if (count == weight) {
+        samples.push_back(vbyte_index_entry_t(byte_offset, previous));
+        count = 0;
+      }
+    }
+  }
+
+  /**
+   * The last sample before `key`, or the start of the file.
+   */
+  vbyte_index_entry_t start(uint64_t key) const {
+    auto it = std::lower_bound(samples.begin(), samples.end(), key,
+      [](const vbyte_index_entry_t &entry, uint64_t k) {
+        return entry.previous < k;
+      });
+    if (it == samples.begin()) return vbyte_index_entry_t();
+    return *--it;
+  }
+
+  size_t weight;
+  uint64_t min_key;
+  uint64_t max_key;
+  vbyte_index_t samples;
 };
 
-typedef std::priority_queue<
-  head_ptr, std::vector<head_ptr>, head_compare_t> head_queue_t;
+//
+// One key range of a parallel merge, which is merged into its own file with
+// its own delta encoding.
+//
+struct merge_range_t {
+  merge_range_t(uint64_t lower, uint64_t upper, const std::string &pathname) :
+    lower(lower), upper(upper), pathname(pathname), num_states(0),
+    first(0), last(0), byte_size(0) { }
 
-size_t merge_states(const std::vector<std::string> &input_pathnames,
-  const char *output_pathname, size_t index_stride,
-  twenty48::vbyte_index_t &vbyte_index)
+  uint64_t lower;
+  uint64_t upper;
+  std::string pathname;
+  size_t num_states;
+  uint64_t first;
+  uint64_t last;
+  size_t byte_size;
+  vbyte_index_t index;
+};
+
+//
+// Choose about `num_ranges` ranges that hold similar numbers of states.
+//
+static std::vector<uint64_t> choose_splitters(
+  const std::vector<merge_samples_t> &samples, size_t num_ranges)
 {
-  size_t num_states = 0;
-  uint64_t value = 0;
+  std::vector<std::pair<uint64_t, size_t> > keys;
+  size_t total_weight = 0;
+  for (size_t i = 0; i < samples.size(); ++i) {
+    for (size_t j = 0; j < samples[i].samples.size(); ++j) {
+      keys.push_back(std::make_pair(samples[i].samples[j].previous,
+        samples[i].weight));
+    }
+    total_weight += samples[i].weight * samples[i].samples.size();
+  }
+  std::sort(keys.begin(), keys.end());
 
-  vbyte_writer_t vbyte_writer(output_pathname);
+  std::vector<uint64_t> splitters;
+  size_t weight = 0;
+  size_t range = 1;
+  for (size_t i = 0; i < keys.size() && range < num_ranges; ++i) {
+    weight += keys[i].second;
+    if (weight * num_ranges < range * total_weight) continue;
+    if (splitters.empty() || splitters.back() < keys[i].first) {
+      splitters.push_back(keys[i].first);
+    }
+    range += 1;
+  }
+  return splitters;
+}
+
+//
+// Merge one key range of the inputs into the range's file, skipping inputs
+// that have no keys in the range.
+//
+static void merge_range(const std::vector<std::string> &input_pathnames,
+  const std::vector<merge_samples_t> &samples, merge_range_t &range)
+{
+  std::vector<merge_input_t> inputs;
+  for (size_t i = 0; i < input_pathnames.size(); ++i) {
+    if (samples[i].max_key < range.lower) continue;
+    if (samples[i].min_key >= range.upper) continue;
+    inputs.emplace_back(input_pathnames[i].c_str(),
+      samples[i].start(range.lower));
+  }
+
+  vbyte_writer_t vbyte_writer(range.pathname.c_str());
+  merge_inputs(inputs, range.lower, range.upper, [&](uint64_t value) {
+    if (range.num_states == 0) range.first = value;
+    range.last = value;
+    range.num_states += 1;
+    vbyte_writer.write(value);
+  });
+  vbyte_writer.close();
+  range.byte_size = vbyte_writer.get_bytes_written();
+}
 
-  // Open input files.
-  // Invariant: the inputs queue contains only heads for which the value is
-  // non-zero; a zero value indicates end of file, so this means that we are
-  // removing heads that reach end of file.
-  head_queue_t inputs;
-  for (typename std::vector<std::string>::const_iterator it =
-    input_pathnames.begin(); it != input_pathnames.end(); ++it) {
-    head_ptr head = new head_t(it->c_str());
-    if (head->peek() > 0) {
-      inputs.push(head);
-    } else {
-      delete head;
+static void pwrite_all(int fd, const uint8_t *data, size_t length,
+  size_t offset)
+{
+  while (length > 0) {
+    ssize_t bytes_written = pwrite(fd, data, length, offset);
+    if (bytes_written < 0) {
+      if (errno == EINTR) continue;
+      std::ostringstream oss;
+      oss << "merge_states: write failed: " << errno << " " <<
+        strerror(errno);
+      throw std::runtime_error(oss.str());
+    }
+    data += bytes_written;
+    length -= bytes_written;
+    offset += bytes_written;
+  }
+}
+
+//
+// Copy a range's file into the output at `byte_offset`, where it follows
+// `previous`, and find its index entries. The range's states start after the
+// first `state_offset` states of the output.
+//
+static void copy_range(int fd, merge_range_t &range, size_t state_offset,
+  size_t byte_offset, uint64_t previous, size_t index_stride)
+{
+  // The first state was encoded as a delta from zero; rebase it.
+  uint8_t first_bytes[16];
+  size_t local_first_size = vbyte_append_sorted64(first_bytes, 0, range.first);
+  size_t first_size = vbyte_append_sorted64(first_bytes, previous,
+    range.first);
+
+  mmapped_layer_file_t file(range.pathname.c_str());
+  const uint8_t *data = static_cast<const uint8_t *>(file.get_data());
+  pwrite_all(fd, first_bytes, first_size, byte_offset);
+  pwrite_all(fd, data + local_first_size, range.byte_size - local_first_size,
+    byte_offset + first_size);
+
+  // Index the states that fall on multiples of the stride in the output.
+  const size_t BLOCK_SIZE = 1024;
+  uint64_t values[BLOCK_SIZE];
+  size_t local_byte_offset = 0;
+  uint64_t local_previous = 0;
+  size_t num_decoded = 0;
+  for (size_t i = index_stride - state_offset % index_stride;
+    i <= range.num_states; i += index_stride) {
+    while (num_decoded < i) {
+      num_decoded += decode_values(data, range.byte_size, local_byte_offset,
+        local_previous, values, std::min(i - num_decoded, BLOCK_SIZE));
     }
+    range.index.push_back(vbyte_index_entry_t(
+      byte_offset + first_size - local_first_size + local_byte_offset,
+      local_previous));
   }
+}
 
-  while (inputs.size() > 0) {
-    head_ptr top = inputs.top();
-    inputs.pop();
+static size_t parallel_merge_states(
+  const std::vector<std::string> &input_pathnames,
+  const char *output_pathname, size_t index_stride,
+  twenty48::vbyte_index_t &vbyte_index, size_t num_threads)
+{
+  // More ranges than threads, so a thread that gets a small range can take
+  // another.
+  const size_t RANGES_PER_THREAD = 4;
 
-    // We may pop the same state off multiple streams; only write it once.
-    if (top->peek() != value) {
-      value = top->peek();
+  std::vector<merge_samples_t> samples(input_pathnames.size());
+  work_queue_t sample_queue(input_pathnames.size(), num_threads);
+  run_threads(num_threads, [&](size_t worker) {
+    size_t i;
+    while (sample_queue.pop(worker, i)) {
+      samples[i] = merge_samples_t(input_pathnames[i]);
+    }
+  });
 
-      // Write the min state.
-      vbyte_writer.write(value);
-      num_states += 1;
+  std::vector<uint64_t> splitters =
+    choose_splitters(samples, num_threads * RANGES_PER_THREAD);
+  std::vector<merge_range_t> ranges;
+  for (size_t i = 0; i <= splitters.size(); ++i) {
+    ranges.push_back(merge_range_t(
+      i == 0 ? 0 : splitters[i - 1],
+      i == splitters.size() ? END_KEY : splitters[i],
+      std::string(output_pathname) + ".range-" + std::to_string(i)));
+  }
 
-      // Update index if necessary.
-      if (num_states % index_stride == 0) {
-        vbyte_index.push_back(vbyte_index_entry_t(
-          vbyte_writer.get_bytes_written(),
-          vbyte_writer.get_previous()));
+  int fd = -1;
+  try {
+    work_queue_t range_queue(ranges.size(), num_threads);
+    run_threads(num_threads, [&](size_t worker) {
+      size_t i;
+      while (range_queue.pop(worker, i)) {
+        merge_range(input_pathnames, samples, ranges[i]);
       }
+    });
+
+    // Lay out the ranges in the output. Each range's first state is now
+    // encoded relative to the last state in the range before it.
+    std::vector<size_t> state_offsets(ranges.size());
+    std::vector<size_t> byte_offsets(ranges.size());
+    std::vector<uint64_t> previous(ranges.size());
+    size_t num_states = 0;
+    size_t byte_size = 0;
+    uint64_t last = 0;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      state_offsets[i] = num_states;
+      byte_offsets[i] = byte_size;
+      previous[i] = last;
+      if (ranges[i].num_states == 0) continue;
+
+      uint8_t first_bytes[16];
+      byte_size += ranges[i].byte_size -
+        vbyte_append_sorted64(first_bytes, 0, ranges[i].first) +
+        vbyte_append_sorted64(first_bytes, last, ranges[i].first);
+      num_states += ranges[i].num_states;
+      last = ranges[i].last;
+    }
+
+    fd = open(output_pathname, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd == -1 || ftruncate(fd, byte_size) != 0) {
+      throw std::runtime_error(
+        std::string("merge_states: failed to create ") + output_pathname);
     }
 
-    top->read();
+    work_queue_t copy_queue(ranges.size(), num_threads);
+    run_threads(num_threads, [&](size_t worker) {
+      size_t i;
+      while (copy_queue.pop(worker, i)) {
+        if (ranges[i].num_states == 0) continue;
+        copy_range(fd, ranges[i], state_offsets[i], byte_offsets[i],
+          previous[i], index_stride);
+      }
+    });
+
+    if (close(fd) != 0) {
+      fd = -1;
+      throw std::runtime_error(
+        std::string("merge_states: failed to close ") + output_pathname);
+    }
+    fd = -1;
 
-    // A zero means that we've reached the end of the input; remove it.
-    if (top->peek() == 0) {
-      delete top;
-    } else {
-      inputs.push(top);
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      vbyte_index.insert(vbyte_index.end(),
+        ranges[i].index.begin(), ranges[i].index.end());
+      unlink(ranges[i].pathname.c_str());
     }
+    return num_states;
+  } catch (...) {
+    if (fd != -1) close(fd);
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      unlink(ranges[i].pathname.c_str());
+    }
+    throw;
   }
+}
+
+//
+// Merge all of the inputs into one file, on this thread.
+//
+static size_t merge_files(const std::vector<std::string> &input_pathnames,
+  const std::vector<const std::vector<uint64_t> *> &input_runs,
+  const char *output_pathname, size_t index_stride,
+  twenty48::vbyte_index_t &vbyte_index)
+{
+  size_t num_states = 0;
+  vbyte_writer_t vbyte_writer(output_pathname);
+
+  std::vector<merge_input_t> inputs;
+  inputs.reserve(input_pathnames.size() + input_runs.size());
+  for (size_t i = 0; i < input_pathnames.size(); ++i) {
+    inputs.emplace_back(input_pathnames[i].c_str());
+  }
+  for (size_t i = 0; i < input_runs.size(); ++i) {
+    inputs.emplace_back(input_runs[i]);
+  }
+
+  merge_inputs(inputs, 0, END_KEY, [&](uint64_t value) {
+    vbyte_writer.write(value);
+    num_states += 1;
+
+    // Update index if necessary.
+    if (num_states % index_stride == 0) {
+      vbyte_index.push_back(vbyte_index_entry_t(
+        vbyte_writer.get_bytes_written(),
+        vbyte_writer.get_previous()));
+    }
+  });
 
   return num_states;
 }
 
+//
+// An intermediate pass of a merge with too many inputs to open at once; its
+// output is not indexed.
+//
+static void merge_pass(const std::vector<std::string> &input_pathnames,
+  const char *output_pathname)
+{
+  vbyte_index_t vbyte_index;
+  merge_files(input_pathnames, std::vector<const std::vector<uint64_t> *>(),
+    output_pathname, std::numeric_limits<size_t>::max(), vbyte_index);
+}
+
+size_t merge_states(const std::vector<std::string> &input_pathnames,
+  const char *output_pathname, size_t index_stride,
+  twenty48::vbyte_index_t &vbyte_index, size_t num_threads, size_t max_files)
+{
+  // Below this, starting threads and writing temporary files costs more
+  // than it saves.
+  const size_t MIN_PARALLEL_BYTES = 1 << 24;
+
+  if (max_files == 0) max_files = default_max_merge_files();
+  merge_passes_t passes(input_pathnames, output_pathname, max_files,
+    merge_pass);
+  const std::vector<std::string> &pathnames = passes.get_pathnames();
+
+  if (num_threads == 0) {
+    size_t input_bytes = 0;
+    for (size_t i = 0; i < pathnames.size(); ++i) {
+      struct stat stat_buf;
+      if (stat(pathnames[i].c_str(), &stat_buf) == 0) {
+        input_bytes += stat_buf.st_size;
+      }
+    }
+    num_threads = input_bytes < MIN_PARALLEL_BYTES ? 1 : default_num_threads();
+  }
+
+  // Each thread of a parallel merge has all of the inputs open, and the
+  // output for its range.
+  num_threads = std::min(num_threads,
+    std::max(max_files / (pathnames.size() + 1), (size_t)1));
+
+  if (num_threads > 1) {
+    return parallel_merge_states(pathnames, output_pathname,
+      index_stride, vbyte_index, num_threads);
+  }
+  return merge_files(pathnames, std::vector<const std::vector<uint64_t> *>(),
+    output_pathname, index_stride, vbyte_index);
+}
+
+size_t merge_states(const std::vector<std::string> &input_pathnames,
+  const std::vector<const std::vector<uint64_t> *> &input_runs,
+  const char *output_pathname, size_t index_stride,
+  twenty48::vbyte_index_t &vbyte_index, size_t max_files)
+{
+  merge_passes_t passes(input_pathnames, output_pathname, max_files,
+    merge_pass);
+  return merge_files(passes.get_pathnames(), input_runs, output_pathname,
+    index_stride, vbyte_index);
+}
+
 }
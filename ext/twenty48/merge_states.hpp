@@ -1,5 +1,6 @@
 #ifndef TWENTY48_MERGE_STATES_HPP
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -7,10 +8,36 @@
 
 namespace twenty48 {
 
+/**
+ * Merge sorted vbyte files into one, without duplicates, and index every
+ * `index_stride`th state. Returns the number of states written.
+ *
+ * With more than one thread, the key space is split into ranges, which the
+ * threads merge separately into temporary files next to the output; those
+ * are then concatenated. If `num_threads` is zero, there is one thread per
+ * core when the inputs are large enough for that to help. The output and
+ * index do not depend on the number of threads.
+ *
+ * At most `max_files` files are open at once (by default, as many as the
+ * file descriptor limit allows). If there are more inputs than that, the
+ * smallest are first merged into temporary files; see merge_passes_t.
+ */
 size_t merge_states(
   const std::vector<std::string> &input_pathnames,
   const char *output_pathname, size_t index_stride,
-  twenty48::vbyte_index_t &vbyte_index);
+  twenty48::vbyte_index_t &vbyte_index, size_t num_threads = 1,
+  size_t max_files = 0);
+
+#ifndef SWIG
+/**
+ * Merge sorted runs in memory along with the input files, on one thread.
+ */
+size_t merge_states(
+  const std::vector<std::string> &input_pathnames,
+  const std::vector<const std::vector<uint64_t> *> &input_runs,
+  const char *output_pathname, size_t index_stride,
+  twenty48::vbyte_index_t &vbyte_index, size_t max_files = 0);
+#endif
 
 }
 
@@ -0,0 +1,87 @@
+#ifndef TWENTY48_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include "twenty48.hpp"
+#include "threads.hpp"
+
+namespace twenty48 {
+  /**
+   * Sort 64-bit keys with a least significant digit radix sort, one byte per
+   * pass. Each pass splits the keys into contiguous chunks, one per thread;
+   * each thread counts the digits in its chunk and then scatters its chunk
+   * into its own slots in the output, so the passes are stable. Passes in
+   * which all of the keys have the same digit are skipped, which saves the
+   * high bytes on the smaller boards.
+   *
+   * It needs a temporary buffer as large as the input.
+   */
+  inline void radix_sort(std::vector<uint64_t> &keys, size_t num_threads = 1) {
+    const size_t RADIX = 256;
+    const size_t MIN_KEYS_PER_THREAD = 1 << 16;
+
+    size_t n = keys.size();
+    if (n < 2) return;
+    num_threads = std::max(
+      std::min(num_threads, n / MIN_KEYS_PER_THREAD), (size_t)1);
+    size_t chunk = (n + num_threads - 1) / num_threads;
+
+    std::vector<uint64_t> buffer(n);
+    std::vector<size_t> offsets(num_threads * RADIX);
+    uint64_t *src = keys.data();
+    uint64_t *dst = buffer.data();
+
+    for (int shift = 0; shift < 64; shift += 8) {
+      run_threads(num_threads, [&](size_t t) {
+        size_t *count = offsets.data() + t * RADIX;
+        std::fill(count, count + RADIX, 0);
+        size_t end = std::min(n, (t + 1) * chunk);
+        for (size_t i = t * chunk; i < end; ++i) {
+          count[(src[i] >> shift) & 0xff] += 1;
+        }
+      });
+
+      // Turn the counts into the offset at which each thread should start
+      // writing each digit: all smaller digits come first, and then the same
+      // digit from earlier chunks.
+      bool skip = false;
+      size_t total = 0;
+      for (size_t digit = 0; digit < RADIX; ++digit) {
+        size_t digit_total = 0;
+        for (size_t t = 0; t < num_threads; ++t) {
+          size_t count = offsets[t * RADIX + digit];
+          offsets[t * RADIX + digit] = total + digit_total;
+          digit_total += count;
+        }
+        if (digit_total == n) skip = true;
+        total += digit_total;
+      }
+      if (skip) continue;
+
+      run_threads(num_threads, [&](size_t t) {
+        size_t *offset = offsets.data() + t * RADIX;
+        size_t end = std::min(n, (t + 1) * chunk);
+        for (size_t i = t * chunk; i < end; ++i) {
+          dst[offset[(src[i] >> shift) & 0xff]++] = src[i];
+        }
+      });
+      std::swap(src, dst);
+    }
+
+    if (src != keys.data()) keys.swap(buffer);
+  }
+
+  /**
+   * Sort the keys and remove duplicates.
+   */
+  inline void radix_sort_unique(std::vector<uint64_t> &keys,
+    size_t num_threads = 1)
+  {
+    radix_sort(keys, num_threads);
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  }
+}
+
+#define TWENTY48_RADIX_SORT_HPP
+#endif
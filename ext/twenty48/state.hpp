@@ -7,9 +7,16 @@
 
 #include "twenty48.hpp"
 #include "line.hpp"
+#include "transition_array.hpp"
 
 namespace twenty48 {
 
+#ifndef SWIG
+template <int size> struct state_batch_t;
+template <int size> struct state_avx2_t;
+template <int size> struct state_avx512_t;
+#endif
+
 /**
  * Board state.
  *
@@ -27,6 +34,15 @@ namespace twenty48 {
 template <int size> struct state_t {
   typedef uint64_t nybbles_t;
   typedef std::map<state_t<size>, double> transitions_t;
+  #ifndef SWIG
+  typedef twenty48::transition_array_t<state_t<size>, 2 * size * size>
+    transition_array_t;
+
+  // The batch kernels share the masks and tables below.
+  friend struct state_batch_t<size>;
+  friend struct state_avx2_t<size>;
+  friend struct state_avx512_t<size>;
+  #endif
 
   state_t(nybbles_t initial_nybbles = 0) {
     nybbles = initial_nybbles;
@@ -46,21 +62,69 @@ template <int size> struct state_t {
     return nybbles;
   }
 
+  /**
+   * The board is stuck iff there are no empty cells and no equal tiles next
+   * to each other, either horizontally or vertically. (The exception is the
+   * empty board, on which no move changes anything.)
+   */
   bool lose() const {
+    // We can't be stuck while there is an empty cell next to a tile.
+    if (non_zero(nybbles) != ONES_MASK) return nybbles == 0;
+    nybbles_t left_equal =
+      ~non_zero((nybbles >> 4) ^ nybbles) & HAS_LEFT_MASK;
+    nybbles_t up_equal =
+      ~non_zero((nybbles >> (4 * size)) ^ nybbles) & HAS_UP_MASK;
+    return (left_equal | up_equal) == 0;
+  }
+
+  /**
+   * Can we move in the given direction? That is, would moving in that
+   * direction change the board?
+   */
+  bool can_move(twenty48::direction_t direction) const {
+    return (legal_moves() >> direction) & 1;
+  }
+
+  /**
+   * Bit mask of the directions in which we can move; the bit for direction d
+   * is (1 << d).
+   *
+   * A move to the left changes a row iff there is an empty cell immediately
+   * left of a tile, or two equal tiles next to each other; similarly for the
+   * other directions. We can check this for all pairs of neighbouring cells
+   * at once by shifting each cell's neighbour into line with it.
+   */
+  int legal_moves() const {
+    const nybbles_t ONES = ONES_MASK;
+    const nybbles_t has_left = HAS_LEFT_MASK;
+    const nybbles_t has_up = HAS_UP_MASK;
+
+    nybbles_t tiles = non_zero(nybbles);
+
+    nybbles_t left = nybbles >> 4;
+    nybbles_t left_tiles = non_zero(left);
+    nybbles_t left_equal = ~non_zero(left ^ nybbles) & tiles;
+
+    nybbles_t up = nybbles >> (4 * size);
+    nybbles_t up_tiles = non_zero(up);
+    nybbles_t up_equal = ~non_zero(up ^ nybbles) & tiles;
+
     return
-      move(DIRECTION_LEFT) == *this &&
-      move(DIRECTION_RIGHT) == *this &&
-      move(DIRECTION_UP) == *this &&
-      move(DIRECTION_DOWN) == *this;
+      ((((~left_tiles & tiles) | left_equal) & has_left) != 0)
+        << DIRECTION_LEFT |
+      ((((left_tiles & ~tiles & ONES) | left_equal) & has_left) != 0)
+        << DIRECTION_RIGHT |
+      ((((~up_tiles & tiles) | up_equal) & has_up) != 0)
+        << DIRECTION_UP |
+      ((((up_tiles & ~tiles & ONES) | up_equal) & has_up) != 0)
+        << DIRECTION_DOWN;
   }
 
   uint8_t max_value() const {
     uint8_t result = 0;
-    nybbles_t temp = nybbles;
-    while (temp) {
-      uint8_t value = uint8_t(temp & 0xF);
+    for (size_t y = 0; y < size; ++y) {
+      uint8_t value = line_t<size>::lookup_info(get_row_nybbles(y)).max_value;
       if (value > result) result = value;
-      temp >>= 4;
     }
     return result;
   }
@@ -88,11 +152,8 @@ template <int size> struct state_t {
 
   int sum() const {
     int result = 0;
-    nybbles_t temp = nybbles;
-    while (temp) {
-      uint8_t value = uint8_t(temp & 0xF);
-      if (value != 0) result += 1 << value;
-      temp >>= 4;
+    for (size_t y = 0; y < size; ++y) {
+      result += line_t<size>::lookup_info(get_row_nybbles(y)).sum;
     }
     return result;
   }
@@ -107,24 +168,63 @@ template <int size> struct state_t {
    * Return a new state that is the result of moving this one in the given
    * direction.
    *
-   * At present, all of these are implemented in terms of moving left. There
-   * may be some efficiency improvements possible.
+   * Left and right moves look up each row directly. Up and down moves
+   * transpose the board once, so that each column is a row, and then look up
+   * each column in a table that puts the moved cells straight back into their
+   * column, so there is no need to transpose back.
    */
   state_t move (twenty48::direction_t direction) const {
     switch(direction) {
       case DIRECTION_LEFT:
-        return move_left();
+        return move_rows(line_t<size>::TABLE.table);
       case DIRECTION_RIGHT:
-        return reflect_horizontally().move(DIRECTION_LEFT).
-          reflect_horizontally();
+        return move_rows(line_t<size>::TABLE.reverse_table);
       case DIRECTION_UP:
-        return transpose().move(DIRECTION_LEFT).transpose();
+        return transpose().move_cols(COL_TABLE.table);
       case DIRECTION_DOWN:
-        return transpose().move(DIRECTION_RIGHT).transpose();
+        return transpose().move_cols(COL_TABLE.reverse_table);
     }
     throw std::invalid_argument("bad direction");
   }
 
+  #ifndef SWIG
+  /**
+   * Move in all four directions at once. The results are indexed by
+   * direction_t, and `moved[direction]` is false if the move in that
+   * direction leaves the board unchanged (so it is not a legal move).
+   *
+   * This reads each row and column only once, and the board is transposed
+   * only once for both the up and down moves.
+   *
+   * Returns true iff at least one move is legal.
+   */
+  bool move_all(state_t<size> moved_states[4], bool moved[4]) const {
+    const line_table_t &line_table = line_t<size>::TABLE;
+    const col_table_t &col_table = COL_TABLE;
+    nybbles_t transposed = transpose().nybbles;
+    nybbles_t left = 0, right = 0, up = 0, down = 0;
+    for (size_t y = 0; y < size; ++y) {
+      size_t shift = 4 * size * y;
+      uint16_t row_nybbles = (nybbles >> shift) & ROW_MASK;
+      left |= nybbles_t(line_table.table[row_nybbles]) << shift;
+      right |= nybbles_t(line_table.reverse_table[row_nybbles]) << shift;
+      uint16_t col_nybbles = (transposed >> shift) & ROW_MASK;
+      up |= col_table.table[col_nybbles] << (4 * y);
+      down |= col_table.reverse_table[col_nybbles] << (4 * y);
+    }
+    moved_states[DIRECTION_LEFT] = state_t<size>(left);
+    moved_states[DIRECTION_RIGHT] = state_t<size>(right);
+    moved_states[DIRECTION_UP] = state_t<size>(up);
+    moved_states[DIRECTION_DOWN] = state_t<size>(down);
+    moved[DIRECTION_LEFT] = left != nybbles;
+    moved[DIRECTION_RIGHT] = right != nybbles;
+    moved[DIRECTION_UP] = up != nybbles;
+    moved[DIRECTION_DOWN] = down != nybbles;
+    return moved[DIRECTION_LEFT] || moved[DIRECTION_RIGHT] ||
+      moved[DIRECTION_UP] || moved[DIRECTION_DOWN];
+  }
+  #endif
+
   state_t<size> reflect_horizontally() const {
     nybbles_t c1, c2, c3, c4;
     switch(size) {
@@ -228,22 +328,98 @@ template <int size> struct state_t {
    * normalized.
    */
   transitions_t random_transitions(int step = 0) const {
-    transitions_t transitions;
+    transition_array_t transitions;
+    random_transitions(transitions, step);
+    return transitions_t(transitions.begin(), transitions.end());
+  }
+
+  #ifndef SWIG
+  /**
+   * As above, but the transitions go into a fixed-size array, so there is no
+   * heap allocation; use this version in inner loops.
+   */
+  void random_transitions(transition_array_t &transitions, int step = 0) const
+  {
+    nybbles_t successors_1[size * size];
+    nybbles_t successors_2[size * size];
+    uint8_t weights[size * size];
+    size_t n = successors(successors_1, successors_2, weights);
     size_t denominator = cells_available();
-    for (size_t i = 0; i < size * size; ++i) {
-      if ((*this)[i] != 0) continue;
-      if (step == 0 || step == 1) {
-        transitions[new_state_with_tile(i, 1).canonicalize()] +=
-          0.9 / denominator;
+    transitions.clear();
+    if (step == 0 || step == 1) {
+      for (size_t i = 0; i < n; ++i) {
+        transitions.push_back(
+          successors_1[i], weights[i] * (0.9 / denominator));
       }
-      if (step == 0 || step == 2) {
-        transitions[new_state_with_tile(i, 2).canonicalize()] +=
-          0.1 / denominator;
+    }
+    if (step == 0 || step == 2) {
+      for (size_t i = 0; i < n; ++i) {
+        transitions.push_back(
+          successors_2[i], weights[i] * (0.1 / denominator));
       }
     }
-    return transitions;
+    transitions.sort_and_merge();
   }
 
+  /**
+   * Place a 2 tile (in `successors_1`) and a 4 tile (in `successors_2`) in
+   * each empty cell, and canonicalize the resulting states. The outputs must
+   * have room for `size * size` states. Returns the number of successors.
+   *
+   * Rather than canonicalizing each successor from scratch, we find the eight
+   * symmetries of this state once. Placing a tile in cell i of this state
+   * places it in a known cell of each symmetry, so each successor's
+   * symmetries are just those eight with one nybble set.
+   *
+   * If this state is symmetric, placing a tile in cells that map to each other
+   * under its symmetries gives the same canonical successor, so we only place
+   * one tile per orbit of cells. The number of empty cells in each orbit is
+   * returned in `weights`, and the weights sum to cells_available().
+   */
+  size_t successors(nybbles_t successors_1[], nybbles_t successors_2[],
+    uint8_t weights[]) const
+  {
+    const symmetry_table_t &symmetry_table = get_symmetry_table();
+    nybbles_t images[NUM_SYMMETRIES];
+    symmetries(images);
+
+    // Find the symmetries that leave this state unchanged (its stabilizer),
+    // apart from the identity, which is always one of them.
+    uint8_t stabilizer = 0;
+    for (size_t k = 1; k < NUM_SYMMETRIES; ++k) {
+      if (images[k] == nybbles) stabilizer |= 1 << k;
+    }
+
+    size_t n = 0;
+    uint16_t visited = 0;
+    for (size_t i = 0; i < size * size; ++i) {
+      // The first symmetry is the identity, so this checks cell i is empty.
+      const nybbles_t *ones = symmetry_table.ones[i];
+      if (nybbles & (ones[0] * 0xF)) continue;
+
+      uint8_t weight = 1;
+      if (stabilizer) {
+        if (visited & (1 << i)) continue;
+        visited |= 1 << i;
+        const uint8_t *cells = symmetry_table.cells[i];
+        for (size_t k = 1; k < NUM_SYMMETRIES; ++k) {
+          if (!(stabilizer & (1 << k)) || (visited & (1 << cells[k]))) {
+            continue;
+          }
+          visited |= 1 << cells[k];
+          ++weight;
+        }
+      }
+
+      successors_1[n] = min_image(images, ones, 0);
+      successors_2[n] = min_image(images, ones, 1);
+      weights[n] = weight;
+      ++n;
+    }
+    return n;
+  }
+  #endif
+
   state_t new_state_with_tile(size_t i, uint8_t value) const {
     return state_t(set_nybble(nybbles, i, value));
   }
@@ -259,13 +435,30 @@ template <int size> struct state_t {
     throw std::runtime_error("no available cell to place tile");
   }
 
-  //
-  // Does the state contain a pair of cells, both with value `value`, separated
-  // only by zero or more zeros? If so, we can always swipe to get a `value + 1`
-  // tile.
-  //
+  /**
+   * Is there a row or column with a pair of `value` tiles, separated only by
+   * zero or more empty cells? If so, we can always swipe to get a `value + 1`
+   * tile. See line_t::has_adjacent_pair.
+   */
   bool has_adjacent_pair(uint8_t value) const {
-    return any_row_or_col(adjacent_pair_t(value));
+    if (value > 0xF) return false;
+    return (adjacent_pairs() >> value) & 1;
+  }
+
+  /**
+   * Bit mask of the values for which has_adjacent_pair is true. The columns
+   * are the rows of the transposed board, so this is one table lookup for
+   * each row and each column.
+   */
+  uint16_t adjacent_pairs() const {
+    state_t<size> transposed = transpose();
+    uint16_t result = 0;
+    for (size_t y = 0; y < size; ++y) {
+      result |= line_t<size>::lookup_info(get_row_nybbles(y)).adjacent_pairs;
+      result |= line_t<size>::lookup_info(
+        transposed.get_row_nybbles(y)).adjacent_pairs;
+    }
+    return result;
   }
 
   bool operator==(const state_t<size> &other) const {
@@ -293,10 +486,6 @@ private:
     return twenty48::get_nybble(data, i, size * size);
   }
 
-  static uint8_t get_grid_nybble(nybbles_t data, size_t x, size_t y) {
-    return get_nybble(data, y * size + x);
-  }
-
   static nybbles_t set_nybble(nybbles_t data, size_t i, uint8_t value) {
     return twenty48::set_nybble(data, i, value, size * size);
   }
@@ -305,62 +494,169 @@ private:
     nybbles = set_nybble(nybbles, i, value);
   }
 
-  template <typename Predicate> bool any_row(Predicate predicate) const {
-    for (size_t y = 0; y < size; ++y) {
-      uint16_t row_nybbles = 0;
-      for (size_t x = 0; x < size; ++x) {
-        uint8_t value = get_grid_nybble(nybbles, x, y);
-        row_nybbles = line_t<size>::set_nybble(row_nybbles, x, value);
-      }
-      if (predicate(line_t<size>(row_nybbles))) {
-        return true;
+  #ifndef SWIG
+  // A 1 in the lowest bit of each cell's nybble.
+  static const nybbles_t ONES_MASK =
+    0x1111111111111111ULL >> (4 * (16 - size * size));
+
+  // A 1 in the lowest bit of each cell that has a neighbour to its left.
+  static const nybbles_t HAS_LEFT_MASK =
+    size == 2 ? 0x0000000000000101ULL :
+    size == 3 ? 0x0000000011011011ULL :
+    0x0111011101110111ULL;
+
+  // A 1 in the lowest bit of each cell that has a neighbour above it.
+  static const nybbles_t HAS_UP_MASK =
+    size == 2 ? 0x0000000000000011ULL :
+    size == 3 ? 0x0000000000111111ULL :
+    0x0000111111111111ULL;
+
+  //
+  // Put a 1 in the lowest bit of each non-zero nybble and 0 elsewhere. Adding
+  // 7 to the low three bits of a nybble sets its high bit if any of them is
+  // set, and it cannot carry into the next nybble.
+  //
+  static nybbles_t non_zero(nybbles_t v) {
+    const nybbles_t SEVENS = 0x7777777777777777ULL;
+    return ((((v & SEVENS) + SEVENS) | v) >> 3) & ONES_MASK;
+  }
+
+  static const nybbles_t ROW_MASK = 0xFFFFULL >> (4 * (4 - size));
+  static const size_t LINE_TABLE_SIZE = line_t<size>::table_t::TABLE_SIZE;
+  typedef typename line_t<size>::table_t line_table_t;
+
+  uint16_t get_row_nybbles(size_t y) const {
+    return (nybbles >> (4 * size * (size - y - 1))) & ROW_MASK;
+  }
+
+  /**
+   * Precompute all possible column moves. Each entry is the moved line spread
+   * out into the rightmost column of the board, so that the result for column
+   * x can be shifted into place by 4 * (size - x - 1) bits.
+   *
+   * Like the line table, this is built when the program starts. The order in
+   * which the two are built is unspecified, so this one computes the moves
+   * itself rather than reading them from the line table.
+   */
+  struct col_table_t {
+    nybbles_t table[LINE_TABLE_SIZE + 1];
+    nybbles_t reverse_table[LINE_TABLE_SIZE + 1];
+
+    col_table_t() {
+      for (size_t nybbles = 0; nybbles <= LINE_TABLE_SIZE; ++nybbles) {
+        line_t<size> line(nybbles);
+        table[nybbles] = unpack_col(line.move().get_nybbles());
+        reverse_table[nybbles] =
+          unpack_col(line.reverse().move().reverse().get_nybbles());
       }
     }
-    return false;
-  }
 
-  template <typename Predicate> bool any_col(Predicate predicate) const {
-    for (size_t x = 0; x < size; ++x) {
-      uint16_t col_nybbles = 0;
+    static nybbles_t unpack_col(uint16_t line_nybbles) {
+      nybbles_t result = 0;
       for (size_t y = 0; y < size; ++y) {
-        uint8_t value = get_grid_nybble(nybbles, x, y);
-        col_nybbles = line_t<size>::set_nybble(col_nybbles, y, value);
-      }
-      if (predicate(line_t<size>(col_nybbles))) {
-        return true;
+        result = set_nybble(result, y * size + size - 1,
+          line_t<size>::get_nybble(line_nybbles, y));
       }
+      return result;
     }
-    return false;
-  }
+  };
 
-  template <typename Predicate> bool any_row_or_col(Predicate predicate) const {
-    return any_row(predicate) || any_col(predicate);
-  }
+  static const col_table_t COL_TABLE;
+  #endif
 
-  struct adjacent_pair_t {
-    adjacent_pair_t(uint8_t value) :
-      value(value) { }
+  static const size_t NUM_SYMMETRIES = 8;
 
-    bool operator()(const line_t<size> &line) const {
-      return line.has_adjacent_pair(value);
+  //
+  // The eight symmetries of the board (under reflections and rotations). The
+  // order is fixed, because symmetry_table_t relies on it.
+  //
+  void symmetries(nybbles_t images[NUM_SYMMETRIES]) const {
+    state_t<size> horizontal_reflection = reflect_horizontally();
+    state_t<size> vertical_reflection = reflect_vertically();
+    state_t<size> rotated_180 = horizontal_reflection.reflect_vertically();
+    images[0] = nybbles;
+    images[1] = horizontal_reflection.nybbles;
+    images[2] = vertical_reflection.nybbles;
+    images[3] = rotated_180.nybbles;
+    images[4] = transpose().nybbles;
+    images[5] = horizontal_reflection.transpose().nybbles;
+    images[6] = vertical_reflection.transpose().nybbles;
+    images[7] = rotated_180.transpose().nybbles;
+  }
+
+  /**
+   * For each cell and symmetry, the index of the cell that the cell maps to
+   * under that symmetry, and a 1 in that cell's nybble.
+   */
+  struct symmetry_table_t {
+    nybbles_t ones[size * size][NUM_SYMMETRIES];
+    uint8_t cells[size * size][NUM_SYMMETRIES];
+
+    symmetry_table_t() {
+      for (size_t i = 0; i < size * size; ++i) {
+        state_t<size>(set_nybble(0, i, 1)).symmetries(ones[i]);
+        for (size_t k = 0; k < NUM_SYMMETRIES; ++k) {
+          for (size_t j = 0; j < size * size; ++j) {
+            if (state_t<size>(ones[i][k])[j]) cells[i][k] = j;
+          }
+        }
+      }
     }
-  private:
-    uint8_t value;
   };
 
-  state_t move_left() const {
-    const nybbles_t ROW_MASK = 0xFFFFULL >> (4 * (4 - size));
+  static const symmetry_table_t &get_symmetry_table() {
+    static symmetry_table_t symmetry_table;
+    return symmetry_table;
+  }
+
+  //
+  // Set a nybble to 1 << shift in each image and take the minimum. The
+  // nybble must be zero in each image. The minimum is taken pairwise so that
+  // the comparisons do not form one long dependency chain.
+  //
+  static nybbles_t min_image(const nybbles_t images[NUM_SYMMETRIES],
+    const nybbles_t ones[NUM_SYMMETRIES], int shift)
+  {
+    nybbles_t m01 = std::min(images[0] | ones[0] << shift,
+      images[1] | ones[1] << shift);
+    nybbles_t m23 = std::min(images[2] | ones[2] << shift,
+      images[3] | ones[3] << shift);
+    nybbles_t m45 = std::min(images[4] | ones[4] << shift,
+      images[5] | ones[5] << shift);
+    nybbles_t m67 = std::min(images[6] | ones[6] << shift,
+      images[7] | ones[7] << shift);
+    return std::min(std::min(m01, m23), std::min(m45, m67));
+  }
+
+  state_t move_rows(const uint16_t *line_table) const {
     nybbles_t result = 0;
     for (size_t y = 0; y < size; ++y) {
       size_t shift = 4 * size * y;
       uint16_t row_nybbles = (nybbles >> shift) & ROW_MASK;
-      row_nybbles = line_t<size>::lookup_move(row_nybbles);
-      result |= nybbles_t(row_nybbles) << shift;
+      result |= nybbles_t(line_table[row_nybbles]) << shift;
+    }
+    return state_t(result);
+  }
+
+  //
+  // Move the columns of the original board, given that this is its transpose;
+  // the rows of this board are the columns of the original.
+  //
+  state_t move_cols(const nybbles_t *col_table) const {
+    nybbles_t result = 0;
+    for (size_t y = 0; y < size; ++y) {
+      uint16_t col_nybbles = (nybbles >> (4 * size * y)) & ROW_MASK;
+      result |= col_table[col_nybbles] << (4 * y);
     }
     return state_t(result);
   }
 };
 
+#ifndef SWIG
+template <int size>
+const typename state_t<size>::col_table_t state_t<size>::COL_TABLE;
+#endif
+
 template <int size>
 std::ostream &operator << (std::ostream &os, const state_t<size> &state) {
   for (int i = 0; i < size * size; ++i) {
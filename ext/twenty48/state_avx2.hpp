@@ -0,0 +1,314 @@
+#ifndef TWENTY48_STATE_AVX2_HPP
+
+#include "cpu_features.hpp"
+#include "state.hpp"
+
+#if TWENTY48_HAVE_AVX2_TARGET
+#include <immintrin.h>
+
+namespace twenty48 {
+  /**
+   * AVX2 versions of the state_t bit twiddling, operating on four boards (one
+   * per 64-bit lane) at a time. The masks and shifts are exactly those used
+   * in state_t; see there for comments.
+   *
+   * The batch kernels each return the number of boards processed, which is
+   * `n` rounded down to a multiple of four; the caller must handle any
+   * leftovers. Use them through state_batch_t, which does that.
+   *
+   * Everything here must only be called if cpu_has_avx2() is true.
+   */
+  template <int size> struct state_avx2_t {
+    typedef uint64_t nybbles_t;
+    typedef state_t<size> state_type;
+
+    TWENTY48_TARGET_AVX2
+    static __m256i reflect_horizontally(__m256i x) {
+      switch(size) {
+        case 2:
+          return _mm256_or_si256(
+            _mm256_srli_epi64(mask(x, 0x000000000000F0F0ULL), 4),
+            _mm256_slli_epi64(mask(x, 0x0000000000000F0FULL), 4));
+        case 3:
+          return _mm256_or_si256(
+            _mm256_or_si256(
+              _mm256_srli_epi64(mask(x, 0x0000000F00F00F00ULL), 8),
+              mask(x, 0x00000000F00F00F0ULL)),
+            _mm256_slli_epi64(mask(x, 0x000000000F00F00FULL), 8));
+        case 4:
+          return _mm256_or_si256(
+            _mm256_or_si256(
+              _mm256_srli_epi64(mask(x, 0xF000F000F000F000ULL), 12),
+              _mm256_srli_epi64(mask(x, 0x0F000F000F000F00ULL), 4)),
+            _mm256_or_si256(
+              _mm256_slli_epi64(mask(x, 0x00F000F000F000F0ULL), 4),
+              _mm256_slli_epi64(mask(x, 0x000F000F000F000FULL), 12)));
+      }
+      return x;
+    }
+
+    TWENTY48_TARGET_AVX2
+    static __m256i reflect_vertically(__m256i x) {
+      switch(size) {
+        case 2:
+          return _mm256_or_si256(
+            _mm256_srli_epi64(mask(x, 0x000000000000FF00ULL), 8),
+            _mm256_slli_epi64(mask(x, 0x00000000000000FFULL), 8));
+        case 3:
+          return _mm256_or_si256(
+            _mm256_or_si256(
+              _mm256_srli_epi64(mask(x, 0x0000000FFF000000ULL), 24),
+              mask(x, 0x0000000000FFF000ULL)),
+            _mm256_slli_epi64(mask(x, 0x0000000000000FFFULL), 24));
+        case 4:
+          return _mm256_or_si256(
+            _mm256_or_si256(
+              _mm256_srli_epi64(mask(x, 0xFFFF000000000000ULL), 48),
+              _mm256_srli_epi64(mask(x, 0x0000FFFF00000000ULL), 16)),
+            _mm256_or_si256(
+              _mm256_slli_epi64(mask(x, 0x00000000FFFF0000ULL), 16),
+              _mm256_slli_epi64(mask(x, 0x000000000000FFFFULL), 48)));
+      }
+      return x;
+    }
+
+    TWENTY48_TARGET_AVX2
+    static __m256i transpose(__m256i x) {
+      __m256i a;
+      switch(size) {
+        case 2:
+          return _mm256_or_si256(
+            _mm256_or_si256(
+              mask(x, 0x000000000000F00FULL),
+              _mm256_srli_epi64(mask(x, 0x0000000000000F00ULL), 4)),
+            _mm256_slli_epi64(mask(x, 0x00000000000000F0ULL), 4));
+        case 3:
+          return _mm256_or_si256(
+            _mm256_or_si256(
+              mask(x, 0x0000000F000F000FULL),
+              _mm256_or_si256(
+                _mm256_srli_epi64(mask(x, 0x00000000F000F000ULL), 8),
+                _mm256_srli_epi64(mask(x, 0x000000000F000000ULL), 16))),
+            _mm256_or_si256(
+              _mm256_slli_epi64(mask(x, 0x0000000000F000F0ULL), 8),
+              _mm256_slli_epi64(mask(x, 0x0000000000000F00ULL), 16)));
+        case 4:
+          a = _mm256_or_si256(
+            mask(x, 0xF0F00F0FF0F00F0FULL),
+            _mm256_or_si256(
+              _mm256_slli_epi64(mask(x, 0x0000F0F00000F0F0ULL), 12),
+              _mm256_srli_epi64(mask(x, 0x0F0F00000F0F0000ULL), 12)));
+          return _mm256_or_si256(
+            mask(a, 0xFF00FF0000FF00FFULL),
+            _mm256_or_si256(
+              _mm256_srli_epi64(mask(a, 0x00FF00FF00000000ULL), 24),
+              _mm256_slli_epi64(mask(a, 0x00000000FF00FF00ULL), 24)));
+      }
+      return x;
+    }
+
+    /**
+     * Lane-wise unsigned minimum. AVX2 only has a signed 64-bit comparison, so
+     * flip the sign bits before comparing.
+     */
+    TWENTY48_TARGET_AVX2
+    static __m256i min_epu64(__m256i x, __m256i y) {
+      const __m256i sign = _mm256_set1_epi64x(0x8000000000000000ULL);
+      __m256i x_gt_y = _mm256_cmpgt_epi64(
+        _mm256_xor_si256(x, sign), _mm256_xor_si256(y, sign));
+      return _mm256_blendv_epi8(x, y, x_gt_y);
+    }
+
+    /**
+     * Canonicalize `n` boards, four at a time (one per lane), computing each
+     * of the eight symmetries for all four boards in parallel.
+     *
+     * Note: putting the eight symmetries of a single board in the lanes turns
+     * out to be slower than the scalar code, because the shuffles and the
+     * reduction across lanes are all on the critical path.
+     */
+    TWENTY48_TARGET_AVX2
+    static size_t canonicalize_batch(
+      const nybbles_t *in, nybbles_t *out, size_t n)
+    {
+      size_t i = 0;
+      for (; i + 4 <= n; i += 4) {
+        __m256i x = load(in + i);
+        __m256i h = reflect_horizontally(x);
+        __m256i v = reflect_vertically(x);
+        __m256i hv = reflect_vertically(h);
+        __m256i m = min_epu64(min_epu64(x, h), min_epu64(v, hv));
+        m = min_epu64(m, min_epu64(
+          min_epu64(transpose(x), transpose(h)),
+          min_epu64(transpose(v), transpose(hv))));
+        store(out + i, m);
+      }
+      return i;
+    }
+
+    /**
+     * Move the rows of `n` boards using the given line table (the table or
+     * reverse_table from line_t::table_t), gathering one row from each of
+     * four boards at a time.
+     */
+    TWENTY48_TARGET_AVX2
+    static size_t move_rows_batch(const nybbles_t *in, nybbles_t *out,
+      size_t n, const uint16_t *line_table)
+    {
+      const long long *table = reinterpret_cast<const long long *>(line_table);
+      size_t i = 0;
+      for (; i + 4 <= n; i += 4) {
+        __m256i x = load(in + i);
+        __m256i result = _mm256_setzero_si256();
+        for (size_t y = 0; y < size; ++y) {
+          __m256i row = mask(
+            _mm256_srli_epi64(x, 4 * size * y), state_type::ROW_MASK);
+          // The gather reads eight bytes from each entry; keep the first two.
+          __m256i moved = mask(_mm256_i64gather_epi64(table, row, 2), 0xFFFF);
+          result = _mm256_or_si256(result,
+            _mm256_slli_epi64(moved, 4 * size * y));
+        }
+        store(out + i, result);
+      }
+      return i;
+    }
+
+    /**
+     * Move the columns of `n` boards using the given column table (from
+     * state_t::col_table_t); see state_t::move_cols.
+     */
+    TWENTY48_TARGET_AVX2
+    static size_t move_cols_batch(const nybbles_t *in, nybbles_t *out,
+      size_t n, const nybbles_t *col_table)
+    {
+      const long long *table = reinterpret_cast<const long long *>(col_table);
+      size_t i = 0;
+      for (; i + 4 <= n; i += 4) {
+        __m256i x = transpose(load(in + i));
+        __m256i result = _mm256_setzero_si256();
+        for (size_t y = 0; y < size; ++y) {
+          __m256i col = mask(
+            _mm256_srli_epi64(x, 4 * size * y), state_type::ROW_MASK);
+          __m256i moved = _mm256_i64gather_epi64(table, col, 8);
+          result = _mm256_or_si256(result, _mm256_slli_epi64(moved, 4 * y));
+        }
+        store(out + i, result);
+      }
+      return i;
+    }
+
+    /**
+     * Set `out[i]` to 1 if board `i` is stuck, or 0 otherwise; see
+     * state_t::lose.
+     */
+    TWENTY48_TARGET_AVX2
+    static size_t lose_batch(const nybbles_t *in, uint8_t *out, size_t n) {
+      const __m256i ones = _mm256_set1_epi64x(state_type::ONES_MASK);
+      const __m256i zero = _mm256_setzero_si256();
+      size_t i = 0;
+      for (; i + 4 <= n; i += 4) {
+        __m256i x = load(in + i);
+        __m256i full = _mm256_cmpeq_epi64(non_zero(x), ones);
+        __m256i left_equal = _mm256_andnot_si256(
+          non_zero(_mm256_xor_si256(_mm256_srli_epi64(x, 4), x)),
+          _mm256_set1_epi64x(state_type::HAS_LEFT_MASK));
+        __m256i up_equal = _mm256_andnot_si256(
+          non_zero(_mm256_xor_si256(_mm256_srli_epi64(x, 4 * size), x)),
+          _mm256_set1_epi64x(state_type::HAS_UP_MASK));
+        __m256i no_equal = _mm256_cmpeq_epi64(
+          _mm256_or_si256(left_equal, up_equal), zero);
+        __m256i lose = _mm256_or_si256(
+          _mm256_and_si256(full, no_equal), _mm256_cmpeq_epi64(x, zero));
+        int bits = _mm256_movemask_pd(_mm256_castsi256_pd(lose));
+        for (size_t k = 0; k < 4; ++k) out[i + k] = (bits >> k) & 1;
+      }
+      return i;
+    }
+
+    /**
+     * Set `out[i]` to the sum of the tiles on board `i`. Each tile value is
+     * split into its low and high bytes, which are looked up from the
+     * exponents with a shuffle and then added up with a SAD.
+     */
+    TWENTY48_TARGET_AVX2
+    static size_t sum_batch(const nybbles_t *in, int *out, size_t n) {
+      const __m256i low_bytes = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+        0, 2, 4, 8, 16, 32, (char)64, (char)128,
+        0, 0, 0, 0, 0, 0, 0, 0));
+      const __m256i high_bytes = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 2, 4, 8, 16, 32, (char)64, (char)128));
+      const __m256i zero = _mm256_setzero_si256();
+      const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+      size_t i = 0;
+      for (; i + 4 <= n; i += 4) {
+        __m256i x = load(in + i);
+        __m256i lo = mask(x, 0x0F0F0F0F0F0F0F0FULL);
+        __m256i hi = mask(_mm256_srli_epi64(x, 4), 0x0F0F0F0F0F0F0F0FULL);
+        __m256i low_sum = _mm256_add_epi64(
+          _mm256_sad_epu8(_mm256_shuffle_epi8(low_bytes, lo), zero),
+          _mm256_sad_epu8(_mm256_shuffle_epi8(low_bytes, hi), zero));
+        __m256i high_sum = _mm256_add_epi64(
+          _mm256_sad_epu8(_mm256_shuffle_epi8(high_bytes, lo), zero),
+          _mm256_sad_epu8(_mm256_shuffle_epi8(high_bytes, hi), zero));
+        __m256i sum = _mm256_add_epi64(low_sum,
+          _mm256_slli_epi64(high_sum, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+          _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(sum, even)));
+      }
+      return i;
+    }
+
+    /**
+     * Set `out[i]` to the largest exponent on board `i`.
+     */
+    TWENTY48_TARGET_AVX2
+    static size_t max_value_batch(const nybbles_t *in, uint8_t *out,
+      size_t n)
+    {
+      size_t i = 0;
+      for (; i + 4 <= n; i += 4) {
+        __m256i x = load(in + i);
+        __m256i m = _mm256_max_epu8(mask(x, 0x0F0F0F0F0F0F0F0FULL),
+          mask(_mm256_srli_epi64(x, 4), 0x0F0F0F0F0F0F0F0FULL));
+        m = _mm256_max_epu8(m, _mm256_srli_epi64(m, 32));
+        m = _mm256_max_epu8(m, _mm256_srli_epi64(m, 16));
+        m = _mm256_max_epu8(m, _mm256_srli_epi64(m, 8));
+        nybbles_t result[4];
+        store(result, m);
+        for (size_t k = 0; k < 4; ++k) out[i + k] = result[k] & 0xFF;
+      }
+      return i;
+    }
+
+  private:
+    TWENTY48_TARGET_AVX2
+    static __m256i mask(__m256i x, nybbles_t mask) {
+      return _mm256_and_si256(x, _mm256_set1_epi64x(mask));
+    }
+
+    TWENTY48_TARGET_AVX2
+    static __m256i load(const nybbles_t *in) {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in));
+    }
+
+    TWENTY48_TARGET_AVX2
+    static void store(nybbles_t *out, __m256i x) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), x);
+    }
+
+    // See state_t::non_zero.
+    TWENTY48_TARGET_AVX2
+    static __m256i non_zero(__m256i v) {
+      const __m256i sevens = _mm256_set1_epi64x(0x7777777777777777ULL);
+      return mask(_mm256_srli_epi64(_mm256_or_si256(
+        _mm256_add_epi64(_mm256_and_si256(v, sevens), sevens), v), 3),
+        state_type::ONES_MASK);
+    }
+  };
+}
+
+#endif
+
+#define TWENTY48_STATE_AVX2_HPP
+#endif
@@ -0,0 +1,271 @@
+#ifndef TWENTY48_STATE_AVX512_HPP
+
+#include "cpu_features.hpp"
+#include "state.hpp"
+
+#if TWENTY48_HAVE_AVX512_TARGET
+#include <immintrin.h>
+
+// GCC 12 warns about the undefined vectors that its own AVX-512 intrinsics
+// use as pass-through operands.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+namespace twenty48 {
+  /**
+   * AVX-512 versions of the batch kernels in state_avx2_t, operating on eight
+   * boards at a time; see there for comments. These use AVX-512F and, for the
+   * byte shuffles in sum_batch and max_value_batch, AVX-512BW.
+   *
+   * Everything here must only be called if cpu_has_avx512() is true.
+   */
+  template <int size> struct state_avx512_t {
+    typedef uint64_t nybbles_t;
+    typedef state_t<size> state_type;
+
+    TWENTY48_TARGET_AVX512
+    static __m512i reflect_horizontally(__m512i x) {
+      switch(size) {
+        case 2:
+          return _mm512_or_si512(
+            _mm512_srli_epi64(mask(x, 0x000000000000F0F0ULL), 4),
+            _mm512_slli_epi64(mask(x, 0x0000000000000F0FULL), 4));
+        case 3:
+          return _mm512_or_si512(
+            _mm512_or_si512(
+              _mm512_srli_epi64(mask(x, 0x0000000F00F00F00ULL), 8),
+              mask(x, 0x00000000F00F00F0ULL)),
+            _mm512_slli_epi64(mask(x, 0x000000000F00F00FULL), 8));
+        case 4:
+          return _mm512_or_si512(
+            _mm512_or_si512(
+              _mm512_srli_epi64(mask(x, 0xF000F000F000F000ULL), 12),
+              _mm512_srli_epi64(mask(x, 0x0F000F000F000F00ULL), 4)),
+            _mm512_or_si512(
+              _mm512_slli_epi64(mask(x, 0x00F000F000F000F0ULL), 4),
+              _mm512_slli_epi64(mask(x, 0x000F000F000F000FULL), 12)));
+      }
+      return x;
+    }
+
+    TWENTY48_TARGET_AVX512
+    static __m512i reflect_vertically(__m512i x) {
+      switch(size) {
+        case 2:
+          return _mm512_or_si512(
+            _mm512_srli_epi64(mask(x, 0x000000000000FF00ULL), 8),
+            _mm512_slli_epi64(mask(x, 0x00000000000000FFULL), 8));
+        case 3:
+          return _mm512_or_si512(
+            _mm512_or_si512(
+              _mm512_srli_epi64(mask(x, 0x0000000FFF000000ULL), 24),
+              mask(x, 0x0000000000FFF000ULL)),
+            _mm512_slli_epi64(mask(x, 0x0000000000000FFFULL), 24));
+        case 4:
+          return _mm512_or_si512(
+            _mm512_or_si512(
+              _mm512_srli_epi64(mask(x, 0xFFFF000000000000ULL), 48),
+              _mm512_srli_epi64(mask(x, 0x0000FFFF00000000ULL), 16)),
+            _mm512_or_si512(
+              _mm512_slli_epi64(mask(x, 0x00000000FFFF0000ULL), 16),
+              _mm512_slli_epi64(mask(x, 0x000000000000FFFFULL), 48)));
+      }
+      return x;
+    }
+
+    TWENTY48_TARGET_AVX512
+    static __m512i transpose(__m512i x) {
+      __m512i a;
+      switch(size) {
+        case 2:
+          return _mm512_or_si512(
+            _mm512_or_si512(
+              mask(x, 0x000000000000F00FULL),
+              _mm512_srli_epi64(mask(x, 0x0000000000000F00ULL), 4)),
+            _mm512_slli_epi64(mask(x, 0x00000000000000F0ULL), 4));
+        case 3:
+          return _mm512_or_si512(
+            _mm512_or_si512(
+              mask(x, 0x0000000F000F000FULL),
+              _mm512_or_si512(
+                _mm512_srli_epi64(mask(x, 0x00000000F000F000ULL), 8),
+                _mm512_srli_epi64(mask(x, 0x000000000F000000ULL), 16))),
+            _mm512_or_si512(
+              _mm512_slli_epi64(mask(x, 0x0000000000F000F0ULL), 8),
+              _mm512_slli_epi64(mask(x, 0x0000000000000F00ULL), 16)));
+        case 4:
+          a = _mm512_or_si512(
+            mask(x, 0xF0F00F0FF0F00F0FULL),
+            _mm512_or_si512(
+              _mm512_slli_epi64(mask(x, 0x0000F0F00000F0F0ULL), 12),
+              _mm512_srli_epi64(mask(x, 0x0F0F00000F0F0000ULL), 12)));
+          return _mm512_or_si512(
+            mask(a, 0xFF00FF0000FF00FFULL),
+            _mm512_or_si512(
+              _mm512_srli_epi64(mask(a, 0x00FF00FF00000000ULL), 24),
+              _mm512_slli_epi64(mask(a, 0x00000000FF00FF00ULL), 24)));
+      }
+      return x;
+    }
+
+    TWENTY48_TARGET_AVX512
+    static size_t canonicalize_batch(
+      const nybbles_t *in, nybbles_t *out, size_t n)
+    {
+      size_t i = 0;
+      for (; i + 8 <= n; i += 8) {
+        __m512i x = load(in + i);
+        __m512i h = reflect_horizontally(x);
+        __m512i v = reflect_vertically(x);
+        __m512i hv = reflect_vertically(h);
+        __m512i m = _mm512_min_epu64(
+          _mm512_min_epu64(x, h), _mm512_min_epu64(v, hv));
+        m = _mm512_min_epu64(m, _mm512_min_epu64(
+          _mm512_min_epu64(transpose(x), transpose(h)),
+          _mm512_min_epu64(transpose(v), transpose(hv))));
+        store(out + i, m);
+      }
+      return i;
+    }
+
+    TWENTY48_TARGET_AVX512
+    static size_t move_rows_batch(const nybbles_t *in, nybbles_t *out,
+      size_t n, const uint16_t *line_table)
+    {
+      size_t i = 0;
+      for (; i + 8 <= n; i += 8) {
+        __m512i x = load(in + i);
+        __m512i result = _mm512_setzero_si512();
+        for (size_t y = 0; y < size; ++y) {
+          __m512i row = mask(
+            _mm512_srli_epi64(x, 4 * size * y), state_type::ROW_MASK);
+          __m512i moved = mask(
+            _mm512_i64gather_epi64(row, line_table, 2), 0xFFFF);
+          result = _mm512_or_si512(result,
+            _mm512_slli_epi64(moved, 4 * size * y));
+        }
+        store(out + i, result);
+      }
+      return i;
+    }
+
+    TWENTY48_TARGET_AVX512
+    static size_t move_cols_batch(const nybbles_t *in, nybbles_t *out,
+      size_t n, const nybbles_t *col_table)
+    {
+      size_t i = 0;
+      for (; i + 8 <= n; i += 8) {
+        __m512i x = transpose(load(in + i));
+        __m512i result = _mm512_setzero_si512();
+        for (size_t y = 0; y < size; ++y) {
+          __m512i col = mask(
+            _mm512_srli_epi64(x, 4 * size * y), state_type::ROW_MASK);
+          __m512i moved = _mm512_i64gather_epi64(col, col_table, 8);
+          result = _mm512_or_si512(result, _mm512_slli_epi64(moved, 4 * y));
+        }
+        store(out + i, result);
+      }
+      return i;
+    }
+
+    TWENTY48_TARGET_AVX512
+    static size_t lose_batch(const nybbles_t *in, uint8_t *out, size_t n) {
+      const __m512i ones = _mm512_set1_epi64(state_type::ONES_MASK);
+      size_t i = 0;
+      for (; i + 8 <= n; i += 8) {
+        __m512i x = load(in + i);
+        __mmask8 full = _mm512_cmpeq_epi64_mask(non_zero(x), ones);
+        __m512i left_equal = _mm512_andnot_si512(
+          non_zero(_mm512_xor_si512(_mm512_srli_epi64(x, 4), x)),
+          _mm512_set1_epi64(state_type::HAS_LEFT_MASK));
+        __m512i up_equal = _mm512_andnot_si512(
+          non_zero(_mm512_xor_si512(_mm512_srli_epi64(x, 4 * size), x)),
+          _mm512_set1_epi64(state_type::HAS_UP_MASK));
+        __m512i equal = _mm512_or_si512(left_equal, up_equal);
+        __mmask8 no_equal = _mm512_testn_epi64_mask(equal, equal);
+        __mmask8 empty = _mm512_testn_epi64_mask(x, x);
+        int bits = (full & no_equal) | empty;
+        for (size_t k = 0; k < 8; ++k) out[i + k] = (bits >> k) & 1;
+      }
+      return i;
+    }
+
+    TWENTY48_TARGET_AVX512
+    static size_t sum_batch(const nybbles_t *in, int *out, size_t n) {
+      const __m512i low_bytes = _mm512_broadcast_i32x4(_mm_setr_epi8(
+        0, 2, 4, 8, 16, 32, (char)64, (char)128,
+        0, 0, 0, 0, 0, 0, 0, 0));
+      const __m512i high_bytes = _mm512_broadcast_i32x4(_mm_setr_epi8(
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 2, 4, 8, 16, 32, (char)64, (char)128));
+      const __m512i zero = _mm512_setzero_si512();
+      size_t i = 0;
+      for (; i + 8 <= n; i += 8) {
+        __m512i x = load(in + i);
+        __m512i lo = mask(x, 0x0F0F0F0F0F0F0F0FULL);
+        __m512i hi = mask(_mm512_srli_epi64(x, 4), 0x0F0F0F0F0F0F0F0FULL);
+        __m512i low_sum = _mm512_add_epi64(
+          _mm512_sad_epu8(_mm512_shuffle_epi8(low_bytes, lo), zero),
+          _mm512_sad_epu8(_mm512_shuffle_epi8(low_bytes, hi), zero));
+        __m512i high_sum = _mm512_add_epi64(
+          _mm512_sad_epu8(_mm512_shuffle_epi8(high_bytes, lo), zero),
+          _mm512_sad_epu8(_mm512_shuffle_epi8(high_bytes, hi), zero));
+        __m512i sum = _mm512_add_epi64(low_sum,
+          _mm512_slli_epi64(high_sum, 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+          _mm512_cvtepi64_epi32(sum));
+      }
+      return i;
+    }
+
+    TWENTY48_TARGET_AVX512
+    static size_t max_value_batch(const nybbles_t *in, uint8_t *out,
+      size_t n)
+    {
+      size_t i = 0;
+      for (; i + 8 <= n; i += 8) {
+        __m512i x = load(in + i);
+        __m512i m = _mm512_max_epu8(mask(x, 0x0F0F0F0F0F0F0F0FULL),
+          mask(_mm512_srli_epi64(x, 4), 0x0F0F0F0F0F0F0F0FULL));
+        m = _mm512_max_epu8(m, _mm512_srli_epi64(m, 32));
+        m = _mm512_max_epu8(m, _mm512_srli_epi64(m, 16));
+        m = _mm512_max_epu8(m, _mm512_srli_epi64(m, 8));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + i),
+          _mm512_cvtepi64_epi8(m));
+      }
+      return i;
+    }
+
+  private:
+    TWENTY48_TARGET_AVX512
+    static __m512i mask(__m512i x, nybbles_t mask) {
+      return _mm512_and_si512(x, _mm512_set1_epi64(mask));
+    }
+
+    TWENTY48_TARGET_AVX512
+    static __m512i load(const nybbles_t *in) {
+      return _mm512_loadu_si512(in);
+    }
+
+    TWENTY48_TARGET_AVX512
+    static void store(nybbles_t *out, __m512i x) {
+      _mm512_storeu_si512(out, x);
+    }
+
+    TWENTY48_TARGET_AVX512
+    static __m512i non_zero(__m512i v) {
+      const __m512i sevens = _mm512_set1_epi64(0x7777777777777777ULL);
+      return mask(_mm512_srli_epi64(_mm512_or_si512(
+        _mm512_add_epi64(_mm512_and_si512(v, sevens), sevens), v), 3),
+        state_type::ONES_MASK);
+    }
+  };
+}
+
+#pragma GCC diagnostic pop
+
+#endif
+
+#define TWENTY48_STATE_AVX512_HPP
+#endif
@@ -0,0 +1,243 @@
+#ifndef TWENTY48_STATE_BATCH_HPP
+
+#include <vector>
+
+#include "twenty48.hpp"
+#include "cpu_features.hpp"
+#include "state.hpp"
+#include "state_avx2.hpp"
+#include "state_avx512.hpp"
+
+namespace twenty48 {
+  /**
+   * Operations on arrays of states, stored as contiguous nybbles. Each one
+   * gives the same results as calling the corresponding state_t method on
+   * each state in turn, but it uses the AVX2 or AVX-512 kernels when the CPU
+   * supports them, and the scalar code for any leftover states.
+   *
+   * The kernel is chosen by `isa`, which defaults to the best one that the
+   * CPU supports (see cpu_isa); it must not be better than that.
+   *
+   * For the operations that output states, it is safe for `in` and `out` to
+   * be the same buffer.
+   */
+  template <int size> struct state_batch_t {
+    typedef uint64_t nybbles_t;
+
+    static void move_batch(const nybbles_t *in, nybbles_t *out, size_t n,
+      direction_t direction, cpu_isa_t isa = cpu_isa())
+    {
+      switch(direction) {
+        case DIRECTION_LEFT:
+          move_rows_batch(in, out, n, line_t<size>::TABLE.table, isa);
+          return;
+        case DIRECTION_RIGHT:
+          move_rows_batch(in, out, n, line_t<size>::TABLE.reverse_table, isa);
+          return;
+        case DIRECTION_UP:
+          move_cols_batch(in, out, n, state_t<size>::COL_TABLE.table, isa);
+          return;
+        case DIRECTION_DOWN:
+          move_cols_batch(in, out, n,
+            state_t<size>::COL_TABLE.reverse_table, isa);
+          return;
+      }
+      throw std::invalid_argument("bad direction");
+    }
+
+    static void canonicalize_batch(const nybbles_t *in, nybbles_t *out,
+      size_t n, cpu_isa_t isa = cpu_isa())
+    {
+      size_t i = 0;
+      switch(isa) {
+#if TWENTY48_HAVE_AVX512_TARGET
+        case CPU_ISA_AVX512:
+          i = state_avx512_t<size>::canonicalize_batch(in, out, n);
+          break;
+#endif
+#if TWENTY48_HAVE_AVX2_TARGET
+        case CPU_ISA_AVX2:
+          i = state_avx2_t<size>::canonicalize_batch(in, out, n);
+          break;
+#endif
+        default:
+          break;
+      }
+      for (; i < n; ++i) out[i] = state_t<size>(in[i]).canonicalize().nybbles;
+    }
+
+    static void lose_batch(const nybbles_t *in, uint8_t *out, size_t n,
+      cpu_isa_t isa = cpu_isa())
+    {
+      size_t i = 0;
+      switch(isa) {
+#if TWENTY48_HAVE_AVX512_TARGET
+        case CPU_ISA_AVX512:
+          i = state_avx512_t<size>::lose_batch(in, out, n);
+          break;
+#endif
+#if TWENTY48_HAVE_AVX2_TARGET
+        case CPU_ISA_AVX2:
+          i = state_avx2_t<size>::lose_batch(in, out, n);
+          break;
+#endif
+        default:
+          break;
+      }
+      for (; i < n; ++i) out[i] = state_t<size>(in[i]).lose();
+    }
+
+    static void sum_batch(const nybbles_t *in, int *out, size_t n,
+      cpu_isa_t isa = cpu_isa())
+    {
+      size_t i = 0;
+      switch(isa) {
+#if TWENTY48_HAVE_AVX512_TARGET
+        case CPU_ISA_AVX512:
+          i = state_avx512_t<size>::sum_batch(in, out, n);
+          break;
+#endif
+#if TWENTY48_HAVE_AVX2_TARGET
+        case CPU_ISA_AVX2:
+          i = state_avx2_t<size>::sum_batch(in, out, n);
+          break;
+#endif
+        default:
+          break;
+      }
+      for (; i < n; ++i) out[i] = state_t<size>(in[i]).sum();
+    }
+
+    static void max_value_batch(const nybbles_t *in, uint8_t *out, size_t n,
+      cpu_isa_t isa = cpu_isa())
+    {
+      size_t i = 0;
+      switch(isa) {
+#if TWENTY48_HAVE_AVX512_TARGET
+        case CPU_ISA_AVX512:
+          i = state_avx512_t<size>::max_value_batch(in, out, n);
+          break;
+#endif
+#if TWENTY48_HAVE_AVX2_TARGET
+        case CPU_ISA_AVX2:
+          i = state_avx2_t<size>::max_value_batch(in, out, n);
+          break;
+#endif
+        default:
+          break;
+      }
+      for (; i < n; ++i) out[i] = state_t<size>(in[i]).max_value();
+    }
+
+  private:
+    static void move_rows_batch(const nybbles_t *in, nybbles_t *out,
+      size_t n, const uint16_t *line_table, cpu_isa_t isa)
+    {
+      size_t i = 0;
+      switch(isa) {
+#if TWENTY48_HAVE_AVX512_TARGET
+        case CPU_ISA_AVX512:
+          i = state_avx512_t<size>::move_rows_batch(in, out, n, line_table);
+          break;
+#endif
+#if TWENTY48_HAVE_AVX2_TARGET
+        case CPU_ISA_AVX2:
+          i = state_avx2_t<size>::move_rows_batch(in, out, n, line_table);
+          break;
+#endif
+        default:
+          break;
+      }
+      for (; i < n; ++i) {
+        out[i] = state_t<size>(in[i]).move_rows(line_table).nybbles;
+      }
+    }
+
+    static void move_cols_batch(const nybbles_t *in, nybbles_t *out,
+      size_t n, const nybbles_t *col_table, cpu_isa_t isa)
+    {
+      size_t i = 0;
+      switch(isa) {
+#if TWENTY48_HAVE_AVX512_TARGET
+        case CPU_ISA_AVX512:
+          i = state_avx512_t<size>::move_cols_batch(in, out, n, col_table);
+          break;
+#endif
+#if TWENTY48_HAVE_AVX2_TARGET
+        case CPU_ISA_AVX2:
+          i = state_avx2_t<size>::move_cols_batch(in, out, n, col_table);
+          break;
+#endif
+        default:
+          break;
+      }
+      for (; i < n; ++i) {
+        out[i] = state_t<size>(in[i]).transpose().move_cols(col_table).nybbles;
+      }
+    }
+  };
+
+  /**
+   * A block of states, as read in order from a layer file, and the results
+   * of moving each of them in each direction. This lets the builder and
+   * solver feed their input states through the batch kernels a few thousand
+   * at a time.
+   */
+  template <int size> struct state_block_t {
+    typedef uint64_t nybbles_t;
+
+    static const size_t DEFAULT_CAPACITY = 4096;
+
+    explicit state_block_t(size_t capacity = DEFAULT_CAPACITY) :
+      length(0), states(capacity) {
+      for (size_t i = 0; i < 4; ++i) moved_states[i].resize(capacity);
+    }
+
+    /**
+     * Read states until the block is full or the reader has no more states.
+     * Returns the number of states read.
+     */
+    template <typename Reader> size_t read(Reader &reader) {
+      length = reader.read_batch(states.data(), states.size());
+      return length;
+    }
+
+    /**
+     * Move all states in the block in all four directions.
+     */
+    void move_all() {
+      for (size_t i = 0; i < 4; ++i) {
+        state_batch_t<size>::move_batch(
+          states.data(), moved_states[i].data(), length, (direction_t)i);
+      }
+    }
+
+    size_t get_length() const {
+      return length;
+    }
+
+    nybbles_t get_nybbles(size_t i) const {
+      return states[i];
+    }
+
+    /**
+     * Does state `i` change when moved in the given direction? Only valid
+     * after move_all.
+     */
+    bool moved(size_t i, direction_t direction) const {
+      return moved_states[direction][i] != states[i];
+    }
+
+    state_t<size> get_moved_state(size_t i, direction_t direction) const {
+      return state_t<size>(moved_states[direction][i]);
+    }
+
+  private:
+    size_t length;
+    std::vector<nybbles_t> states;
+    std::vector<nybbles_t> moved_states[4];
+  };
+}
+
+#define TWENTY48_STATE_BATCH_HPP
+#endif
@@ -0,0 +1,131 @@
+#ifndef TWENTY48_THREADS_HPP
+
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "twenty48.hpp"
+
+namespace twenty48 {
+  /**
+   * Call `f(i)` for each i in [0, num_threads), each on its own thread; the
+   * first call runs on the calling thread. Returns when all calls are done.
+   * If any call throws, the first exception is rethrown on the calling thread.
+   */
+  template <typename F>
+  void run_threads(size_t num_threads, F f) {
+    std::vector<std::exception_ptr> errors(num_threads);
+    auto run = [&f, &errors](size_t i) {
+      try {
+        f(i);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; ++i) {
+      threads.push_back(std::thread(run, i));
+    }
+    run(0);
+    for (size_t i = 0; i < threads.size(); ++i) threads[i].join();
+
+    for (size_t i = 0; i < num_threads; ++i) {
+      if (errors[i]) std::rethrow_exception(errors[i]);
+    }
+  }
+
+  /**
+   * The number of threads to use by default: one per core.
+   */
+  inline size_t default_num_threads() {
+    size_t num_threads = std::thread::hardware_concurrency();
+    return num_threads > 0 ? num_threads : 1;
+  }
+
+  /**
+   * Hand out the tasks [0, num_tasks) to workers [0, num_workers). Each worker
+   * starts with a contiguous range of the tasks, which it works through from
+   * the front. When its range is empty, it steals the back half of the
+   * largest range that another worker has left. That keeps each worker on
+   * neighbouring tasks for as long as possible, which matters when the tasks
+   * are batches of states from a sorted layer file.
+   */
+  struct work_queue_t {
+    work_queue_t(size_t num_tasks, size_t num_workers) : ranges(num_workers) {
+      for (size_t i = 0; i < num_workers; ++i) {
+        ranges[i].begin = num_tasks * i / num_workers;
+        ranges[i].end = num_tasks * (i + 1) / num_workers;
+      }
+    }
+
+    /**
+     * Get the next task for the given worker. Returns false when there are no
+     * tasks left.
+     */
+    bool pop(size_t worker, size_t &task) {
+      if (ranges[worker].pop(task)) return true;
+
+      for (;;) {
+        size_t victim = ranges.size();
+        size_t max_remaining = 0;
+        for (size_t i = 0; i < ranges.size(); ++i) {
+          size_t remaining = ranges[i].remaining();
+          if (remaining > max_remaining) {
+            victim = i;
+            max_remaining = remaining;
+          }
+        }
+        if (victim == ranges.size()) return false;
+
+        size_t begin, end;
+        if (!ranges[victim].steal(begin, end)) continue;
+        task = begin;
+        ranges[worker].reset(begin + 1, end);
+        return true;
+      }
+    }
+
+  private:
+    struct range_t {
+      range_t() : begin(0), end(0) { }
+
+      bool pop(size_t &task) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (begin == end) return false;
+        task = begin++;
+        return true;
+      }
+
+      size_t remaining() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return end - begin;
+      }
+
+      bool steal(size_t &stolen_begin, size_t &stolen_end) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (begin == end) return false;
+        stolen_end = end;
+        end -= (end - begin + 1) / 2;
+        stolen_begin = end;
+        return true;
+      }
+
+      void reset(size_t new_begin, size_t new_end) {
+        std::lock_guard<std::mutex> lock(mutex);
+        begin = new_begin;
+        end = new_end;
+      }
+
+      std::mutex mutex;
+      size_t begin;
+      size_t end;
+    };
+
+    std::vector<range_t> ranges;
+  };
+}
+
+#define TWENTY48_THREADS_HPP
+#endif
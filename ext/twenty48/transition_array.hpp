@@ -0,0 +1,73 @@
+#ifndef TWENTY48_TRANSITION_ARRAY_HPP
+
+#include <utility>
+
+#include "twenty48.hpp"
+
+namespace twenty48 {
+  /**
+   * A fixed-capacity list of (state, probability) transitions, for use in the
+   * inner loops instead of a std::map, which allocates a node per successor.
+   * It is iterated like the map: in ascending order of state, with each
+   * state appearing only once.
+   *
+   * Fill it with `push_back` and then call `sort_and_merge`, which sorts the
+   * entries and adds up the probabilities for any duplicate states.
+   */
+  template <typename State, size_t capacity> struct transition_array_t {
+    typedef std::pair<State, double> value_type;
+    typedef const value_type *const_iterator;
+
+    transition_array_t() : length(0) { }
+
+    const_iterator begin() const { return data; }
+    const_iterator end() const { return data + length; }
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    void clear() { length = 0; }
+
+    void push_back(const State &state, double probability) {
+      data[length].first = state;
+      data[length].second = probability;
+      ++length;
+    }
+
+    /**
+     * There are at most a few dozen transitions, so an insertion sort is
+     * quick; std::sort does the same below 16 entries. Unlike std::sort, it
+     * also keeps GCC's -Warray-bounds quiet: GCC cannot see that std::sort's
+     * partitioning code never runs on the 8-entry arrays for the 2x2 board.
+     */
+    void sort_and_merge() {
+      for (size_t i = 1; i < length; ++i) {
+        value_type entry = data[i];
+        size_t j = i;
+        for (; j > 0 && compare_states(entry, data[j - 1]); --j) {
+          data[j] = data[j - 1];
+        }
+        data[j] = entry;
+      }
+      size_t merged = 0;
+      for (size_t i = 0; i < length; ++i) {
+        if (merged > 0 && data[merged - 1].first == data[i].first) {
+          data[merged - 1].second += data[i].second;
+        } else {
+          data[merged++] = data[i];
+        }
+      }
+      length = merged;
+    }
+
+  private:
+    value_type data[capacity];
+    size_t length;
+
+    static bool compare_states(const value_type &a, const value_type &b) {
+      return a.first < b.first;
+    }
+  };
+}
+
+#define TWENTY48_TRANSITION_ARRAY_HPP
+#endif
@@ -4,6 +4,7 @@
 #include <sstream>
 #include "line.hpp"
 #include "state.hpp"
+#include "batch_checkpoint.hpp"
 #include "layer_builder.hpp"
 #include "layer_q_solver.hpp"
 #include "layer_solver.hpp"
@@ -103,18 +104,6 @@
 %template(Valuer3) twenty48::valuer_t<3>;
 %template(Valuer4) twenty48::valuer_t<4>;
 
-/******************************************************************************/
-/* LayerBuilder */
-/******************************************************************************/
-
-%include "layer_builder.hpp"
-
-%template(LayerBuilder2) twenty48::layer_builder_t<2>;
-%template(LayerBuilder3) twenty48::layer_builder_t<3>;
-%template(LayerBuilder4) twenty48::layer_builder_t<4>;
-
-%template(StringVector) std::vector<std::string>;
-
 /******************************************************************************/
 /* LayerStorage */
 /******************************************************************************/
@@ -133,10 +122,24 @@
 
 %include "vbyte_writer.hpp"
 
+%template(StringVector) std::vector<std::string>;
+
 %include "merge_states.hpp"
 
 %include "merge_state_probabilities.hpp"
 
+%include "batch_checkpoint.hpp"
+
+/******************************************************************************/
+/* LayerBuilder */
+/******************************************************************************/
+
+%include "layer_builder.hpp"
+
+%template(LayerBuilder2) twenty48::layer_builder_t<2>;
+%template(LayerBuilder3) twenty48::layer_builder_t<3>;
+%template(LayerBuilder4) twenty48::layer_builder_t<4>;
+
 /******************************************************************************/
 /* LayerSolver */
 /******************************************************************************/
@@ -1953,6 +1953,7 @@ static VALUE mTwenty48;
 #include <sstream>
 #include "line.hpp"
 #include "state.hpp"
+#include "batch_checkpoint.hpp"
 #include "layer_builder.hpp"
 #include "layer_q_solver.hpp"
 #include "layer_solver.hpp"
@@ -13349,6 +13350,30 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_Line2_reverse(int argc, VALUE *argv, VALUE self) {
+  twenty48::line_t< 2 > *arg1 = (twenty48::line_t< 2 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  twenty48::line_t< 2 > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__line_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::line_t< 2 > const *","reverse", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::line_t< 2 > * >(argp1);
+  result = ((twenty48::line_t< 2 > const *)arg1)->reverse();
+  vresult = SWIG_NewPointerObj((new twenty48::line_t< 2 >(static_cast< const twenty48::line_t< 2 >& >(result))), SWIGTYPE_p_twenty48__line_tT_2_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Line2_lookup_move__SWIG_0(int argc, VALUE *argv, VALUE self) {
   uint16_t arg1 ;
@@ -13439,6 +13464,30 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_Line2_lookup_reverse_move(int argc, VALUE *argv, VALUE self) {
+  uint16_t arg1 ;
+  unsigned short val1 ;
+  int ecode1 = 0 ;
+  uint16_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_short(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint16_t","twenty48::line_t<(2)>::lookup_reverse_move", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint16_t >(val1);
+  result = (uint16_t)twenty48::line_t< 2 >::SWIGTEMPLATEDISAMBIGUATOR lookup_reverse_move(arg1);
+  vresult = SWIG_From_unsigned_SS_short(static_cast< unsigned short >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Line2_get_nybble(int argc, VALUE *argv, VALUE self) {
   uint16_t arg1 ;
@@ -13846,6 +13895,30 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_Line3_reverse(int argc, VALUE *argv, VALUE self) {
+  twenty48::line_t< 3 > *arg1 = (twenty48::line_t< 3 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  twenty48::line_t< 3 > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__line_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::line_t< 3 > const *","reverse", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::line_t< 3 > * >(argp1);
+  result = ((twenty48::line_t< 3 > const *)arg1)->reverse();
+  vresult = SWIG_NewPointerObj((new twenty48::line_t< 3 >(static_cast< const twenty48::line_t< 3 >& >(result))), SWIGTYPE_p_twenty48__line_tT_3_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Line3_lookup_move__SWIG_0(int argc, VALUE *argv, VALUE self) {
   uint16_t arg1 ;
@@ -13936,6 +14009,30 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_Line3_lookup_reverse_move(int argc, VALUE *argv, VALUE self) {
+  uint16_t arg1 ;
+  unsigned short val1 ;
+  int ecode1 = 0 ;
+  uint16_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_short(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint16_t","twenty48::line_t<(3)>::lookup_reverse_move", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint16_t >(val1);
+  result = (uint16_t)twenty48::line_t< 3 >::SWIGTEMPLATEDISAMBIGUATOR lookup_reverse_move(arg1);
+  vresult = SWIG_From_unsigned_SS_short(static_cast< unsigned short >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Line3_get_nybble(int argc, VALUE *argv, VALUE self) {
   uint16_t arg1 ;
@@ -14343,6 +14440,30 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_Line4_reverse(int argc, VALUE *argv, VALUE self) {
+  twenty48::line_t< 4 > *arg1 = (twenty48::line_t< 4 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  twenty48::line_t< 4 > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__line_tT_4_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::line_t< 4 > const *","reverse", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::line_t< 4 > * >(argp1);
+  result = ((twenty48::line_t< 4 > const *)arg1)->reverse();
+  vresult = SWIG_NewPointerObj((new twenty48::line_t< 4 >(static_cast< const twenty48::line_t< 4 >& >(result))), SWIGTYPE_p_twenty48__line_tT_4_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Line4_lookup_move__SWIG_0(int argc, VALUE *argv, VALUE self) {
   uint16_t arg1 ;
@@ -14433,6 +14554,30 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_Line4_lookup_reverse_move(int argc, VALUE *argv, VALUE self) {
+  uint16_t arg1 ;
+  unsigned short val1 ;
+  int ecode1 = 0 ;
+  uint16_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_short(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint16_t","twenty48::line_t<(4)>::lookup_reverse_move", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint16_t >(val1);
+  result = (uint16_t)twenty48::line_t< 4 >::SWIGTEMPLATEDISAMBIGUATOR lookup_reverse_move(arg1);
+  vresult = SWIG_From_unsigned_SS_short(static_cast< unsigned short >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Line4_get_nybble(int argc, VALUE *argv, VALUE self) {
   uint16_t arg1 ;
@@ -16946,6 +17091,62 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_State2_can_move(int argc, VALUE *argv, VALUE self) {
+  twenty48::state_t< 2 > *arg1 = (twenty48::state_t< 2 > *) 0 ;
+  twenty48::direction_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  bool result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__state_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::state_t< 2 > const *","can_move", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::state_t< 2 > * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "twenty48::direction_t","can_move", 2, argv[0] ));
+  } 
+  arg2 = static_cast< twenty48::direction_t >(val2);
+  result = (bool)((twenty48::state_t< 2 > const *)arg1)->can_move(arg2);
+  vresult = SWIG_From_bool(static_cast< bool >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_State2_legal_moves(int argc, VALUE *argv, VALUE self) {
+  twenty48::state_t< 2 > *arg1 = (twenty48::state_t< 2 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__state_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::state_t< 2 > const *","legal_moves", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::state_t< 2 > * >(argp1);
+  result = (int)((twenty48::state_t< 2 > const *)arg1)->legal_moves();
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_State2_max_value(int argc, VALUE *argv, VALUE self) {
   twenty48::state_t< 2 > *arg1 = (twenty48::state_t< 2 > *) 0 ;
@@ -17392,6 +17593,30 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_State2_adjacent_pairs(int argc, VALUE *argv, VALUE self) {
+  twenty48::state_t< 2 > *arg1 = (twenty48::state_t< 2 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint16_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__state_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::state_t< 2 > const *","adjacent_pairs", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::state_t< 2 > * >(argp1);
+  result = (uint16_t)((twenty48::state_t< 2 > const *)arg1)->adjacent_pairs();
+  vresult = SWIG_From_unsigned_SS_short(static_cast< unsigned short >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 
 /*
   Document-method: Twenty48::State2.==
@@ -17809,6 +18034,62 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_State3_can_move(int argc, VALUE *argv, VALUE self) {
+  twenty48::state_t< 3 > *arg1 = (twenty48::state_t< 3 > *) 0 ;
+  twenty48::direction_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  bool result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__state_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::state_t< 3 > const *","can_move", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::state_t< 3 > * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "twenty48::direction_t","can_move", 2, argv[0] ));
+  } 
+  arg2 = static_cast< twenty48::direction_t >(val2);
+  result = (bool)((twenty48::state_t< 3 > const *)arg1)->can_move(arg2);
+  vresult = SWIG_From_bool(static_cast< bool >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_State3_legal_moves(int argc, VALUE *argv, VALUE self) {
+  twenty48::state_t< 3 > *arg1 = (twenty48::state_t< 3 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__state_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::state_t< 3 > const *","legal_moves", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::state_t< 3 > * >(argp1);
+  result = (int)((twenty48::state_t< 3 > const *)arg1)->legal_moves();
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_State3_max_value(int argc, VALUE *argv, VALUE self) {
   twenty48::state_t< 3 > *arg1 = (twenty48::state_t< 3 > *) 0 ;
@@ -18255,6 +18536,30 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_State3_adjacent_pairs(int argc, VALUE *argv, VALUE self) {
+  twenty48::state_t< 3 > *arg1 = (twenty48::state_t< 3 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint16_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__state_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::state_t< 3 > const *","adjacent_pairs", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::state_t< 3 > * >(argp1);
+  result = (uint16_t)((twenty48::state_t< 3 > const *)arg1)->adjacent_pairs();
+  vresult = SWIG_From_unsigned_SS_short(static_cast< unsigned short >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 
 /*
   Document-method: Twenty48::State3.==
@@ -18672,6 +18977,62 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_State4_can_move(int argc, VALUE *argv, VALUE self) {
+  twenty48::state_t< 4 > *arg1 = (twenty48::state_t< 4 > *) 0 ;
+  twenty48::direction_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  bool result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__state_tT_4_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::state_t< 4 > const *","can_move", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::state_t< 4 > * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "twenty48::direction_t","can_move", 2, argv[0] ));
+  } 
+  arg2 = static_cast< twenty48::direction_t >(val2);
+  result = (bool)((twenty48::state_t< 4 > const *)arg1)->can_move(arg2);
+  vresult = SWIG_From_bool(static_cast< bool >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_State4_legal_moves(int argc, VALUE *argv, VALUE self) {
+  twenty48::state_t< 4 > *arg1 = (twenty48::state_t< 4 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__state_tT_4_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::state_t< 4 > const *","legal_moves", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::state_t< 4 > * >(argp1);
+  result = (int)((twenty48::state_t< 4 > const *)arg1)->legal_moves();
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_State4_max_value(int argc, VALUE *argv, VALUE self) {
   twenty48::state_t< 4 > *arg1 = (twenty48::state_t< 4 > *) 0 ;
@@ -19118,6 +19479,30 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_State4_adjacent_pairs(int argc, VALUE *argv, VALUE self) {
+  twenty48::state_t< 4 > *arg1 = (twenty48::state_t< 4 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint16_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__state_tT_4_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::state_t< 4 > const *","adjacent_pairs", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::state_t< 4 > * >(argp1);
+  result = (uint16_t)((twenty48::state_t< 4 > const *)arg1)->adjacent_pairs();
+  vresult = SWIG_From_unsigned_SS_short(static_cast< unsigned short >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 
 /*
   Document-method: Twenty48::State4.==
@@ -30159,6 +30544,53 @@ free_std_map_Sl_twenty48_state_t_Sl_4_Sg__Sc_double_Sg_(void *self) {
 
 static swig_class SwigClassValuer2;
 
+SWIGINTERN VALUE
+_wrap_new_Valuer2__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int arg2 ;
+  double arg3 ;
+  size_t arg4 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  size_t val4 ;
+  int ecode4 = 0 ;
+  twenty48::valuer_t< 2 > *result = 0 ;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","valuer_t<(2)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","valuer_t<(2)>", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_double(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "double","valuer_t<(2)>", 3, argv[2] ));
+  } 
+  arg3 = static_cast< double >(val3);
+  ecode4 = SWIG_AsVal_size_t(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","valuer_t<(2)>", 4, argv[3] ));
+  } 
+  arg4 = static_cast< size_t >(val4);
+  result = (twenty48::valuer_t< 2 > *)new twenty48::valuer_t< 2 >(arg1,arg2,arg3,arg4);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 #ifdef HAVE_RB_DEFINE_ALLOC_FUNC
 _wrap_Valuer2_allocate(VALUE self)
@@ -30175,7 +30607,7 @@ _wrap_Valuer2_allocate(int argc, VALUE *argv, VALUE self)
 
 
 SWIGINTERN VALUE
-_wrap_new_Valuer2(int argc, VALUE *argv, VALUE self) {
+_wrap_new_Valuer2__SWIG_1(int argc, VALUE *argv, VALUE self) {
   int arg1 ;
   int arg2 ;
   double arg3 ;
@@ -30213,6 +30645,76 @@ fail:
 }
 
 
+SWIGINTERN VALUE _wrap_new_Valuer2(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[4];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 4) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 3) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_new_Valuer2__SWIG_1(nargs, args, self);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_size_t(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_new_Valuer2__SWIG_0(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 4, "Valuer2.new", 
+    "    Valuer2.new(int max_exponent, int max_depth, double discount, size_t cache_size)\n"
+    "    Valuer2.new(int max_exponent, int max_depth, double discount)\n");
+  
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Valuer2_get_max_exponent(int argc, VALUE *argv, VALUE self) {
   twenty48::valuer_t< 2 > *arg1 = (twenty48::valuer_t< 2 > *) 0 ;
@@ -30285,6 +30787,99 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_Valuer2_get_cache_size(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 2 > *arg1 = (twenty48::valuer_t< 2 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 2 > const *","get_cache_size", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 2 > * >(argp1);
+  result = ((twenty48::valuer_t< 2 > const *)arg1)->get_cache_size();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Valuer2_get_cache_hits(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 2 > *arg1 = (twenty48::valuer_t< 2 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 2 > const *","get_cache_hits", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 2 > * >(argp1);
+  result = ((twenty48::valuer_t< 2 > const *)arg1)->get_cache_hits();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Valuer2_get_cache_misses(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 2 > *arg1 = (twenty48::valuer_t< 2 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 2 > const *","get_cache_misses", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 2 > * >(argp1);
+  result = ((twenty48::valuer_t< 2 > const *)arg1)->get_cache_misses();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Valuer2_clear_cache(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 2 > *arg1 = (twenty48::valuer_t< 2 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 2 > *","clear_cache", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 2 > * >(argp1);
+  (arg1)->clear_cache();
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Valuer2_value(int argc, VALUE *argv, VALUE self) {
   twenty48::valuer_t< 2 > *arg1 = (twenty48::valuer_t< 2 > *) 0 ;
@@ -30328,6 +30923,53 @@ free_twenty48_valuer_t_Sl_2_Sg_(void *self) {
 
 static swig_class SwigClassValuer3;
 
+SWIGINTERN VALUE
+_wrap_new_Valuer3__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int arg2 ;
+  double arg3 ;
+  size_t arg4 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  size_t val4 ;
+  int ecode4 = 0 ;
+  twenty48::valuer_t< 3 > *result = 0 ;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","valuer_t<(3)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","valuer_t<(3)>", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_double(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "double","valuer_t<(3)>", 3, argv[2] ));
+  } 
+  arg3 = static_cast< double >(val3);
+  ecode4 = SWIG_AsVal_size_t(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","valuer_t<(3)>", 4, argv[3] ));
+  } 
+  arg4 = static_cast< size_t >(val4);
+  result = (twenty48::valuer_t< 3 > *)new twenty48::valuer_t< 3 >(arg1,arg2,arg3,arg4);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 #ifdef HAVE_RB_DEFINE_ALLOC_FUNC
 _wrap_Valuer3_allocate(VALUE self)
@@ -30344,7 +30986,7 @@ _wrap_Valuer3_allocate(int argc, VALUE *argv, VALUE self)
 
 
 SWIGINTERN VALUE
-_wrap_new_Valuer3(int argc, VALUE *argv, VALUE self) {
+_wrap_new_Valuer3__SWIG_1(int argc, VALUE *argv, VALUE self) {
   int arg1 ;
   int arg2 ;
   double arg3 ;
@@ -30382,6 +31024,76 @@ fail:
 }
 
 
+SWIGINTERN VALUE _wrap_new_Valuer3(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[4];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 4) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 3) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_new_Valuer3__SWIG_1(nargs, args, self);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_size_t(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_new_Valuer3__SWIG_0(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 4, "Valuer3.new", 
+    "    Valuer3.new(int max_exponent, int max_depth, double discount, size_t cache_size)\n"
+    "    Valuer3.new(int max_exponent, int max_depth, double discount)\n");
+  
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Valuer3_get_max_exponent(int argc, VALUE *argv, VALUE self) {
   twenty48::valuer_t< 3 > *arg1 = (twenty48::valuer_t< 3 > *) 0 ;
@@ -30454,6 +31166,99 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_Valuer3_get_cache_size(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 3 > *arg1 = (twenty48::valuer_t< 3 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 3 > const *","get_cache_size", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 3 > * >(argp1);
+  result = ((twenty48::valuer_t< 3 > const *)arg1)->get_cache_size();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Valuer3_get_cache_hits(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 3 > *arg1 = (twenty48::valuer_t< 3 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 3 > const *","get_cache_hits", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 3 > * >(argp1);
+  result = ((twenty48::valuer_t< 3 > const *)arg1)->get_cache_hits();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Valuer3_get_cache_misses(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 3 > *arg1 = (twenty48::valuer_t< 3 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 3 > const *","get_cache_misses", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 3 > * >(argp1);
+  result = ((twenty48::valuer_t< 3 > const *)arg1)->get_cache_misses();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Valuer3_clear_cache(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 3 > *arg1 = (twenty48::valuer_t< 3 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 3 > *","clear_cache", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 3 > * >(argp1);
+  (arg1)->clear_cache();
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Valuer3_value(int argc, VALUE *argv, VALUE self) {
   twenty48::valuer_t< 3 > *arg1 = (twenty48::valuer_t< 3 > *) 0 ;
@@ -30497,6 +31302,53 @@ free_twenty48_valuer_t_Sl_3_Sg_(void *self) {
 
 static swig_class SwigClassValuer4;
 
+SWIGINTERN VALUE
+_wrap_new_Valuer4__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int arg2 ;
+  double arg3 ;
+  size_t arg4 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  size_t val4 ;
+  int ecode4 = 0 ;
+  twenty48::valuer_t< 4 > *result = 0 ;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","valuer_t<(4)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","valuer_t<(4)>", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_double(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "double","valuer_t<(4)>", 3, argv[2] ));
+  } 
+  arg3 = static_cast< double >(val3);
+  ecode4 = SWIG_AsVal_size_t(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","valuer_t<(4)>", 4, argv[3] ));
+  } 
+  arg4 = static_cast< size_t >(val4);
+  result = (twenty48::valuer_t< 4 > *)new twenty48::valuer_t< 4 >(arg1,arg2,arg3,arg4);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 #ifdef HAVE_RB_DEFINE_ALLOC_FUNC
 _wrap_Valuer4_allocate(VALUE self)
@@ -30513,7 +31365,7 @@ _wrap_Valuer4_allocate(int argc, VALUE *argv, VALUE self)
 
 
 SWIGINTERN VALUE
-_wrap_new_Valuer4(int argc, VALUE *argv, VALUE self) {
+_wrap_new_Valuer4__SWIG_1(int argc, VALUE *argv, VALUE self) {
   int arg1 ;
   int arg2 ;
   double arg3 ;
@@ -30551,6 +31403,76 @@ fail:
 }
 
 
+SWIGINTERN VALUE _wrap_new_Valuer4(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[4];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 4) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 3) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_new_Valuer4__SWIG_1(nargs, args, self);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_size_t(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_new_Valuer4__SWIG_0(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 4, "Valuer4.new", 
+    "    Valuer4.new(int max_exponent, int max_depth, double discount, size_t cache_size)\n"
+    "    Valuer4.new(int max_exponent, int max_depth, double discount)\n");
+  
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Valuer4_get_max_exponent(int argc, VALUE *argv, VALUE self) {
   twenty48::valuer_t< 4 > *arg1 = (twenty48::valuer_t< 4 > *) 0 ;
@@ -30623,6 +31545,99 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_Valuer4_get_cache_size(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 4 > *arg1 = (twenty48::valuer_t< 4 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_4_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 4 > const *","get_cache_size", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 4 > * >(argp1);
+  result = ((twenty48::valuer_t< 4 > const *)arg1)->get_cache_size();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Valuer4_get_cache_hits(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 4 > *arg1 = (twenty48::valuer_t< 4 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_4_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 4 > const *","get_cache_hits", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 4 > * >(argp1);
+  result = ((twenty48::valuer_t< 4 > const *)arg1)->get_cache_hits();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Valuer4_get_cache_misses(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 4 > *arg1 = (twenty48::valuer_t< 4 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_4_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 4 > const *","get_cache_misses", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 4 > * >(argp1);
+  result = ((twenty48::valuer_t< 4 > const *)arg1)->get_cache_misses();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Valuer4_clear_cache(int argc, VALUE *argv, VALUE self) {
+  twenty48::valuer_t< 4 > *arg1 = (twenty48::valuer_t< 4 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__valuer_tT_4_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::valuer_t< 4 > *","clear_cache", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::valuer_t< 4 > * >(argp1);
+  (arg1)->clear_cache();
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Valuer4_value(int argc, VALUE *argv, VALUE self) {
   twenty48::valuer_t< 4 > *arg1 = (twenty48::valuer_t< 4 > *) 0 ;
@@ -30664,16 +31679,31 @@ free_twenty48_valuer_t_Sl_4_Sg_(void *self) {
     delete arg1;
 }
 
-static swig_class SwigClassLayerBuilder2;
+static swig_class SwigClassVByteIndexEntry;
+
+SWIGINTERN VALUE
+_wrap_new_VByteIndexEntry__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_index_entry_t *result = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  result = (twenty48::vbyte_index_entry_t *)new twenty48::vbyte_index_entry_t();
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
 
 SWIGINTERN VALUE
 #ifdef HAVE_RB_DEFINE_ALLOC_FUNC
-_wrap_LayerBuilder2_allocate(VALUE self)
+_wrap_VByteIndexEntry_allocate(VALUE self)
 #else
-_wrap_LayerBuilder2_allocate(int argc, VALUE *argv, VALUE self)
+_wrap_VByteIndexEntry_allocate(int argc, VALUE *argv, VALUE self)
 #endif
 {
-  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__layer_builder_tT_2_t);
+  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__vbyte_index_entry_t);
 #ifndef HAVE_RB_DEFINE_ALLOC_FUNC
   rb_obj_call_init(vresult, argc, argv);
 #endif
@@ -30682,152 +31712,98 @@ _wrap_LayerBuilder2_allocate(int argc, VALUE *argv, VALUE self)
 
 
 SWIGINTERN VALUE
-_wrap_new_LayerBuilder2(int argc, VALUE *argv, VALUE self) {
-  uint8_t arg1 ;
-  char *arg2 = (char *) 0 ;
-  char *arg3 = (char *) 0 ;
-  char *arg4 = (char *) 0 ;
-  char *arg5 = (char *) 0 ;
-  twenty48::valuer_t< 2 > *arg6 = 0 ;
-  unsigned char val1 ;
+_wrap_new_VByteIndexEntry__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  size_t arg1 ;
+  uint64_t arg2 ;
+  size_t val1 ;
   int ecode1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
-  int res3 ;
-  char *buf3 = 0 ;
-  int alloc3 = 0 ;
-  int res4 ;
-  char *buf4 = 0 ;
-  int alloc4 = 0 ;
-  int res5 ;
-  char *buf5 = 0 ;
-  int alloc5 = 0 ;
-  void *argp6 ;
-  int res6 = 0 ;
-  twenty48::layer_builder_t< 2 > *result = 0 ;
+  unsigned long long val2 ;
+  int ecode2 = 0 ;
+  twenty48::vbyte_index_entry_t *result = 0 ;
   
-  if ((argc < 6) || (argc > 6)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  ecode1 = SWIG_AsVal_size_t(argv[0], &val1);
   if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(2)>", 1, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "size_t","vbyte_index_entry_t", 1, argv[0] ));
   } 
-  arg1 = static_cast< uint8_t >(val1);
-  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 2, argv[1] ));
-  }
-  arg2 = reinterpret_cast< char * >(buf2);
-  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 3, argv[2] ));
-  }
-  arg3 = reinterpret_cast< char * >(buf3);
-  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
-  if (!SWIG_IsOK(res4)) {
-    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 4, argv[3] ));
-  }
-  arg4 = reinterpret_cast< char * >(buf4);
-  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
-  if (!SWIG_IsOK(res5)) {
-    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 5, argv[4] ));
-  }
-  arg5 = reinterpret_cast< char * >(buf5);
-  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_2_t,  0 );
-  if (!SWIG_IsOK(res6)) {
-    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 2 > const &","layer_builder_t<(2)>", 6, argv[5] )); 
-  }
-  if (!argp6) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 2 > const &","layer_builder_t<(2)>", 6, argv[5])); 
-  }
-  arg6 = reinterpret_cast< twenty48::valuer_t< 2 > * >(argp6);
-  result = (twenty48::layer_builder_t< 2 > *)new twenty48::layer_builder_t< 2 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 2 > const &)*arg6);
+  arg1 = static_cast< size_t >(val1);
+  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","vbyte_index_entry_t", 2, argv[1] ));
+  } 
+  arg2 = static_cast< uint64_t >(val2);
+  result = (twenty48::vbyte_index_entry_t *)new twenty48::vbyte_index_entry_t(arg1,arg2);
   DATA_PTR(self) = result;
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
-  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
-  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
   return self;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
-  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
-  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
   return Qnil;
 }
 
 
-SWIGINTERN VALUE
-_wrap_LayerBuilder2_expand_all(int argc, VALUE *argv, VALUE self) {
-  twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *) 0 ;
-  twenty48::vbyte_reader_t *arg2 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+SWIGINTERN VALUE _wrap_new_VByteIndexEntry(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[2];
+  int ii;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_2_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 2 > *","expand_all", 1, self )); 
-  }
-  arg1 = reinterpret_cast< twenty48::layer_builder_t< 2 > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0] )); 
+  argc = nargs;
+  if (argc > 2) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0])); 
+  if (argc == 0) {
+    return _wrap_new_VByteIndexEntry__SWIG_0(nargs, args, self);
   }
-  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
-  (arg1)->expand_all(*arg2);
-  return Qnil;
+  if (argc == 2) {
+    int _v;
+    {
+      int res = SWIG_AsVal_size_t(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_unsigned_SS_long_SS_long(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_new_VByteIndexEntry__SWIG_1(nargs, args, self);
+      }
+    }
+  }
+  
 fail:
+  Ruby_Format_OverloadedError( argc, 2, "vbyte_index_entry_t.new", 
+    "    vbyte_index_entry_t.new()\n"
+    "    vbyte_index_entry_t.new(size_t byte_offset, uint64_t previous)\n");
+  
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_LayerBuilder2_expand_with_policy(int argc, VALUE *argv, VALUE self) {
-  twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *) 0 ;
-  twenty48::vbyte_reader_t *arg2 = 0 ;
-  twenty48::policy_reader_t *arg3 = 0 ;
+_wrap_VByteIndexEntry_byte_offset_set(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_index_entry_t *arg1 = (twenty48::vbyte_index_entry_t *) 0 ;
+  size_t arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  void *argp3 = 0 ;
-  int res3 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
   
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_2_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 2 > *","expand_with_policy", 1, self )); 
-  }
-  arg1 = reinterpret_cast< twenty48::layer_builder_t< 2 > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0])); 
-  }
-  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
-  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1] )); 
-  }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1])); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_index_entry_t *","byte_offset", 1, self )); 
   }
-  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
-  (arg1)->expand_with_policy(*arg2,*arg3);
+  arg1 = reinterpret_cast< twenty48::vbyte_index_entry_t * >(argp1);
+  ecode2 = SWIG_AsVal_size_t(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","byte_offset", 2, argv[0] ));
+  } 
+  arg2 = static_cast< size_t >(val2);
+  if (arg1) (arg1)->byte_offset = arg2;
   return Qnil;
 fail:
   return Qnil;
@@ -30835,554 +31811,339 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_LayerBuilder2_expand_with_policy_and_alternate_actions(int argc, VALUE *argv, VALUE self) {
-  twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *) 0 ;
-  twenty48::vbyte_reader_t *arg2 = 0 ;
-  twenty48::policy_reader_t *arg3 = 0 ;
-  twenty48::alternate_action_reader_t *arg4 = 0 ;
+_wrap_VByteIndexEntry_byte_offset_get(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_index_entry_t *arg1 = (twenty48::vbyte_index_entry_t *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  void *argp3 = 0 ;
-  int res3 = 0 ;
-  void *argp4 = 0 ;
-  int res4 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
   
-  if ((argc < 3) || (argc > 3)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_2_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 2 > *","expand_with_policy_and_alternate_actions", 1, self )); 
-  }
-  arg1 = reinterpret_cast< twenty48::layer_builder_t< 2 > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0])); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_index_entry_t *","byte_offset", 1, self )); 
   }
-  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
-  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1] )); 
+  arg1 = reinterpret_cast< twenty48::vbyte_index_entry_t * >(argp1);
+  result =  ((arg1)->byte_offset);
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_VByteIndexEntry_previous_set(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_index_entry_t *arg1 = (twenty48::vbyte_index_entry_t *) 0 ;
+  uint64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned long long val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1])); 
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_index_entry_t *","previous", 1, self )); 
   }
-  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
-  res4 = SWIG_ConvertPtr(argv[2], &argp4, SWIGTYPE_p_twenty48__alternate_action_reader_t,  0 );
-  if (!SWIG_IsOK(res4)) {
-    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2] )); 
+  arg1 = reinterpret_cast< twenty48::vbyte_index_entry_t * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","previous", 2, argv[0] ));
+  } 
+  arg2 = static_cast< uint64_t >(val2);
+  if (arg1) (arg1)->previous = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_VByteIndexEntry_previous_get(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_index_entry_t *arg1 = (twenty48::vbyte_index_entry_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint64_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  if (!argp4) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2])); 
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_index_entry_t *","previous", 1, self )); 
   }
-  arg4 = reinterpret_cast< twenty48::alternate_action_reader_t * >(argp4);
-  (arg1)->expand_with_policy_and_alternate_actions(*arg2,*arg3,*arg4);
-  return Qnil;
+  arg1 = reinterpret_cast< twenty48::vbyte_index_entry_t * >(argp1);
+  result = (uint64_t) ((arg1)->previous);
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  return vresult;
 fail:
   return Qnil;
 }
 
 
 SWIGINTERN void
-free_twenty48_layer_builder_t_Sl_2_Sg_(void *self) {
-    twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *)self;
+free_twenty48_vbyte_index_entry_t(void *self) {
+    twenty48::vbyte_index_entry_t *arg1 = (twenty48::vbyte_index_entry_t *)self;
     delete arg1;
 }
 
-static swig_class SwigClassLayerBuilder3;
+static swig_class SwigClassVByteIndex;
+
+
+/*
+  Document-method: Twenty48::VByteIndex.dup
+
+  call-seq:
+    dup -> VByteIndex
 
+Create a duplicate of the class and unfreeze it if needed.
+*/
 SWIGINTERN VALUE
-#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
-_wrap_LayerBuilder3_allocate(VALUE self)
-#else
-_wrap_LayerBuilder3_allocate(int argc, VALUE *argv, VALUE self)
-#endif
-{
-  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__layer_builder_tT_3_t);
-#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
-  rb_obj_call_init(vresult, argc, argv);
-#endif
+_wrap_VByteIndex_dup(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","dup", 1, self )); 
+  }
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__dup(arg1);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
+fail:
+  return Qnil;
 }
 
 
+
+/*
+  Document-method: Twenty48::VByteIndex.inspect
+
+  call-seq:
+    inspect -> VALUE
+
+Inspect class and its contents.
+*/
 SWIGINTERN VALUE
-_wrap_new_LayerBuilder3(int argc, VALUE *argv, VALUE self) {
-  uint8_t arg1 ;
-  char *arg2 = (char *) 0 ;
-  char *arg3 = (char *) 0 ;
-  char *arg4 = (char *) 0 ;
-  char *arg5 = (char *) 0 ;
-  twenty48::valuer_t< 3 > *arg6 = 0 ;
-  unsigned char val1 ;
-  int ecode1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
-  int res3 ;
-  char *buf3 = 0 ;
-  int alloc3 = 0 ;
-  int res4 ;
-  char *buf4 = 0 ;
-  int alloc4 = 0 ;
-  int res5 ;
-  char *buf5 = 0 ;
-  int alloc5 = 0 ;
-  void *argp6 ;
-  int res6 = 0 ;
-  twenty48::layer_builder_t< 3 > *result = 0 ;
+_wrap_VByteIndex_inspect(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  VALUE result;
+  VALUE vresult = Qnil;
   
-  if ((argc < 6) || (argc > 6)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
-  }
-  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
-  if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(3)>", 1, argv[0] ));
-  } 
-  arg1 = static_cast< uint8_t >(val1);
-  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 2, argv[1] ));
-  }
-  arg2 = reinterpret_cast< char * >(buf2);
-  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 3, argv[2] ));
-  }
-  arg3 = reinterpret_cast< char * >(buf3);
-  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
-  if (!SWIG_IsOK(res4)) {
-    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 4, argv[3] ));
-  }
-  arg4 = reinterpret_cast< char * >(buf4);
-  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
-  if (!SWIG_IsOK(res5)) {
-    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 5, argv[4] ));
-  }
-  arg5 = reinterpret_cast< char * >(buf5);
-  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_3_t,  0 );
-  if (!SWIG_IsOK(res6)) {
-    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 3 > const &","layer_builder_t<(3)>", 6, argv[5] )); 
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  if (!argp6) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 3 > const &","layer_builder_t<(3)>", 6, argv[5])); 
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","inspect", 1, self )); 
   }
-  arg6 = reinterpret_cast< twenty48::valuer_t< 3 > * >(argp6);
-  result = (twenty48::layer_builder_t< 3 > *)new twenty48::layer_builder_t< 3 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 3 > const &)*arg6);
-  DATA_PTR(self) = result;
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
-  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
-  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
-  return self;
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__inspect(arg1);
+  vresult = result;
+  return vresult;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
-  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
-  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
   return Qnil;
 }
 
 
+
+/*
+  Document-method: Twenty48::VByteIndex.to_a
+
+  call-seq:
+    to_a -> VALUE
+
+Convert VByteIndex to an Array.
+*/
 SWIGINTERN VALUE
-_wrap_LayerBuilder3_expand_all(int argc, VALUE *argv, VALUE self) {
-  twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *) 0 ;
-  twenty48::vbyte_reader_t *arg2 = 0 ;
+_wrap_VByteIndex_to_a(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  VALUE result;
+  VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_3_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 3 > *","expand_all", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","to_a", 1, self )); 
   }
-  arg1 = reinterpret_cast< twenty48::layer_builder_t< 3 > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0] )); 
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__to_a(arg1);
+  vresult = result;
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+
+/*
+  Document-method: Twenty48::VByteIndex.to_s
+
+  call-seq:
+    to_s -> VALUE
+
+Convert class to a String representation.
+*/
+SWIGINTERN VALUE
+_wrap_VByteIndex_to_s(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  VALUE result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0])); 
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","to_s", 1, self )); 
   }
-  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
-  (arg1)->expand_all(*arg2);
-  return Qnil;
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__to_s(arg1);
+  vresult = result;
+  return vresult;
 fail:
   return Qnil;
 }
 
 
+
+/*
+  Document-method: Twenty48::VByteIndex.slice
+
+  call-seq:
+    slice(i, length) -> VALUE
+
+Return a slice (portion of) the VByteIndex.
+*/
 SWIGINTERN VALUE
-_wrap_LayerBuilder3_expand_with_policy(int argc, VALUE *argv, VALUE self) {
-  twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *) 0 ;
-  twenty48::vbyte_reader_t *arg2 = 0 ;
-  twenty48::policy_reader_t *arg3 = 0 ;
+_wrap_VByteIndex_slice(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
+  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  void *argp3 = 0 ;
-  int res3 = 0 ;
+  ptrdiff_t val2 ;
+  int ecode2 = 0 ;
+  ptrdiff_t val3 ;
+  int ecode3 = 0 ;
+  VALUE result;
+  VALUE vresult = Qnil;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_3_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 3 > *","expand_with_policy", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","slice", 1, self )); 
   }
-  arg1 = reinterpret_cast< twenty48::layer_builder_t< 3 > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0] )); 
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","slice", 2, argv[0] ));
+  } 
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
+  ecode3 = SWIG_AsVal_ptrdiff_t(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","slice", 3, argv[1] ));
+  } 
+  arg3 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val3);
+  try {
+    result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__slice(arg1,arg2,arg3);
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0])); 
+  catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
-  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
-  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1] )); 
+  
+  vresult = result;
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+
+/*
+  Document-method: Twenty48::VByteIndex.each
+
+  call-seq:
+    each -> VByteIndex
+
+Iterate thru each element in the VByteIndex.  A block must be provided.
+*/
+SWIGINTERN VALUE
+_wrap_VByteIndex_each(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1])); 
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","each", 1, self )); 
   }
-  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
-  (arg1)->expand_with_policy(*arg2,*arg3);
-  return Qnil;
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__each(arg1);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  return vresult;
 fail:
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_LayerBuilder3_expand_with_policy_and_alternate_actions(int argc, VALUE *argv, VALUE self) {
-  twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *) 0 ;
-  twenty48::vbyte_reader_t *arg2 = 0 ;
-  twenty48::policy_reader_t *arg3 = 0 ;
-  twenty48::alternate_action_reader_t *arg4 = 0 ;
+_wrap_VByteIndex___delete2__(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
+  void *argp2 ;
   int res2 = 0 ;
-  void *argp3 = 0 ;
-  int res3 = 0 ;
-  void *argp4 = 0 ;
-  int res4 = 0 ;
+  VALUE result;
+  VALUE vresult = Qnil;
   
-  if ((argc < 3) || (argc > 3)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_3_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 3 > *","expand_with_policy_and_alternate_actions", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","__delete2__", 1, self )); 
   }
-  arg1 = reinterpret_cast< twenty48::layer_builder_t< 3 > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","__delete2__", 2, argv[0] )); 
   }
   if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0])); 
-  }
-  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
-  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1] )); 
-  }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1])); 
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","__delete2__", 2, argv[0])); 
   }
-  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
-  res4 = SWIG_ConvertPtr(argv[2], &argp4, SWIGTYPE_p_twenty48__alternate_action_reader_t,  0 );
-  if (!SWIG_IsOK(res4)) {
-    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2] )); 
-  }
-  if (!argp4) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2])); 
-  }
-  arg4 = reinterpret_cast< twenty48::alternate_action_reader_t * >(argp4);
-  (arg1)->expand_with_policy_and_alternate_actions(*arg2,*arg3,*arg4);
-  return Qnil;
-fail:
-  return Qnil;
-}
-
-
-SWIGINTERN void
-free_twenty48_layer_builder_t_Sl_3_Sg_(void *self) {
-    twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *)self;
-    delete arg1;
-}
-
-static swig_class SwigClassLayerBuilder4;
-
-SWIGINTERN VALUE
-#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
-_wrap_LayerBuilder4_allocate(VALUE self)
-#else
-_wrap_LayerBuilder4_allocate(int argc, VALUE *argv, VALUE self)
-#endif
-{
-  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__layer_builder_tT_4_t);
-#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
-  rb_obj_call_init(vresult, argc, argv);
-#endif
-  return vresult;
-}
-
-
-SWIGINTERN VALUE
-_wrap_new_LayerBuilder4(int argc, VALUE *argv, VALUE self) {
-  uint8_t arg1 ;
-  char *arg2 = (char *) 0 ;
-  char *arg3 = (char *) 0 ;
-  char *arg4 = (char *) 0 ;
-  char *arg5 = (char *) 0 ;
-  twenty48::valuer_t< 4 > *arg6 = 0 ;
-  unsigned char val1 ;
-  int ecode1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
-  int res3 ;
-  char *buf3 = 0 ;
-  int alloc3 = 0 ;
-  int res4 ;
-  char *buf4 = 0 ;
-  int alloc4 = 0 ;
-  int res5 ;
-  char *buf5 = 0 ;
-  int alloc5 = 0 ;
-  void *argp6 ;
-  int res6 = 0 ;
-  twenty48::layer_builder_t< 4 > *result = 0 ;
-  
-  if ((argc < 6) || (argc > 6)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
-  }
-  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
-  if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(4)>", 1, argv[0] ));
-  } 
-  arg1 = static_cast< uint8_t >(val1);
-  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 2, argv[1] ));
-  }
-  arg2 = reinterpret_cast< char * >(buf2);
-  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 3, argv[2] ));
-  }
-  arg3 = reinterpret_cast< char * >(buf3);
-  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
-  if (!SWIG_IsOK(res4)) {
-    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 4, argv[3] ));
-  }
-  arg4 = reinterpret_cast< char * >(buf4);
-  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
-  if (!SWIG_IsOK(res5)) {
-    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 5, argv[4] ));
-  }
-  arg5 = reinterpret_cast< char * >(buf5);
-  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_4_t,  0 );
-  if (!SWIG_IsOK(res6)) {
-    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 4 > const &","layer_builder_t<(4)>", 6, argv[5] )); 
-  }
-  if (!argp6) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 4 > const &","layer_builder_t<(4)>", 6, argv[5])); 
-  }
-  arg6 = reinterpret_cast< twenty48::valuer_t< 4 > * >(argp6);
-  result = (twenty48::layer_builder_t< 4 > *)new twenty48::layer_builder_t< 4 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 4 > const &)*arg6);
-  DATA_PTR(self) = result;
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
-  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
-  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
-  return self;
-fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
-  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
-  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
-  return Qnil;
-}
-
-
-SWIGINTERN VALUE
-_wrap_LayerBuilder4_expand_all(int argc, VALUE *argv, VALUE self) {
-  twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *) 0 ;
-  twenty48::vbyte_reader_t *arg2 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_4_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 4 > *","expand_all", 1, self )); 
-  }
-  arg1 = reinterpret_cast< twenty48::layer_builder_t< 4 > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0])); 
-  }
-  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
-  (arg1)->expand_all(*arg2);
-  return Qnil;
-fail:
-  return Qnil;
-}
-
-
-SWIGINTERN VALUE
-_wrap_LayerBuilder4_expand_with_policy(int argc, VALUE *argv, VALUE self) {
-  twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *) 0 ;
-  twenty48::vbyte_reader_t *arg2 = 0 ;
-  twenty48::policy_reader_t *arg3 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  void *argp3 = 0 ;
-  int res3 = 0 ;
-  
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_4_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 4 > *","expand_with_policy", 1, self )); 
-  }
-  arg1 = reinterpret_cast< twenty48::layer_builder_t< 4 > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0])); 
-  }
-  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
-  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1] )); 
-  }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1])); 
-  }
-  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
-  (arg1)->expand_with_policy(*arg2,*arg3);
-  return Qnil;
-fail:
-  return Qnil;
-}
-
-
-SWIGINTERN VALUE
-_wrap_LayerBuilder4_expand_with_policy_and_alternate_actions(int argc, VALUE *argv, VALUE self) {
-  twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *) 0 ;
-  twenty48::vbyte_reader_t *arg2 = 0 ;
-  twenty48::policy_reader_t *arg3 = 0 ;
-  twenty48::alternate_action_reader_t *arg4 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  void *argp3 = 0 ;
-  int res3 = 0 ;
-  void *argp4 = 0 ;
-  int res4 = 0 ;
-  
-  if ((argc < 3) || (argc > 3)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_4_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 4 > *","expand_with_policy_and_alternate_actions", 1, self )); 
-  }
-  arg1 = reinterpret_cast< twenty48::layer_builder_t< 4 > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0])); 
-  }
-  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
-  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1] )); 
-  }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1])); 
-  }
-  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
-  res4 = SWIG_ConvertPtr(argv[2], &argp4, SWIGTYPE_p_twenty48__alternate_action_reader_t,  0 );
-  if (!SWIG_IsOK(res4)) {
-    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2] )); 
-  }
-  if (!argp4) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2])); 
-  }
-  arg4 = reinterpret_cast< twenty48::alternate_action_reader_t * >(argp4);
-  (arg1)->expand_with_policy_and_alternate_actions(*arg2,*arg3,*arg4);
-  return Qnil;
-fail:
-  return Qnil;
-}
-
-
-SWIGINTERN void
-free_twenty48_layer_builder_t_Sl_4_Sg_(void *self) {
-    twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *)self;
-    delete arg1;
-}
-
-static swig_class SwigClassStringVector;
-
-
-/*
-  Document-method: Twenty48::StringVector.dup
-
-  call-seq:
-    dup -> StringVector
-
-Create a duplicate of the class and unfreeze it if needed.
-*/
-SWIGINTERN VALUE
-_wrap_StringVector_dup(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
-  VALUE vresult = Qnil;
-  
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","dup", 1, self )); 
-  }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__dup(arg1);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, SWIG_POINTER_OWN |  0 );
+  arg2 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp2);
+  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____delete2__(arg1,(twenty48::vbyte_index_entry_t const &)*arg2);
+  vresult = result;
   return vresult;
 fail:
   return Qnil;
@@ -31391,31 +32152,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.inspect
+  Document-method: Twenty48::VByteIndex.select
 
   call-seq:
-    inspect -> VALUE
+    select -> VByteIndex
 
-Inspect class and its contents.
+Iterate thru each element in the VByteIndex and select those that match a condition.  A block must be provided.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_inspect(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_select(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  VALUE result;
+  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","inspect", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","select", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (VALUE)std_vector_Sl_std_string_Sg__inspect(arg1);
-  vresult = result;
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__select(arg1);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -31424,30 +32185,38 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.to_a
+  Document-method: Twenty48::VByteIndex.delete_at
 
   call-seq:
-    to_a -> VALUE
+    delete_at(i) -> VALUE
 
-Convert StringVector to an Array.
+Delete an element at a certain index.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_to_a(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_delete_at(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  ptrdiff_t val2 ;
+  int ecode2 = 0 ;
   VALUE result;
   VALUE vresult = Qnil;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","to_a", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","delete_at", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (VALUE)std_vector_Sl_std_string_Sg__to_a(arg1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","delete_at", 2, argv[0] ));
+  } 
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
+  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__delete_at(arg1,arg2);
   vresult = result;
   return vresult;
 fail:
@@ -31457,30 +32226,38 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.to_s
+  Document-method: Twenty48::VByteIndex.at
 
   call-seq:
-    to_s -> VALUE
+    at(i) -> VALUE
 
-Convert class to a String representation.
+Return element at a certain index.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_to_s(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_at(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  ptrdiff_t val2 ;
+  int ecode2 = 0 ;
   VALUE result;
   VALUE vresult = Qnil;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","to_s", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","at", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (VALUE)std_vector_Sl_std_string_Sg__to_s(arg1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","at", 2, argv[0] ));
+  } 
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
+  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__at((std::vector< twenty48::vbyte_index_entry_t > const *)arg1,arg2);
   vresult = result;
   return vresult;
 fail:
@@ -31490,18 +32267,20 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.slice
+  Document-method: Twenty48::VByteIndex.[]
 
   call-seq:
-    slice(i, length) -> VALUE
+    [](i, length) -> VALUE
+    [](i) -> VALUE
+    [](i) -> VALUE
 
-Return a slice (portion of) the StringVector.
+Element accessor/slicing.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_slice(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::difference_type arg2 ;
-  std::vector< std::string >::difference_type arg3 ;
+_wrap_VByteIndex___getitem____SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
+  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   ptrdiff_t val2 ;
@@ -31514,23 +32293,23 @@ _wrap_StringVector_slice(int argc, VALUE *argv, VALUE self) {
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","slice", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","__getitem__", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","slice", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__getitem__", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
   ecode3 = SWIG_AsVal_ptrdiff_t(argv[1], &val3);
   if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","slice", 3, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__getitem__", 3, argv[1] ));
   } 
-  arg3 = static_cast< std::vector< std::string >::difference_type >(val3);
+  arg3 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val3);
   try {
-    result = (VALUE)std_vector_Sl_std_string_Sg__slice(arg1,arg2,arg3);
+    result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____getitem____SWIG_0((std::vector< twenty48::vbyte_index_entry_t > const *)arg1,arg2,arg3);
   }
   catch(std::invalid_argument &_e) {
     SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
@@ -31543,33 +32322,32 @@ fail:
 }
 
 
-
-/*
-  Document-method: Twenty48::StringVector.each
-
-  call-seq:
-    each -> StringVector
-
-Iterate thru each element in the StringVector.  A block must be provided.
-*/
 SWIGINTERN VALUE
-_wrap_StringVector_each(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex___getitem____SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
+  ptrdiff_t val2 ;
+  int ecode2 = 0 ;
+  VALUE result;
   VALUE vresult = Qnil;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","each", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","__getitem__", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__each(arg1);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__getitem__", 2, argv[0] ));
+  } 
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
+  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____getitem____SWIG_1((std::vector< twenty48::vbyte_index_entry_t > const *)arg1,arg2);
+  vresult = result;
   return vresult;
 fail:
   return Qnil;
@@ -31577,319 +32355,76 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_StringVector___delete2__(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::value_type *arg2 = 0 ;
+_wrap_VByteIndex___getitem____SWIG_2(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  VALUE arg2 = (VALUE) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
   VALUE result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","__delete2__", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","__getitem__", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","__delete2__", 2, argv[0] )); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","__delete2__", 2, argv[0])); 
-    }
-    arg2 = ptr;
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg2 = argv[0];
+  try {
+    result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____getitem____SWIG_2((std::vector< twenty48::vbyte_index_entry_t > const *)arg1,arg2);
   }
-  result = (VALUE)std_vector_Sl_std_string_Sg____delete2__(arg1,(std::string const &)*arg2);
+  catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  
   vresult = result;
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return vresult;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return Qnil;
 }
 
 
-
-/*
-  Document-method: Twenty48::StringVector.select
-
-  call-seq:
-    select -> StringVector
-
-Iterate thru each element in the StringVector and select those that match a condition.  A block must be provided.
-*/
-SWIGINTERN VALUE
-_wrap_StringVector_select(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
-  VALUE vresult = Qnil;
+SWIGINTERN VALUE _wrap_VByteIndex___getitem__(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[4];
+  int ii;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 4) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","select", 1, self )); 
-  }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__select(arg1);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, SWIG_POINTER_OWN |  0 );
-  return vresult;
-fail:
-  return Qnil;
-}
-
-
-
-/*
-  Document-method: Twenty48::StringVector.delete_at
-
-  call-seq:
-    delete_at(i) -> VALUE
-
-Delete an element at a certain index.
-*/
-SWIGINTERN VALUE
-_wrap_StringVector_delete_at(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::difference_type arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  ptrdiff_t val2 ;
-  int ecode2 = 0 ;
-  VALUE result;
-  VALUE vresult = Qnil;
-  
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","delete_at", 1, self )); 
-  }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","delete_at", 2, argv[0] ));
-  } 
-  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
-  result = (VALUE)std_vector_Sl_std_string_Sg__delete_at(arg1,arg2);
-  vresult = result;
-  return vresult;
-fail:
-  return Qnil;
-}
-
-
-
-/*
-  Document-method: Twenty48::StringVector.at
-
-  call-seq:
-    at(i) -> VALUE
-
-Return element at a certain index.
-*/
-SWIGINTERN VALUE
-_wrap_StringVector_at(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::difference_type arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  ptrdiff_t val2 ;
-  int ecode2 = 0 ;
-  VALUE result;
-  VALUE vresult = Qnil;
-  
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","at", 1, self )); 
-  }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","at", 2, argv[0] ));
-  } 
-  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
-  result = (VALUE)std_vector_Sl_std_string_Sg__at((std::vector< std::string > const *)arg1,arg2);
-  vresult = result;
-  return vresult;
-fail:
-  return Qnil;
-}
-
-
-
-/*
-  Document-method: Twenty48::StringVector.[]
-
-  call-seq:
-    [](i, length) -> VALUE
-    [](i) -> VALUE
-    [](i) -> VALUE
-
-Element accessor/slicing.
-*/
-SWIGINTERN VALUE
-_wrap_StringVector___getitem____SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::difference_type arg2 ;
-  std::vector< std::string >::difference_type arg3 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  ptrdiff_t val2 ;
-  int ecode2 = 0 ;
-  ptrdiff_t val3 ;
-  int ecode3 = 0 ;
-  VALUE result;
-  VALUE vresult = Qnil;
-  
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","__getitem__", 1, self )); 
-  }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__getitem__", 2, argv[0] ));
-  } 
-  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
-  ecode3 = SWIG_AsVal_ptrdiff_t(argv[1], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__getitem__", 3, argv[1] ));
-  } 
-  arg3 = static_cast< std::vector< std::string >::difference_type >(val3);
-  try {
-    result = (VALUE)std_vector_Sl_std_string_Sg____getitem____SWIG_0((std::vector< std::string > const *)arg1,arg2,arg3);
-  }
-  catch(std::invalid_argument &_e) {
-    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
-  }
-  
-  vresult = result;
-  return vresult;
-fail:
-  return Qnil;
-}
-
-
-SWIGINTERN VALUE
-_wrap_StringVector___getitem____SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::difference_type arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  ptrdiff_t val2 ;
-  int ecode2 = 0 ;
-  VALUE result;
-  VALUE vresult = Qnil;
-  
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","__getitem__", 1, self )); 
-  }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__getitem__", 2, argv[0] ));
-  } 
-  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
-  result = (VALUE)std_vector_Sl_std_string_Sg____getitem____SWIG_1((std::vector< std::string > const *)arg1,arg2);
-  vresult = result;
-  return vresult;
-fail:
-  return Qnil;
-}
-
-
-SWIGINTERN VALUE
-_wrap_StringVector___getitem____SWIG_2(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  VALUE arg2 = (VALUE) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  VALUE result;
-  VALUE vresult = Qnil;
-  
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","__getitem__", 1, self )); 
-  }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  arg2 = argv[0];
-  try {
-    result = (VALUE)std_vector_Sl_std_string_Sg____getitem____SWIG_2((std::vector< std::string > const *)arg1,arg2);
-  }
-  catch(std::invalid_argument &_e) {
-    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
-  }
-  
-  vresult = result;
-  return vresult;
-fail:
-  return Qnil;
-}
-
-
-SWIGINTERN VALUE _wrap_StringVector___getitem__(int nargs, VALUE *args, VALUE self) {
-  int argc;
-  VALUE argv[4];
-  int ii;
-  
-  argc = nargs + 1;
-  argv[0] = self;
-  if (argc > 4) SWIG_fail;
-  for (ii = 1; (ii < argc); ++ii) {
-    argv[ii] = args[ii-1];
-  }
-  if (argc == 2) {
-    int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_ptrdiff_t(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        return _wrap_StringVector___getitem____SWIG_1(nargs, args, self);
-      }
-    }
+  if (argc == 2) {
+    int _v;
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_ptrdiff_t(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_VByteIndex___getitem____SWIG_1(nargs, args, self);
+      }
+    }
   }
   if (argc == 2) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       _v = (argv[1] != 0);
       if (_v) {
-        return _wrap_StringVector___getitem____SWIG_2(nargs, args, self);
+        return _wrap_VByteIndex___getitem____SWIG_2(nargs, args, self);
       }
     }
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -31902,7 +32437,7 @@ SWIGINTERN VALUE _wrap_StringVector___getitem__(int nargs, VALUE *args, VALUE se
           _v = SWIG_CheckState(res);
         }
         if (_v) {
-          return _wrap_StringVector___getitem____SWIG_0(nargs, args, self);
+          return _wrap_VByteIndex___getitem____SWIG_0(nargs, args, self);
         }
       }
     }
@@ -31910,8 +32445,8 @@ SWIGINTERN VALUE _wrap_StringVector___getitem__(int nargs, VALUE *args, VALUE se
   
 fail:
   Ruby_Format_OverloadedError( argc, 4, "__getitem__", 
-    "    VALUE __getitem__(std::vector< std::string >::difference_type i, std::vector< std::string >::difference_type length)\n"
-    "    VALUE __getitem__(std::vector< std::string >::difference_type i)\n"
+    "    VALUE __getitem__(std::vector< twenty48::vbyte_index_entry_t >::difference_type i, std::vector< twenty48::vbyte_index_entry_t >::difference_type length)\n"
+    "    VALUE __getitem__(std::vector< twenty48::vbyte_index_entry_t >::difference_type i)\n"
     "    VALUE __getitem__(VALUE i)\n");
   
   return Qnil;
@@ -31920,7 +32455,7 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.[]=
+  Document-method: Twenty48::VByteIndex.[]=
 
   call-seq:
     []=(i, x) -> VALUE
@@ -31929,44 +32464,42 @@ fail:
 Element setter/slicing.
 */
 SWIGINTERN VALUE
-_wrap_StringVector___setitem____SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::difference_type arg2 ;
-  std::vector< std::string >::value_type *arg3 = 0 ;
+_wrap_VByteIndex___setitem____SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
+  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   ptrdiff_t val2 ;
   int ecode2 = 0 ;
-  int res3 = SWIG_OLDOBJ ;
+  void *argp3 ;
+  int res3 = 0 ;
   VALUE result;
   VALUE vresult = Qnil;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","__setitem__", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","__setitem__", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__setitem__", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__setitem__", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
-  {
-    std::string *ptr = (std::string *)0;
-    res3 = SWIG_AsPtr_std_string(argv[1], &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","__setitem__", 3, argv[1] )); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","__setitem__", 3, argv[1])); 
-    }
-    arg3 = ptr;
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","__setitem__", 3, argv[1] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","__setitem__", 3, argv[1])); 
   }
+  arg3 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp3);
   try {
-    result = (VALUE)std_vector_Sl_std_string_Sg____setitem____SWIG_0(arg1,arg2,(std::string const &)*arg3);
+    result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____setitem____SWIG_0(arg1,arg2,(twenty48::vbyte_index_entry_t const &)*arg3);
   }
   catch(std::invalid_argument &_e) {
     SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
@@ -31976,20 +32509,18 @@ _wrap_StringVector___setitem____SWIG_0(int argc, VALUE *argv, VALUE self) {
   }
   
   vresult = result;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return vresult;
 fail:
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_StringVector___setitem____SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::difference_type arg2 ;
-  std::vector< std::string >::difference_type arg3 ;
-  std::vector< std::string,std::allocator< std::string > > *arg4 = 0 ;
+_wrap_VByteIndex___setitem____SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
+  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg3 ;
+  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *arg4 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   ptrdiff_t val2 ;
@@ -32003,34 +32534,34 @@ _wrap_StringVector___setitem____SWIG_1(int argc, VALUE *argv, VALUE self) {
   if ((argc < 3) || (argc > 3)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","__setitem__", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","__setitem__", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__setitem__", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__setitem__", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
   ecode3 = SWIG_AsVal_ptrdiff_t(argv[1], &val3);
   if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__setitem__", 3, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__setitem__", 3, argv[1] ));
   } 
-  arg3 = static_cast< std::vector< std::string >::difference_type >(val3);
+  arg3 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val3);
   {
-    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
+    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *ptr = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)0;
     res4 = swig::asptr(argv[2], &ptr);
     if (!SWIG_IsOK(res4)) {
-      SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","__setitem__", 4, argv[2] )); 
+      SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > const &","__setitem__", 4, argv[2] )); 
     }
     if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","__setitem__", 4, argv[2])); 
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > const &","__setitem__", 4, argv[2])); 
     }
     arg4 = ptr;
   }
   try {
-    result = (VALUE)std_vector_Sl_std_string_Sg____setitem____SWIG_1(arg1,arg2,arg3,(std::vector< std::string,std::allocator< std::string > > const &)*arg4);
+    result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____setitem____SWIG_1(arg1,arg2,arg3,(std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > const &)*arg4);
   }
   catch(std::invalid_argument &_e) {
     SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
@@ -32045,7 +32576,7 @@ fail:
 }
 
 
-SWIGINTERN VALUE _wrap_StringVector___setitem__(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_VByteIndex___setitem__(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[5];
   int ii;
@@ -32058,7 +32589,7 @@ SWIGINTERN VALUE _wrap_StringVector___setitem__(int nargs, VALUE *args, VALUE se
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -32066,17 +32597,18 @@ SWIGINTERN VALUE _wrap_StringVector___setitem__(int nargs, VALUE *args, VALUE se
         _v = SWIG_CheckState(res);
       }
       if (_v) {
-        int res = SWIG_AsPtr_std_string(argv[2], (std::string**)(0));
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0);
         _v = SWIG_CheckState(res);
         if (_v) {
-          return _wrap_StringVector___setitem____SWIG_0(nargs, args, self);
+          return _wrap_VByteIndex___setitem____SWIG_0(nargs, args, self);
         }
       }
     }
   }
   if (argc == 4) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -32089,10 +32621,10 @@ SWIGINTERN VALUE _wrap_StringVector___setitem__(int nargs, VALUE *args, VALUE se
           _v = SWIG_CheckState(res);
         }
         if (_v) {
-          int res = swig::asptr(argv[3], (std::vector< std::string,std::allocator< std::string > >**)(0));
+          int res = swig::asptr(argv[3], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
           _v = SWIG_CheckState(res);
           if (_v) {
-            return _wrap_StringVector___setitem____SWIG_1(nargs, args, self);
+            return _wrap_VByteIndex___setitem____SWIG_1(nargs, args, self);
           }
         }
       }
@@ -32101,8 +32633,8 @@ SWIGINTERN VALUE _wrap_StringVector___setitem__(int nargs, VALUE *args, VALUE se
   
 fail:
   Ruby_Format_OverloadedError( argc, 5, "__setitem__", 
-    "    VALUE __setitem__(std::vector< std::string >::difference_type i, std::vector< std::string >::value_type const &x)\n"
-    "    VALUE __setitem__(std::vector< std::string >::difference_type i, std::vector< std::string >::difference_type length, std::vector< std::string,std::allocator< std::string > > const &v)\n");
+    "    VALUE __setitem__(std::vector< twenty48::vbyte_index_entry_t >::difference_type i, std::vector< twenty48::vbyte_index_entry_t >::value_type const &x)\n"
+    "    VALUE __setitem__(std::vector< twenty48::vbyte_index_entry_t >::difference_type i, std::vector< twenty48::vbyte_index_entry_t >::difference_type length, std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > const &v)\n");
   
   return Qnil;
 }
@@ -32110,31 +32642,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.reject!
+  Document-method: Twenty48::VByteIndex.reject!
 
   call-seq:
-    reject! -> StringVector
+    reject! -> VByteIndex
 
-Iterate thru each element in the StringVector and reject those that fail a condition.  A block must be provided.  StringVector is modified in place.
+Iterate thru each element in the VByteIndex and reject those that fail a condition.  A block must be provided.  VByteIndex is modified in place.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_rejectN___(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_rejectN___(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","reject_bang", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","reject_bang", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__reject_bang(arg1);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__reject_bang(arg1);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -32143,16 +32675,16 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.pop
+  Document-method: Twenty48::VByteIndex.pop
 
   call-seq:
     pop -> VALUE
 
-Remove and return element at the end of the StringVector.
+Remove and return element at the end of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_pop(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_pop(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   VALUE result;
@@ -32161,12 +32693,12 @@ _wrap_StringVector_pop(int argc, VALUE *argv, VALUE self) {
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","pop", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","pop", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (VALUE)std_vector_Sl_std_string_Sg__pop(arg1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__pop(arg1);
   vresult = result;
   return vresult;
 fail:
@@ -32176,79 +32708,75 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.push
+  Document-method: Twenty48::VByteIndex.push
 
   call-seq:
-    push(e) -> std::vector< std::string >::value_type const
+    push(e) -> VByteIndexEntry
 
-Add an element at the end of the StringVector.
+Add an element at the end of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_push(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::value_type *arg2 = 0 ;
+_wrap_VByteIndex_push(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  std::vector< std::string >::value_type result;
+  void *argp2 ;
+  int res2 = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::value_type result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","push", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","push", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","push", 2, argv[0] )); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","push", 2, argv[0])); 
-    }
-    arg2 = ptr;
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","push", 2, argv[0] )); 
   }
-  result = std_vector_Sl_std_string_Sg__push(arg1,(std::string const &)*arg2);
-  vresult = SWIG_From_std_string(static_cast< std::string >(result));
-  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","push", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp2);
+  result = std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__push(arg1,(twenty48::vbyte_index_entry_t const &)*arg2);
+  vresult = SWIG_NewPointerObj((new std::vector< twenty48::vbyte_index_entry_t >::value_type(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::value_type& >(result))), SWIGTYPE_p_twenty48__vbyte_index_entry_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return Qnil;
 }
 
 
 
 /*
-  Document-method: Twenty48::StringVector.reject
+  Document-method: Twenty48::VByteIndex.reject
 
   call-seq:
-    reject -> StringVector
+    reject -> VByteIndex
 
-Iterate thru each element in the StringVector and reject those that fail a condition returning a new StringVector.  A block must be provided.
+Iterate thru each element in the VByteIndex and reject those that fail a condition returning a new VByteIndex.  A block must be provided.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_reject(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_reject(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","reject", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","reject", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__reject(arg1);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, SWIG_POINTER_OWN |  0 );
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__reject(arg1);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -32257,16 +32785,16 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.shift
+  Document-method: Twenty48::VByteIndex.shift
 
   call-seq:
     shift -> VALUE
 
-Remove and return element at the beginning of the StringVector.
+Remove and return element at the beginning of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_shift(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_shift(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   VALUE result;
@@ -32275,12 +32803,12 @@ _wrap_StringVector_shift(int argc, VALUE *argv, VALUE self) {
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","shift", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","shift", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (VALUE)std_vector_Sl_std_string_Sg__shift(arg1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__shift(arg1);
   vresult = result;
   return vresult;
 fail:
@@ -32290,19 +32818,19 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.insert
+  Document-method: Twenty48::VByteIndex.insert
 
   call-seq:
-    insert(pos, argc) -> StringVector
-    insert(pos, x) -> std::vector< std::string >::iterator
+    insert(pos, argc) -> VByteIndex
+    insert(pos, x) -> std::vector< twenty48::vbyte_index_entry_t >::iterator
     insert(pos, n, x)
 
-Insert one or more new elements in the StringVector.
+Insert one or more new elements in the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_insert__SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::difference_type arg2 ;
+_wrap_VByteIndex_insert__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
   int arg3 ;
   VALUE *arg4 = (VALUE *) 0 ;
   void *arg5 = 0 ;
@@ -32310,28 +32838,28 @@ _wrap_StringVector_insert__SWIG_0(int argc, VALUE *argv, VALUE self) {
   int res1 = 0 ;
   ptrdiff_t val2 ;
   int ecode2 = 0 ;
-  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if (argc < 2) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","insert", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","insert", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","insert", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","insert", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
   {
     arg3 = argc - 1;
     arg4 = argv + 1;
   }
-  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__insert__SWIG_0(arg1,arg2,arg3,arg4,arg5);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__insert__SWIG_0(arg1,arg2,arg3,arg4,arg5);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -32340,38 +32868,38 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.unshift
+  Document-method: Twenty48::VByteIndex.unshift
 
   call-seq:
-    unshift(argc) -> StringVector
+    unshift(argc) -> VByteIndex
 
-Add one or more elements at the beginning of the StringVector.
+Add one or more elements at the beginning of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_unshift(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_unshift(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   int arg2 ;
   VALUE *arg3 = (VALUE *) 0 ;
   void *arg4 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if (argc < 1) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","unshift", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","unshift", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   {
     arg2 = argc;
     arg3 = argv;
   }
-  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__unshift(arg1,arg2,arg3,arg4);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__unshift(arg1,arg2,arg3,arg4);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -32379,13 +32907,13 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_new_StringVector__SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *result = 0 ;
+_wrap_new_VByteIndex__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *result = 0 ;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  result = (std::vector< std::string > *)new std::vector< std::string >();
+  result = (std::vector< twenty48::vbyte_index_entry_t > *)new std::vector< twenty48::vbyte_index_entry_t >();
   DATA_PTR(self) = result;
   return self;
 fail:
@@ -32394,26 +32922,26 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_new_StringVector__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = 0 ;
+_wrap_new_VByteIndex__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = 0 ;
   int res1 = SWIG_OLDOBJ ;
-  std::vector< std::string > *result = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t > *result = 0 ;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
   {
-    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
+    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *ptr = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)0;
     res1 = swig::asptr(argv[0], &ptr);
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const &","vector<(std::string)>", 1, argv[0] )); 
+      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const &","vector<(twenty48::vbyte_index_entry_t)>", 1, argv[0] )); 
     }
     if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string > const &","vector<(std::string)>", 1, argv[0])); 
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t > const &","vector<(twenty48::vbyte_index_entry_t)>", 1, argv[0])); 
     }
     arg1 = ptr;
   }
-  result = (std::vector< std::string > *)new std::vector< std::string >((std::vector< std::string > const &)*arg1);
+  result = (std::vector< twenty48::vbyte_index_entry_t > *)new std::vector< twenty48::vbyte_index_entry_t >((std::vector< twenty48::vbyte_index_entry_t > const &)*arg1);
   DATA_PTR(self) = result;
   if (SWIG_IsNewObj(res1)) delete arg1;
   return self;
@@ -32425,16 +32953,16 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.empty?
+  Document-method: Twenty48::VByteIndex.empty?
 
   call-seq:
     empty? -> bool
 
-Check if the StringVector is empty or not.
+Check if the VByteIndex is empty or not.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_emptyq___(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_emptyq___(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   bool result;
@@ -32443,12 +32971,12 @@ _wrap_StringVector_emptyq___(int argc, VALUE *argv, VALUE self) {
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","empty", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","empty", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (bool)((std::vector< std::string > const *)arg1)->empty();
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (bool)((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->empty();
   vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
@@ -32458,30 +32986,30 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.size
+  Document-method: Twenty48::VByteIndex.size
 
   call-seq:
-    size -> std::vector< std::string >::size_type
+    size -> std::vector< twenty48::vbyte_index_entry_t >::size_type
 
-Size or Length of the StringVector.
+Size or Length of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_size(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_size(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string >::size_type result;
+  std::vector< twenty48::vbyte_index_entry_t >::size_type result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","size", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","size", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = ((std::vector< std::string > const *)arg1)->size();
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = ((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->size();
   vresult = SWIG_From_size_t(static_cast< size_t >(result));
   return vresult;
 fail:
@@ -32490,9 +33018,9 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_StringVector_swap(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string > *arg2 = 0 ;
+_wrap_VByteIndex_swap(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 = 0 ;
@@ -32501,19 +33029,19 @@ _wrap_StringVector_swap(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","swap", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","swap", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t,  0 );
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t,  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< std::string > &","swap", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > &","swap", 2, argv[0] )); 
   }
   if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string > &","swap", 2, argv[0])); 
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t > &","swap", 2, argv[0])); 
   }
-  arg2 = reinterpret_cast< std::vector< std::string > * >(argp2);
+  arg2 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp2);
   (arg1)->swap(*arg2);
   return Qnil;
 fail:
@@ -32523,31 +33051,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.begin
+  Document-method: Twenty48::VByteIndex.begin
 
   call-seq:
-    begin -> std::vector< std::string >::iterator
+    begin -> std::vector< twenty48::vbyte_index_entry_t >::iterator
 
-Return an iterator to the beginning of the StringVector.
+Return an iterator to the beginning of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_begin(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_begin(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string >::iterator result;
+  std::vector< twenty48::vbyte_index_entry_t >::iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","begin", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","begin", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   result = (arg1)->begin();
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::iterator & >(result),
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -32558,31 +33086,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.end
+  Document-method: Twenty48::VByteIndex.end
 
   call-seq:
-    end -> std::vector< std::string >::iterator
+    end -> std::vector< twenty48::vbyte_index_entry_t >::iterator
 
-Return an iterator to past the end of the StringVector.
+Return an iterator to past the end of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_end(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_end(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string >::iterator result;
+  std::vector< twenty48::vbyte_index_entry_t >::iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","end", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","end", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   result = (arg1)->end();
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::iterator & >(result),
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -32593,31 +33121,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.rbegin
+  Document-method: Twenty48::VByteIndex.rbegin
 
   call-seq:
-    rbegin -> std::vector< std::string >::reverse_iterator
+    rbegin -> std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator
 
-Return a reverse iterator to the beginning (the end) of the StringVector.
+Return a reverse iterator to the beginning (the end) of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_rbegin(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_rbegin(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string >::reverse_iterator result;
+  std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","rbegin", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","rbegin", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   result = (arg1)->rbegin();
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::reverse_iterator & >(result),
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -32628,31 +33156,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.rend
+  Document-method: Twenty48::VByteIndex.rend
 
   call-seq:
-    rend -> std::vector< std::string >::reverse_iterator
+    rend -> std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator
 
-Return a reverse iterator to past the end (past the beginning) of the StringVector.
+Return a reverse iterator to past the end (past the beginning) of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_rend(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_rend(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string >::reverse_iterator result;
+  std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","rend", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","rend", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   result = (arg1)->rend();
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::reverse_iterator & >(result),
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -32663,27 +33191,27 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.clear
+  Document-method: Twenty48::VByteIndex.clear
 
   call-seq:
     clear
 
-Clear StringVector contents.
+Clear VByteIndex contents.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_clear(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_clear(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","clear", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","clear", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   (arg1)->clear();
   return Qnil;
 fail:
@@ -32692,23 +33220,23 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_StringVector_get_allocator(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_get_allocator(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  SwigValueWrapper< std::allocator< std::string > > result;
+  SwigValueWrapper< std::allocator< twenty48::vbyte_index_entry_t > > result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","get_allocator", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","get_allocator", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = ((std::vector< std::string > const *)arg1)->get_allocator();
-  vresult = SWIG_NewPointerObj((new std::vector< std::string >::allocator_type(static_cast< const std::vector< std::string >::allocator_type& >(result))), SWIGTYPE_p_std__allocatorT_std__string_t, SWIG_POINTER_OWN |  0 );
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = ((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->get_allocator();
+  vresult = SWIG_NewPointerObj((new std::vector< twenty48::vbyte_index_entry_t >::allocator_type(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::allocator_type& >(result))), SWIGTYPE_p_std__allocatorT_twenty48__vbyte_index_entry_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -32716,21 +33244,21 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_new_StringVector__SWIG_2(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string >::size_type arg1 ;
+_wrap_new_VByteIndex__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t >::size_type arg1 ;
   size_t val1 ;
   int ecode1 = 0 ;
-  std::vector< std::string > *result = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t > *result = 0 ;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
   ecode1 = SWIG_AsVal_size_t(argv[0], &val1);
   if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","vector<(std::string)>", 1, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","vector<(twenty48::vbyte_index_entry_t)>", 1, argv[0] ));
   } 
-  arg1 = static_cast< std::vector< std::string >::size_type >(val1);
-  result = (std::vector< std::string > *)new std::vector< std::string >(arg1);
+  arg1 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val1);
+  result = (std::vector< twenty48::vbyte_index_entry_t > *)new std::vector< twenty48::vbyte_index_entry_t >(arg1);
   DATA_PTR(self) = result;
   return self;
 fail:
@@ -32740,18 +33268,18 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.resize
+  Document-method: Twenty48::VByteIndex.resize
 
   call-seq:
     resize(new_size)
     resize(new_size, x)
 
-Resize the size of the StringVector.
+Resize the size of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_resize__SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::size_type arg2 ;
+_wrap_VByteIndex_resize__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::size_type arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
@@ -32760,16 +33288,16 @@ _wrap_StringVector_resize__SWIG_0(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","resize", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","resize", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   ecode2 = SWIG_AsVal_size_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","resize", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","resize", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< std::string >::size_type >(val2);
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val2);
   (arg1)->resize(arg2);
   return Qnil;
 fail:
@@ -32779,46 +33307,46 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.erase
+  Document-method: Twenty48::VByteIndex.erase
 
   call-seq:
-    erase(pos) -> std::vector< std::string >::iterator
-    erase(first, last) -> std::vector< std::string >::iterator
+    erase(pos) -> std::vector< twenty48::vbyte_index_entry_t >::iterator
+    erase(first, last) -> std::vector< twenty48::vbyte_index_entry_t >::iterator
 
-Delete a portion of the StringVector.
+Delete a portion of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_erase__SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::iterator arg2 ;
+_wrap_VByteIndex_erase__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::iterator arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   swig::Iterator *iter2 = 0 ;
   int res2 ;
-  std::vector< std::string >::iterator result;
+  std::vector< twenty48::vbyte_index_entry_t >::iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","erase", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","erase", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], SWIG_as_voidptrptr(&iter2), swig::Iterator::descriptor(), 0);
   if (!SWIG_IsOK(res2) || !iter2) {
-    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 2, argv[0] ));
   } else {
-    swig::Iterator_T<std::vector< std::string >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter2);
+    swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter2);
     if (iter_t) {
       arg2 = iter_t->get_current();
     } else {
-      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 2, argv[0] ));
+      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 2, argv[0] ));
     }
   }
-  result = std_vector_Sl_std_string_Sg__erase__SWIG_0(arg1,arg2);
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::iterator & >(result),
+  result = std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__erase__SWIG_0(arg1,arg2);
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -32828,51 +33356,51 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_StringVector_erase__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::iterator arg2 ;
-  std::vector< std::string >::iterator arg3 ;
+_wrap_VByteIndex_erase__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::iterator arg2 ;
+  std::vector< twenty48::vbyte_index_entry_t >::iterator arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   swig::Iterator *iter2 = 0 ;
   int res2 ;
   swig::Iterator *iter3 = 0 ;
   int res3 ;
-  std::vector< std::string >::iterator result;
+  std::vector< twenty48::vbyte_index_entry_t >::iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","erase", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","erase", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], SWIG_as_voidptrptr(&iter2), swig::Iterator::descriptor(), 0);
   if (!SWIG_IsOK(res2) || !iter2) {
-    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 2, argv[0] ));
   } else {
-    swig::Iterator_T<std::vector< std::string >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter2);
+    swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter2);
     if (iter_t) {
       arg2 = iter_t->get_current();
     } else {
-      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 2, argv[0] ));
+      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 2, argv[0] ));
     }
   }
   res3 = SWIG_ConvertPtr(argv[1], SWIG_as_voidptrptr(&iter3), swig::Iterator::descriptor(), 0);
   if (!SWIG_IsOK(res3) || !iter3) {
-    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 3, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 3, argv[1] ));
   } else {
-    swig::Iterator_T<std::vector< std::string >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter3);
+    swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter3);
     if (iter_t) {
       arg3 = iter_t->get_current();
     } else {
-      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 3, argv[1] ));
+      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 3, argv[1] ));
     }
   }
-  result = std_vector_Sl_std_string_Sg__erase__SWIG_1(arg1,arg2,arg3);
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::iterator & >(result),
+  result = std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__erase__SWIG_1(arg1,arg2,arg3);
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -32881,7 +33409,7 @@ fail:
 }
 
 
-SWIGINTERN VALUE _wrap_StringVector_erase(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_VByteIndex_erase(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[4];
   int ii;
@@ -32894,31 +33422,31 @@ SWIGINTERN VALUE _wrap_StringVector_erase(int nargs, VALUE *args, VALUE self) {
   }
   if (argc == 2) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       swig::ConstIterator *iter = 0;
       int res = SWIG_ConvertPtr(argv[1], SWIG_as_voidptrptr(&iter), swig::Iterator::descriptor(), 0);
-      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter) != 0));
+      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter) != 0));
       if (_v) {
-        return _wrap_StringVector_erase__SWIG_0(nargs, args, self);
+        return _wrap_VByteIndex_erase__SWIG_0(nargs, args, self);
       }
     }
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       swig::ConstIterator *iter = 0;
       int res = SWIG_ConvertPtr(argv[1], SWIG_as_voidptrptr(&iter), swig::Iterator::descriptor(), 0);
-      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter) != 0));
+      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter) != 0));
       if (_v) {
         swig::ConstIterator *iter = 0;
         int res = SWIG_ConvertPtr(argv[2], SWIG_as_voidptrptr(&iter), swig::Iterator::descriptor(), 0);
-        _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter) != 0));
+        _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter) != 0));
         if (_v) {
-          return _wrap_StringVector_erase__SWIG_1(nargs, args, self);
+          return _wrap_VByteIndex_erase__SWIG_1(nargs, args, self);
         }
       }
     }
@@ -32926,8 +33454,8 @@ SWIGINTERN VALUE _wrap_StringVector_erase(int nargs, VALUE *args, VALUE self) {
   
 fail:
   Ruby_Format_OverloadedError( argc, 4, "erase", 
-    "    std::vector< std::string >::iterator erase(std::vector< std::string >::iterator pos)\n"
-    "    std::vector< std::string >::iterator erase(std::vector< std::string >::iterator first, std::vector< std::string >::iterator last)\n");
+    "    std::vector< twenty48::vbyte_index_entry_t >::iterator erase(std::vector< twenty48::vbyte_index_entry_t >::iterator pos)\n"
+    "    std::vector< twenty48::vbyte_index_entry_t >::iterator erase(std::vector< twenty48::vbyte_index_entry_t >::iterator first, std::vector< twenty48::vbyte_index_entry_t >::iterator last)\n");
   
   return Qnil;
 }
@@ -32935,12 +33463,12 @@ fail:
 
 SWIGINTERN VALUE
 #ifdef HAVE_RB_DEFINE_ALLOC_FUNC
-_wrap_StringVector_allocate(VALUE self)
+_wrap_VByteIndex_allocate(VALUE self)
 #else
-_wrap_StringVector_allocate(int argc, VALUE *argv, VALUE self)
+_wrap_VByteIndex_allocate(int argc, VALUE *argv, VALUE self)
 #endif
 {
-  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t);
+  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t);
 #ifndef HAVE_RB_DEFINE_ALLOC_FUNC
   rb_obj_call_init(vresult, argc, argv);
 #endif
@@ -32949,44 +33477,40 @@ _wrap_StringVector_allocate(int argc, VALUE *argv, VALUE self)
 
 
 SWIGINTERN VALUE
-_wrap_new_StringVector__SWIG_3(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string >::size_type arg1 ;
-  std::vector< std::string >::value_type *arg2 = 0 ;
+_wrap_new_VByteIndex__SWIG_3(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t >::size_type arg1 ;
+  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg2 = 0 ;
   size_t val1 ;
   int ecode1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  std::vector< std::string > *result = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t > *result = 0 ;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
   ecode1 = SWIG_AsVal_size_t(argv[0], &val1);
   if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","vector<(std::string)>", 1, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","vector<(twenty48::vbyte_index_entry_t)>", 1, argv[0] ));
   } 
-  arg1 = static_cast< std::vector< std::string >::size_type >(val1);
-  {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(argv[1], &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","vector<(std::string)>", 2, argv[1] )); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","vector<(std::string)>", 2, argv[1])); 
-    }
-    arg2 = ptr;
+  arg1 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","vector<(twenty48::vbyte_index_entry_t)>", 2, argv[1] )); 
   }
-  result = (std::vector< std::string > *)new std::vector< std::string >(arg1,(std::vector< std::string >::value_type const &)*arg2);
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","vector<(twenty48::vbyte_index_entry_t)>", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp2);
+  result = (std::vector< twenty48::vbyte_index_entry_t > *)new std::vector< twenty48::vbyte_index_entry_t >(arg1,(std::vector< twenty48::vbyte_index_entry_t >::value_type const &)*arg2);
   DATA_PTR(self) = result;
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return self;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_new_StringVector(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_new_VByteIndex(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[2];
   int ii;
@@ -32997,7 +33521,7 @@ SWIGINTERN VALUE _wrap_new_StringVector(int nargs, VALUE *args, VALUE self) {
     argv[ii] = args[ii];
   }
   if (argc == 0) {
-    return _wrap_new_StringVector__SWIG_0(nargs, args, self);
+    return _wrap_new_VByteIndex__SWIG_0(nargs, args, self);
   }
   if (argc == 1) {
     int _v;
@@ -33006,15 +33530,15 @@ SWIGINTERN VALUE _wrap_new_StringVector(int nargs, VALUE *args, VALUE self) {
       _v = SWIG_CheckState(res);
     }
     if (_v) {
-      return _wrap_new_StringVector__SWIG_2(nargs, args, self);
+      return _wrap_new_VByteIndex__SWIG_2(nargs, args, self);
     }
   }
   if (argc == 1) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
-      return _wrap_new_StringVector__SWIG_1(nargs, args, self);
+      return _wrap_new_VByteIndex__SWIG_1(nargs, args, self);
     }
   }
   if (argc == 2) {
@@ -33024,20 +33548,21 @@ SWIGINTERN VALUE _wrap_new_StringVector(int nargs, VALUE *args, VALUE self) {
       _v = SWIG_CheckState(res);
     }
     if (_v) {
-      int res = SWIG_AsPtr_std_string(argv[1], (std::string**)(0));
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0);
       _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_new_StringVector__SWIG_3(nargs, args, self);
+        return _wrap_new_VByteIndex__SWIG_3(nargs, args, self);
       }
     }
   }
   
 fail:
-  Ruby_Format_OverloadedError( argc, 2, "StringVector.new", 
-    "    StringVector.new()\n"
-    "    StringVector.new(std::vector< std::string > const &)\n"
-    "    StringVector.new(std::vector< std::string >::size_type size)\n"
-    "    StringVector.new(std::vector< std::string >::size_type size, std::vector< std::string >::value_type const &value)\n");
+  Ruby_Format_OverloadedError( argc, 2, "VByteIndex.new", 
+    "    VByteIndex.new()\n"
+    "    VByteIndex.new(std::vector< twenty48::vbyte_index_entry_t > const &)\n"
+    "    VByteIndex.new(std::vector< twenty48::vbyte_index_entry_t >::size_type size)\n"
+    "    VByteIndex.new(std::vector< twenty48::vbyte_index_entry_t >::size_type size, std::vector< twenty48::vbyte_index_entry_t >::value_type const &value)\n");
   
   return Qnil;
 }
@@ -33045,31 +33570,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.front
+  Document-method: Twenty48::VByteIndex.front
 
   call-seq:
-    front -> std::vector< std::string >::value_type const &
+    front -> VByteIndexEntry
 
-Return the first element in StringVector.
+Return the first element in VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_front(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_front(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string >::value_type *result = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::value_type *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","front", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","front", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (std::vector< std::string >::value_type *) &((std::vector< std::string > const *)arg1)->front();
-  vresult = SWIG_From_std_string(static_cast< std::string >(*result));
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (std::vector< twenty48::vbyte_index_entry_t >::value_type *) &((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->front();
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -33078,31 +33603,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.back
+  Document-method: Twenty48::VByteIndex.back
 
   call-seq:
-    back -> std::vector< std::string >::value_type const &
+    back -> VByteIndexEntry
 
-Return the last element in StringVector.
+Return the last element in VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_back(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_back(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string >::value_type *result = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::value_type *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","back", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","back", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (std::vector< std::string >::value_type *) &((std::vector< std::string > const *)arg1)->back();
-  vresult = SWIG_From_std_string(static_cast< std::string >(*result));
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = (std::vector< twenty48::vbyte_index_entry_t >::value_type *) &((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->back();
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -33111,112 +33636,104 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.assign
+  Document-method: Twenty48::VByteIndex.assign
 
   call-seq:
     assign(n, x)
 
-Assign a new StringVector or portion of it.
+Assign a new VByteIndex or portion of it.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_assign(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::size_type arg2 ;
-  std::vector< std::string >::value_type *arg3 = 0 ;
+_wrap_VByteIndex_assign(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::size_type arg2 ;
+  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
   int ecode2 = 0 ;
-  int res3 = SWIG_OLDOBJ ;
+  void *argp3 ;
+  int res3 = 0 ;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","assign", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","assign", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   ecode2 = SWIG_AsVal_size_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","assign", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","assign", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< std::string >::size_type >(val2);
-  {
-    std::string *ptr = (std::string *)0;
-    res3 = SWIG_AsPtr_std_string(argv[1], &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","assign", 3, argv[1] )); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","assign", 3, argv[1])); 
-    }
-    arg3 = ptr;
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val2);
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","assign", 3, argv[1] )); 
   }
-  (arg1)->assign(arg2,(std::vector< std::string >::value_type const &)*arg3);
-  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","assign", 3, argv[1])); 
+  }
+  arg3 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp3);
+  (arg1)->assign(arg2,(std::vector< twenty48::vbyte_index_entry_t >::value_type const &)*arg3);
   return Qnil;
 fail:
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 }
 
 
 
 /*
-  Document-method: Twenty48::StringVector.resize
+  Document-method: Twenty48::VByteIndex.resize
 
   call-seq:
     resize(new_size)
     resize(new_size, x)
 
-Resize the size of the StringVector.
+Resize the size of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_resize__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::size_type arg2 ;
-  std::vector< std::string >::value_type *arg3 = 0 ;
+_wrap_VByteIndex_resize__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::size_type arg2 ;
+  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
   int ecode2 = 0 ;
-  int res3 = SWIG_OLDOBJ ;
+  void *argp3 ;
+  int res3 = 0 ;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","resize", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","resize", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   ecode2 = SWIG_AsVal_size_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","resize", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","resize", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< std::string >::size_type >(val2);
-  {
-    std::string *ptr = (std::string *)0;
-    res3 = SWIG_AsPtr_std_string(argv[1], &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","resize", 3, argv[1] )); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","resize", 3, argv[1])); 
-    }
-    arg3 = ptr;
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val2);
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","resize", 3, argv[1] )); 
   }
-  (arg1)->resize(arg2,(std::vector< std::string >::value_type const &)*arg3);
-  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","resize", 3, argv[1])); 
+  }
+  arg3 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp3);
+  (arg1)->resize(arg2,(std::vector< twenty48::vbyte_index_entry_t >::value_type const &)*arg3);
   return Qnil;
 fail:
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_StringVector_resize(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_VByteIndex_resize(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[4];
   int ii;
@@ -33229,7 +33746,7 @@ SWIGINTERN VALUE _wrap_StringVector_resize(int nargs, VALUE *args, VALUE self) {
   }
   if (argc == 2) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -33237,13 +33754,13 @@ SWIGINTERN VALUE _wrap_StringVector_resize(int nargs, VALUE *args, VALUE self) {
         _v = SWIG_CheckState(res);
       }
       if (_v) {
-        return _wrap_StringVector_resize__SWIG_0(nargs, args, self);
+        return _wrap_VByteIndex_resize__SWIG_0(nargs, args, self);
       }
     }
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -33251,19 +33768,20 @@ SWIGINTERN VALUE _wrap_StringVector_resize(int nargs, VALUE *args, VALUE self) {
         _v = SWIG_CheckState(res);
       }
       if (_v) {
-        int res = SWIG_AsPtr_std_string(argv[2], (std::string**)(0));
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0);
         _v = SWIG_CheckState(res);
         if (_v) {
-          return _wrap_StringVector_resize__SWIG_1(nargs, args, self);
+          return _wrap_VByteIndex_resize__SWIG_1(nargs, args, self);
         }
       }
     }
   }
   
 fail:
-  Ruby_Format_OverloadedError( argc, 4, "StringVector.resize", 
-    "    void StringVector.resize(std::vector< std::string >::size_type new_size)\n"
-    "    void StringVector.resize(std::vector< std::string >::size_type new_size, std::vector< std::string >::value_type const &x)\n");
+  Ruby_Format_OverloadedError( argc, 4, "VByteIndex.resize", 
+    "    void VByteIndex.resize(std::vector< twenty48::vbyte_index_entry_t >::size_type new_size)\n"
+    "    void VByteIndex.resize(std::vector< twenty48::vbyte_index_entry_t >::size_type new_size, std::vector< twenty48::vbyte_index_entry_t >::value_type const &x)\n");
   
   return Qnil;
 }
@@ -33271,129 +33789,121 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.insert
+  Document-method: Twenty48::VByteIndex.insert
 
   call-seq:
-    insert(pos, argc) -> StringVector
-    insert(pos, x) -> std::vector< std::string >::iterator
+    insert(pos, argc) -> VByteIndex
+    insert(pos, x) -> std::vector< twenty48::vbyte_index_entry_t >::iterator
     insert(pos, n, x)
 
-Insert one or more new elements in the StringVector.
+Insert one or more new elements in the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_insert__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::iterator arg2 ;
-  std::vector< std::string >::value_type *arg3 = 0 ;
+_wrap_VByteIndex_insert__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::iterator arg2 ;
+  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   swig::Iterator *iter2 = 0 ;
   int res2 ;
-  int res3 = SWIG_OLDOBJ ;
-  std::vector< std::string >::iterator result;
+  void *argp3 ;
+  int res3 = 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","insert", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","insert", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], SWIG_as_voidptrptr(&iter2), swig::Iterator::descriptor(), 0);
   if (!SWIG_IsOK(res2) || !iter2) {
-    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","insert", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","insert", 2, argv[0] ));
   } else {
-    swig::Iterator_T<std::vector< std::string >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter2);
+    swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter2);
     if (iter_t) {
       arg2 = iter_t->get_current();
     } else {
-      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","insert", 2, argv[0] ));
+      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","insert", 2, argv[0] ));
     }
   }
-  {
-    std::string *ptr = (std::string *)0;
-    res3 = SWIG_AsPtr_std_string(argv[1], &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","insert", 3, argv[1] )); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","insert", 3, argv[1])); 
-    }
-    arg3 = ptr;
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","insert", 3, argv[1] )); 
   }
-  result = std_vector_Sl_std_string_Sg__insert__SWIG_1(arg1,arg2,(std::string const &)*arg3);
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::iterator & >(result),
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","insert", 3, argv[1])); 
+  }
+  arg3 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp3);
+  result = std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__insert__SWIG_1(arg1,arg2,(twenty48::vbyte_index_entry_t const &)*arg3);
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return vresult;
 fail:
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_StringVector_insert__SWIG_2(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::iterator arg2 ;
-  std::vector< std::string >::size_type arg3 ;
-  std::vector< std::string >::value_type *arg4 = 0 ;
+_wrap_VByteIndex_insert__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::iterator arg2 ;
+  std::vector< twenty48::vbyte_index_entry_t >::size_type arg3 ;
+  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg4 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   swig::Iterator *iter2 = 0 ;
   int res2 ;
   size_t val3 ;
   int ecode3 = 0 ;
-  int res4 = SWIG_OLDOBJ ;
+  void *argp4 ;
+  int res4 = 0 ;
   
   if ((argc < 3) || (argc > 3)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","insert", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","insert", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], SWIG_as_voidptrptr(&iter2), swig::Iterator::descriptor(), 0);
   if (!SWIG_IsOK(res2) || !iter2) {
-    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","insert", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","insert", 2, argv[0] ));
   } else {
-    swig::Iterator_T<std::vector< std::string >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter2);
+    swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter2);
     if (iter_t) {
       arg2 = iter_t->get_current();
     } else {
-      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","insert", 2, argv[0] ));
+      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","insert", 2, argv[0] ));
     }
   }
   ecode3 = SWIG_AsVal_size_t(argv[1], &val3);
   if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","insert", 3, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","insert", 3, argv[1] ));
   } 
-  arg3 = static_cast< std::vector< std::string >::size_type >(val3);
-  {
-    std::string *ptr = (std::string *)0;
-    res4 = SWIG_AsPtr_std_string(argv[2], &ptr);
-    if (!SWIG_IsOK(res4)) {
-      SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","insert", 4, argv[2] )); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","insert", 4, argv[2])); 
-    }
-    arg4 = ptr;
+  arg3 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val3);
+  res4 = SWIG_ConvertPtr(argv[2], &argp4, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","insert", 4, argv[2] )); 
   }
-  std_vector_Sl_std_string_Sg__insert__SWIG_2(arg1,arg2,arg3,(std::string const &)*arg4);
-  if (SWIG_IsNewObj(res4)) delete arg4;
+  if (!argp4) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","insert", 4, argv[2])); 
+  }
+  arg4 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp4);
+  std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__insert__SWIG_2(arg1,arg2,arg3,(twenty48::vbyte_index_entry_t const &)*arg4);
   return Qnil;
 fail:
-  if (SWIG_IsNewObj(res4)) delete arg4;
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_StringVector_insert(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_VByteIndex_insert(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[5];
   int ii;
@@ -33406,24 +33916,25 @@ SWIGINTERN VALUE _wrap_StringVector_insert(int nargs, VALUE *args, VALUE self) {
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       swig::ConstIterator *iter = 0;
       int res = SWIG_ConvertPtr(argv[1], SWIG_as_voidptrptr(&iter), swig::Iterator::descriptor(), 0);
-      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter) != 0));
+      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter) != 0));
       if (_v) {
-        int res = SWIG_AsPtr_std_string(argv[2], (std::string**)(0));
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0);
         _v = SWIG_CheckState(res);
         if (_v) {
-          return _wrap_StringVector_insert__SWIG_1(nargs, args, self);
+          return _wrap_VByteIndex_insert__SWIG_1(nargs, args, self);
         }
       }
     }
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -33437,31 +33948,32 @@ SWIGINTERN VALUE _wrap_StringVector_insert(int nargs, VALUE *args, VALUE self) {
         }
         if (_v) {
           if (argc <= 3) {
-            return _wrap_StringVector_insert__SWIG_0(nargs, args, self);
+            return _wrap_VByteIndex_insert__SWIG_0(nargs, args, self);
           }
-          return _wrap_StringVector_insert__SWIG_0(nargs, args, self);
+          return _wrap_VByteIndex_insert__SWIG_0(nargs, args, self);
         }
       }
     }
   }
   if (argc == 4) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       swig::ConstIterator *iter = 0;
       int res = SWIG_ConvertPtr(argv[1], SWIG_as_voidptrptr(&iter), swig::Iterator::descriptor(), 0);
-      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter) != 0));
+      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter) != 0));
       if (_v) {
         {
           int res = SWIG_AsVal_size_t(argv[2], NULL);
           _v = SWIG_CheckState(res);
         }
         if (_v) {
-          int res = SWIG_AsPtr_std_string(argv[3], (std::string**)(0));
+          void *vptr = 0;
+          int res = SWIG_ConvertPtr(argv[3], &vptr, SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0);
           _v = SWIG_CheckState(res);
           if (_v) {
-            return _wrap_StringVector_insert__SWIG_2(nargs, args, self);
+            return _wrap_VByteIndex_insert__SWIG_2(nargs, args, self);
           }
         }
       }
@@ -33470,9 +33982,9 @@ SWIGINTERN VALUE _wrap_StringVector_insert(int nargs, VALUE *args, VALUE self) {
   
 fail:
   Ruby_Format_OverloadedError( argc, 5, "insert", 
-    "    std::vector< std::string,std::allocator< std::string > > insert(std::vector< std::string >::difference_type pos, int argc, VALUE *argv, ...)\n"
-    "    std::vector< std::string >::iterator insert(std::vector< std::string >::iterator pos, std::vector< std::string >::value_type const &x)\n"
-    "    void insert(std::vector< std::string >::iterator pos, std::vector< std::string >::size_type n, std::vector< std::string >::value_type const &x)\n");
+    "    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > insert(std::vector< twenty48::vbyte_index_entry_t >::difference_type pos, int argc, VALUE *argv, ...)\n"
+    "    std::vector< twenty48::vbyte_index_entry_t >::iterator insert(std::vector< twenty48::vbyte_index_entry_t >::iterator pos, std::vector< twenty48::vbyte_index_entry_t >::value_type const &x)\n"
+    "    void insert(std::vector< twenty48::vbyte_index_entry_t >::iterator pos, std::vector< twenty48::vbyte_index_entry_t >::size_type n, std::vector< twenty48::vbyte_index_entry_t >::value_type const &x)\n");
   
   return Qnil;
 }
@@ -33480,17 +33992,17 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.reserve
+  Document-method: Twenty48::VByteIndex.reserve
 
   call-seq:
     reserve(n)
 
-Reserve memory in the StringVector for a number of elements.
+Reserve memory in the VByteIndex for a number of elements.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_reserve(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::vector< std::string >::size_type arg2 ;
+_wrap_VByteIndex_reserve(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+  std::vector< twenty48::vbyte_index_entry_t >::size_type arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
@@ -33499,16 +34011,16 @@ _wrap_StringVector_reserve(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","reserve", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","reserve", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
   ecode2 = SWIG_AsVal_size_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","reserve", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","reserve", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< std::string >::size_type >(val2);
+  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val2);
   (arg1)->reserve(arg2);
   return Qnil;
 fail:
@@ -33518,30 +34030,30 @@ fail:
 
 
 /*
-  Document-method: Twenty48::StringVector.capacity
+  Document-method: Twenty48::VByteIndex.capacity
 
   call-seq:
-    capacity -> std::vector< std::string >::size_type
+    capacity -> std::vector< twenty48::vbyte_index_entry_t >::size_type
 
-Reserved capacity of the StringVector.
+Reserved capacity of the VByteIndex.
 */
 SWIGINTERN VALUE
-_wrap_StringVector_capacity(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+_wrap_VByteIndex_capacity(int argc, VALUE *argv, VALUE self) {
+  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::string >::size_type result;
+  std::vector< twenty48::vbyte_index_entry_t >::size_type result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","capacity", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","capacity", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = ((std::vector< std::string > const *)arg1)->capacity();
+  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  result = ((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->capacity();
   vresult = SWIG_From_size_t(static_cast< size_t >(result));
   return vresult;
 fail:
@@ -33549,109 +34061,206 @@ fail:
 }
 
 
+SWIGINTERN void
+free_std_vector_Sl_twenty48_vbyte_index_entry_t_Sg_(void *self) {
+    std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *)self;
+    delete arg1;
+}
+
+static swig_class SwigClassVByteReader;
+
 SWIGINTERN VALUE
-_wrap_StringVector_map_bang(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
-  VALUE vresult = Qnil;
+_wrap_new_VByteReader__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  uint64_t arg3 ;
+  size_t arg4 ;
+  size_t arg5 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  unsigned long long val3 ;
+  int ecode3 = 0 ;
+  size_t val4 ;
+  int ecode4 = 0 ;
+  size_t val5 ;
+  int ecode5 = 0 ;
+  twenty48::vbyte_reader_t *result = 0 ;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 5) || (argc > 5)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 5)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","map_bang", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","vbyte_reader_t", 1, argv[0] ));
   }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__map_bang(arg1);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
-  return vresult;
+  arg1 = reinterpret_cast< char * >(buf1);
+  ecode2 = SWIG_AsVal_size_t(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","vbyte_reader_t", 2, argv[1] ));
+  } 
+  arg2 = static_cast< size_t >(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "uint64_t","vbyte_reader_t", 3, argv[2] ));
+  } 
+  arg3 = static_cast< uint64_t >(val3);
+  ecode4 = SWIG_AsVal_size_t(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","vbyte_reader_t", 4, argv[3] ));
+  } 
+  arg4 = static_cast< size_t >(val4);
+  ecode5 = SWIG_AsVal_size_t(argv[4], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "size_t","vbyte_reader_t", 5, argv[4] ));
+  } 
+  arg5 = static_cast< size_t >(val5);
+  result = (twenty48::vbyte_reader_t *)new twenty48::vbyte_reader_t((char const *)arg1,arg2,arg3,arg4,arg5);
+  DATA_PTR(self) = result;
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return self;
 fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return Qnil;
 }
 
 
-
-/*
-  Document-method: Twenty48::StringVector.__delete__
-
-  call-seq:
-    __delete__(val) -> VALUE
-
-Delete a matching element.
-*/
 SWIGINTERN VALUE
-_wrap_StringVector___delete__(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
-  std::string *arg2 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  VALUE result;
-  VALUE vresult = Qnil;
+_wrap_new_VByteReader__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  uint64_t arg3 ;
+  size_t arg4 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  unsigned long long val3 ;
+  int ecode3 = 0 ;
+  size_t val4 ;
+  int ecode4 = 0 ;
+  twenty48::vbyte_reader_t *result = 0 ;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","__delete__", 1, self )); 
-  }
-  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
-  {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::string const &","__delete__", 2, argv[0] )); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string const &","__delete__", 2, argv[0])); 
-    }
-    arg2 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","vbyte_reader_t", 1, argv[0] ));
   }
-  result = (VALUE)std_vector_Sl_std_string_Sg____delete__(arg1,(std::string const &)*arg2);
-  vresult = result;
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  return vresult;
+  arg1 = reinterpret_cast< char * >(buf1);
+  ecode2 = SWIG_AsVal_size_t(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","vbyte_reader_t", 2, argv[1] ));
+  } 
+  arg2 = static_cast< size_t >(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "uint64_t","vbyte_reader_t", 3, argv[2] ));
+  } 
+  arg3 = static_cast< uint64_t >(val3);
+  ecode4 = SWIG_AsVal_size_t(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","vbyte_reader_t", 4, argv[3] ));
+  } 
+  arg4 = static_cast< size_t >(val4);
+  result = (twenty48::vbyte_reader_t *)new twenty48::vbyte_reader_t((char const *)arg1,arg2,arg3,arg4);
+  DATA_PTR(self) = result;
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return self;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return Qnil;
 }
 
 
-SWIGINTERN void
-free_std_vector_Sl_std_string_Sg_(void *self) {
-    std::vector< std::string > *arg1 = (std::vector< std::string > *)self;
-    delete arg1;
+SWIGINTERN VALUE
+_wrap_new_VByteReader__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  uint64_t arg3 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  unsigned long long val3 ;
+  int ecode3 = 0 ;
+  twenty48::vbyte_reader_t *result = 0 ;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","vbyte_reader_t", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  ecode2 = SWIG_AsVal_size_t(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","vbyte_reader_t", 2, argv[1] ));
+  } 
+  arg2 = static_cast< size_t >(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "uint64_t","vbyte_reader_t", 3, argv[2] ));
+  } 
+  arg3 = static_cast< uint64_t >(val3);
+  result = (twenty48::vbyte_reader_t *)new twenty48::vbyte_reader_t((char const *)arg1,arg2,arg3);
+  DATA_PTR(self) = result;
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return self;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
 }
 
-static swig_class SwigClassVByteIndexEntry;
 
 SWIGINTERN VALUE
-_wrap_new_VByteIndexEntry__SWIG_0(int argc, VALUE *argv, VALUE self) {
-  twenty48::vbyte_index_entry_t *result = 0 ;
+_wrap_new_VByteReader__SWIG_3(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  twenty48::vbyte_reader_t *result = 0 ;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  result = (twenty48::vbyte_index_entry_t *)new twenty48::vbyte_index_entry_t();
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","vbyte_reader_t", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  ecode2 = SWIG_AsVal_size_t(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","vbyte_reader_t", 2, argv[1] ));
+  } 
+  arg2 = static_cast< size_t >(val2);
+  result = (twenty48::vbyte_reader_t *)new twenty48::vbyte_reader_t((char const *)arg1,arg2);
   DATA_PTR(self) = result;
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return self;
 fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
 #ifdef HAVE_RB_DEFINE_ALLOC_FUNC
-_wrap_VByteIndexEntry_allocate(VALUE self)
+_wrap_VByteReader_allocate(VALUE self)
 #else
-_wrap_VByteIndexEntry_allocate(int argc, VALUE *argv, VALUE self)
+_wrap_VByteReader_allocate(int argc, VALUE *argv, VALUE self)
 #endif
 {
-  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__vbyte_index_entry_t);
+  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__vbyte_reader_t);
 #ifndef HAVE_RB_DEFINE_ALLOC_FUNC
   rb_obj_call_init(vresult, argc, argv);
 #endif
@@ -33660,122 +34269,196 @@ _wrap_VByteIndexEntry_allocate(int argc, VALUE *argv, VALUE self)
 
 
 SWIGINTERN VALUE
-_wrap_new_VByteIndexEntry__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  size_t arg1 ;
-  uint64_t arg2 ;
-  size_t val1 ;
-  int ecode1 = 0 ;
-  unsigned long long val2 ;
-  int ecode2 = 0 ;
-  twenty48::vbyte_index_entry_t *result = 0 ;
+_wrap_new_VByteReader__SWIG_4(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  twenty48::vbyte_reader_t *result = 0 ;
   
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  ecode1 = SWIG_AsVal_size_t(argv[0], &val1);
-  if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "size_t","vbyte_index_entry_t", 1, argv[0] ));
-  } 
-  arg1 = static_cast< size_t >(val1);
-  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","vbyte_index_entry_t", 2, argv[1] ));
-  } 
-  arg2 = static_cast< uint64_t >(val2);
-  result = (twenty48::vbyte_index_entry_t *)new twenty48::vbyte_index_entry_t(arg1,arg2);
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","vbyte_reader_t", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  result = (twenty48::vbyte_reader_t *)new twenty48::vbyte_reader_t((char const *)arg1);
   DATA_PTR(self) = result;
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return self;
 fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_new_VByteIndexEntry(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_new_VByteReader(int nargs, VALUE *args, VALUE self) {
   int argc;
-  VALUE argv[2];
+  VALUE argv[5];
   int ii;
   
   argc = nargs;
-  if (argc > 2) SWIG_fail;
+  if (argc > 5) SWIG_fail;
   for (ii = 0; (ii < argc); ++ii) {
     argv[ii] = args[ii];
   }
-  if (argc == 0) {
-    return _wrap_new_VByteIndexEntry__SWIG_0(nargs, args, self);
+  if (argc == 1) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_new_VByteReader__SWIG_4(nargs, args, self);
+    }
   }
   if (argc == 2) {
     int _v;
-    {
-      int res = SWIG_AsVal_size_t(argv[0], NULL);
-      _v = SWIG_CheckState(res);
-    }
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_unsigned_SS_long_SS_long(argv[1], NULL);
+        int res = SWIG_AsVal_size_t(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
-        return _wrap_new_VByteIndexEntry__SWIG_1(nargs, args, self);
+        return _wrap_new_VByteReader__SWIG_3(nargs, args, self);
       }
     }
   }
-  
-fail:
-  Ruby_Format_OverloadedError( argc, 2, "vbyte_index_entry_t.new", 
-    "    vbyte_index_entry_t.new()\n"
-    "    vbyte_index_entry_t.new(size_t byte_offset, uint64_t previous)\n");
-  
-  return Qnil;
-}
-
-
-SWIGINTERN VALUE
-_wrap_VByteIndexEntry_byte_offset_set(int argc, VALUE *argv, VALUE self) {
-  twenty48::vbyte_index_entry_t *arg1 = (twenty48::vbyte_index_entry_t *) 0 ;
-  size_t arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  size_t val2 ;
-  int ecode2 = 0 ;
-  
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if (argc == 3) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_size_t(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_unsigned_SS_long_SS_long(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_new_VByteReader__SWIG_2(nargs, args, self);
+        }
+      }
+    }
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_index_entry_t *","byte_offset", 1, self )); 
+  if (argc == 4) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_size_t(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_unsigned_SS_long_SS_long(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_size_t(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_new_VByteReader__SWIG_1(nargs, args, self);
+          }
+        }
+      }
+    }
   }
-  arg1 = reinterpret_cast< twenty48::vbyte_index_entry_t * >(argp1);
-  ecode2 = SWIG_AsVal_size_t(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","byte_offset", 2, argv[0] ));
-  } 
-  arg2 = static_cast< size_t >(val2);
-  if (arg1) (arg1)->byte_offset = arg2;
+  if (argc == 5) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_size_t(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_unsigned_SS_long_SS_long(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_size_t(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_size_t(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_new_VByteReader__SWIG_0(nargs, args, self);
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 5, "vbyte_reader_t.new", 
+    "    vbyte_reader_t.new(char const *pathname, size_t byte_offset, uint64_t previous, size_t max_states, size_t buffer_size)\n"
+    "    vbyte_reader_t.new(char const *pathname, size_t byte_offset, uint64_t previous, size_t max_states)\n"
+    "    vbyte_reader_t.new(char const *pathname, size_t byte_offset, uint64_t previous)\n"
+    "    vbyte_reader_t.new(char const *pathname, size_t byte_offset)\n"
+    "    vbyte_reader_t.new(char const *pathname)\n");
+  
   return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_VByteReader_is_open(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_reader_t *arg1 = (twenty48::vbyte_reader_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_reader_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t const *","is_open", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp1);
+  result = (bool)((twenty48::vbyte_reader_t const *)arg1)->is_open();
+  vresult = SWIG_From_bool(static_cast< bool >(result));
+  return vresult;
 fail:
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_VByteIndexEntry_byte_offset_get(int argc, VALUE *argv, VALUE self) {
-  twenty48::vbyte_index_entry_t *arg1 = (twenty48::vbyte_index_entry_t *) 0 ;
+_wrap_VByteReader_read(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_reader_t *arg1 = (twenty48::vbyte_reader_t *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  size_t result;
+  uint64_t result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_reader_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_index_entry_t *","byte_offset", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t *","read", 1, self )); 
   }
-  arg1 = reinterpret_cast< twenty48::vbyte_index_entry_t * >(argp1);
-  result =  ((arg1)->byte_offset);
-  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  arg1 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp1);
+  result = (uint64_t)(arg1)->read();
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
   return vresult;
 fail:
   return Qnil;
@@ -33783,8 +34466,126 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteIndexEntry_previous_set(int argc, VALUE *argv, VALUE self) {
-  twenty48::vbyte_index_entry_t *arg1 = (twenty48::vbyte_index_entry_t *) 0 ;
+_wrap_VByteReader_close(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_reader_t *arg1 = (twenty48::vbyte_reader_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_reader_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t *","close", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp1);
+  (arg1)->close();
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_twenty48_vbyte_reader_t(void *self) {
+    twenty48::vbyte_reader_t *arg1 = (twenty48::vbyte_reader_t *)self;
+    delete arg1;
+}
+
+static swig_class SwigClassVByteWriter;
+
+SWIGINTERN VALUE
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+_wrap_VByteWriter_allocate(VALUE self)
+#else
+_wrap_VByteWriter_allocate(int argc, VALUE *argv, VALUE self)
+#endif
+{
+  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__vbyte_writer_t);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+  rb_obj_call_init(vresult, argc, argv);
+#endif
+  return vresult;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_VByteWriter(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  twenty48::vbyte_writer_t *result = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","vbyte_writer_t", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  result = (twenty48::vbyte_writer_t *)new twenty48::vbyte_writer_t((char const *)arg1);
+  DATA_PTR(self) = result;
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return self;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_VByteWriter_get_bytes_written(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_writer_t *arg1 = (twenty48::vbyte_writer_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint64_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_writer_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_writer_t const *","get_bytes_written", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::vbyte_writer_t * >(argp1);
+  result = (uint64_t)((twenty48::vbyte_writer_t const *)arg1)->get_bytes_written();
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_VByteWriter_get_previous(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_writer_t *arg1 = (twenty48::vbyte_writer_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint64_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_writer_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_writer_t const *","get_previous", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::vbyte_writer_t * >(argp1);
+  result = (uint64_t)((twenty48::vbyte_writer_t const *)arg1)->get_previous();
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_VByteWriter_write(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_writer_t *arg1 = (twenty48::vbyte_writer_t *) 0 ;
   uint64_t arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -33794,17 +34595,17 @@ _wrap_VByteIndexEntry_previous_set(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_writer_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_index_entry_t *","previous", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_writer_t *","write", 1, self )); 
   }
-  arg1 = reinterpret_cast< twenty48::vbyte_index_entry_t * >(argp1);
+  arg1 = reinterpret_cast< twenty48::vbyte_writer_t * >(argp1);
   ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","previous", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","write", 2, argv[0] ));
   } 
   arg2 = static_cast< uint64_t >(val2);
-  if (arg1) (arg1)->previous = arg2;
+  (arg1)->write(arg2);
   return Qnil;
 fail:
   return Qnil;
@@ -33812,64 +34613,61 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteIndexEntry_previous_get(int argc, VALUE *argv, VALUE self) {
-  twenty48::vbyte_index_entry_t *arg1 = (twenty48::vbyte_index_entry_t *) 0 ;
+_wrap_VByteWriter_close(int argc, VALUE *argv, VALUE self) {
+  twenty48::vbyte_writer_t *arg1 = (twenty48::vbyte_writer_t *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  uint64_t result;
-  VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_writer_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_index_entry_t *","previous", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_writer_t *","close", 1, self )); 
   }
-  arg1 = reinterpret_cast< twenty48::vbyte_index_entry_t * >(argp1);
-  result = (uint64_t) ((arg1)->previous);
-  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
-  return vresult;
+  arg1 = reinterpret_cast< twenty48::vbyte_writer_t * >(argp1);
+  (arg1)->close();
+  return Qnil;
 fail:
   return Qnil;
 }
 
 
 SWIGINTERN void
-free_twenty48_vbyte_index_entry_t(void *self) {
-    twenty48::vbyte_index_entry_t *arg1 = (twenty48::vbyte_index_entry_t *)self;
+free_twenty48_vbyte_writer_t(void *self) {
+    twenty48::vbyte_writer_t *arg1 = (twenty48::vbyte_writer_t *)self;
     delete arg1;
 }
 
-static swig_class SwigClassVByteIndex;
+static swig_class SwigClassStringVector;
 
 
 /*
-  Document-method: Twenty48::VByteIndex.dup
+  Document-method: Twenty48::StringVector.dup
 
   call-seq:
-    dup -> VByteIndex
+    dup -> StringVector
 
 Create a duplicate of the class and unfreeze it if needed.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_dup(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_dup(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
+  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","dup", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","dup", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__dup(arg1);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, SWIG_POINTER_OWN |  0 );
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__dup(arg1);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -33878,7 +34676,7 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.inspect
+  Document-method: Twenty48::StringVector.inspect
 
   call-seq:
     inspect -> VALUE
@@ -33886,8 +34684,8 @@ fail:
 Inspect class and its contents.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_inspect(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_inspect(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   VALUE result;
@@ -33896,12 +34694,12 @@ _wrap_VByteIndex_inspect(int argc, VALUE *argv, VALUE self) {
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","inspect", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","inspect", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__inspect(arg1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (VALUE)std_vector_Sl_std_string_Sg__inspect(arg1);
   vresult = result;
   return vresult;
 fail:
@@ -33911,16 +34709,16 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.to_a
+  Document-method: Twenty48::StringVector.to_a
 
   call-seq:
     to_a -> VALUE
 
-Convert VByteIndex to an Array.
+Convert StringVector to an Array.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_to_a(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_to_a(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   VALUE result;
@@ -33929,12 +34727,12 @@ _wrap_VByteIndex_to_a(int argc, VALUE *argv, VALUE self) {
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","to_a", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","to_a", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__to_a(arg1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (VALUE)std_vector_Sl_std_string_Sg__to_a(arg1);
   vresult = result;
   return vresult;
 fail:
@@ -33944,7 +34742,7 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.to_s
+  Document-method: Twenty48::StringVector.to_s
 
   call-seq:
     to_s -> VALUE
@@ -33952,8 +34750,8 @@ fail:
 Convert class to a String representation.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_to_s(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_to_s(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   VALUE result;
@@ -33962,12 +34760,12 @@ _wrap_VByteIndex_to_s(int argc, VALUE *argv, VALUE self) {
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","to_s", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","to_s", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__to_s(arg1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (VALUE)std_vector_Sl_std_string_Sg__to_s(arg1);
   vresult = result;
   return vresult;
 fail:
@@ -33977,18 +34775,18 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.slice
+  Document-method: Twenty48::StringVector.slice
 
   call-seq:
     slice(i, length) -> VALUE
 
-Return a slice (portion of) the VByteIndex.
+Return a slice (portion of) the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_slice(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
-  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg3 ;
+_wrap_StringVector_slice(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::difference_type arg2 ;
+  std::vector< std::string >::difference_type arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   ptrdiff_t val2 ;
@@ -34001,23 +34799,23 @@ _wrap_VByteIndex_slice(int argc, VALUE *argv, VALUE self) {
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","slice", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","slice", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","slice", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","slice", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
+  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
   ecode3 = SWIG_AsVal_ptrdiff_t(argv[1], &val3);
   if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","slice", 3, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","slice", 3, argv[1] ));
   } 
-  arg3 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val3);
+  arg3 = static_cast< std::vector< std::string >::difference_type >(val3);
   try {
-    result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__slice(arg1,arg2,arg3);
+    result = (VALUE)std_vector_Sl_std_string_Sg__slice(arg1,arg2,arg3);
   }
   catch(std::invalid_argument &_e) {
     SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
@@ -34032,31 +34830,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.each
+  Document-method: Twenty48::StringVector.each
 
   call-seq:
-    each -> VByteIndex
+    each -> StringVector
 
-Iterate thru each element in the VByteIndex.  A block must be provided.
+Iterate thru each element in the StringVector.  A block must be provided.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_each(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_each(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
+  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","each", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","each", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__each(arg1);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__each(arg1);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -34064,67 +34862,71 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteIndex___delete2__(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg2 = 0 ;
+_wrap_StringVector___delete2__(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::value_type *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
   VALUE result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","__delete2__", 1, self )); 
-  }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","__delete2__", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","__delete2__", 1, self )); 
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","__delete2__", 2, argv[0])); 
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","__delete2__", 2, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","__delete2__", 2, argv[0])); 
+    }
+    arg2 = ptr;
   }
-  arg2 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp2);
-  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____delete2__(arg1,(twenty48::vbyte_index_entry_t const &)*arg2);
+  result = (VALUE)std_vector_Sl_std_string_Sg____delete2__(arg1,(std::string const &)*arg2);
   vresult = result;
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return vresult;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return Qnil;
 }
 
 
 
 /*
-  Document-method: Twenty48::VByteIndex.select
+  Document-method: Twenty48::StringVector.select
 
   call-seq:
-    select -> VByteIndex
+    select -> StringVector
 
-Iterate thru each element in the VByteIndex and select those that match a condition.  A block must be provided.
+Iterate thru each element in the StringVector and select those that match a condition.  A block must be provided.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_select(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_select(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
+  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","select", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","select", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__select(arg1);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, SWIG_POINTER_OWN |  0 );
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__select(arg1);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -34133,7 +34935,7 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.delete_at
+  Document-method: Twenty48::StringVector.delete_at
 
   call-seq:
     delete_at(i) -> VALUE
@@ -34141,9 +34943,9 @@ fail:
 Delete an element at a certain index.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_delete_at(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
+_wrap_StringVector_delete_at(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::difference_type arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   ptrdiff_t val2 ;
@@ -34154,17 +34956,17 @@ _wrap_VByteIndex_delete_at(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","delete_at", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","delete_at", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","delete_at", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","delete_at", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
-  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__delete_at(arg1,arg2);
+  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
+  result = (VALUE)std_vector_Sl_std_string_Sg__delete_at(arg1,arg2);
   vresult = result;
   return vresult;
 fail:
@@ -34174,7 +34976,7 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.at
+  Document-method: Twenty48::StringVector.at
 
   call-seq:
     at(i) -> VALUE
@@ -34182,9 +34984,9 @@ fail:
 Return element at a certain index.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_at(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
+_wrap_StringVector_at(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::difference_type arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   ptrdiff_t val2 ;
@@ -34195,17 +34997,17 @@ _wrap_VByteIndex_at(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","at", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","at", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","at", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","at", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
-  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__at((std::vector< twenty48::vbyte_index_entry_t > const *)arg1,arg2);
+  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
+  result = (VALUE)std_vector_Sl_std_string_Sg__at((std::vector< std::string > const *)arg1,arg2);
   vresult = result;
   return vresult;
 fail:
@@ -34215,7 +35017,7 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.[]
+  Document-method: Twenty48::StringVector.[]
 
   call-seq:
     [](i, length) -> VALUE
@@ -34225,10 +35027,10 @@ fail:
 Element accessor/slicing.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex___getitem____SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
-  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg3 ;
+_wrap_StringVector___getitem____SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::difference_type arg2 ;
+  std::vector< std::string >::difference_type arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   ptrdiff_t val2 ;
@@ -34241,23 +35043,23 @@ _wrap_VByteIndex___getitem____SWIG_0(int argc, VALUE *argv, VALUE self) {
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","__getitem__", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","__getitem__", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__getitem__", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__getitem__", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
+  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
   ecode3 = SWIG_AsVal_ptrdiff_t(argv[1], &val3);
   if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__getitem__", 3, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__getitem__", 3, argv[1] ));
   } 
-  arg3 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val3);
+  arg3 = static_cast< std::vector< std::string >::difference_type >(val3);
   try {
-    result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____getitem____SWIG_0((std::vector< twenty48::vbyte_index_entry_t > const *)arg1,arg2,arg3);
+    result = (VALUE)std_vector_Sl_std_string_Sg____getitem____SWIG_0((std::vector< std::string > const *)arg1,arg2,arg3);
   }
   catch(std::invalid_argument &_e) {
     SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
@@ -34271,9 +35073,9 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteIndex___getitem____SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
+_wrap_StringVector___getitem____SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::difference_type arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   ptrdiff_t val2 ;
@@ -34284,18 +35086,18 @@ _wrap_VByteIndex___getitem____SWIG_1(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","__getitem__", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","__getitem__", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__getitem__", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__getitem__", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
-  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____getitem____SWIG_1((std::vector< twenty48::vbyte_index_entry_t > const *)arg1,arg2);
-  vresult = result;
+  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
+  result = (VALUE)std_vector_Sl_std_string_Sg____getitem____SWIG_1((std::vector< std::string > const *)arg1,arg2);
+  vresult = result;
   return vresult;
 fail:
   return Qnil;
@@ -34303,8 +35105,8 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteIndex___getitem____SWIG_2(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector___getitem____SWIG_2(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   VALUE arg2 = (VALUE) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -34314,14 +35116,14 @@ _wrap_VByteIndex___getitem____SWIG_2(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","__getitem__", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","__getitem__", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   arg2 = argv[0];
   try {
-    result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____getitem____SWIG_2((std::vector< twenty48::vbyte_index_entry_t > const *)arg1,arg2);
+    result = (VALUE)std_vector_Sl_std_string_Sg____getitem____SWIG_2((std::vector< std::string > const *)arg1,arg2);
   }
   catch(std::invalid_argument &_e) {
     SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
@@ -34334,7 +35136,7 @@ fail:
 }
 
 
-SWIGINTERN VALUE _wrap_VByteIndex___getitem__(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_StringVector___getitem__(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[4];
   int ii;
@@ -34347,7 +35149,7 @@ SWIGINTERN VALUE _wrap_VByteIndex___getitem__(int nargs, VALUE *args, VALUE self
   }
   if (argc == 2) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -34355,24 +35157,24 @@ SWIGINTERN VALUE _wrap_VByteIndex___getitem__(int nargs, VALUE *args, VALUE self
         _v = SWIG_CheckState(res);
       }
       if (_v) {
-        return _wrap_VByteIndex___getitem____SWIG_1(nargs, args, self);
+        return _wrap_StringVector___getitem____SWIG_1(nargs, args, self);
       }
     }
   }
   if (argc == 2) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       _v = (argv[1] != 0);
       if (_v) {
-        return _wrap_VByteIndex___getitem____SWIG_2(nargs, args, self);
+        return _wrap_StringVector___getitem____SWIG_2(nargs, args, self);
       }
     }
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -34385,7 +35187,7 @@ SWIGINTERN VALUE _wrap_VByteIndex___getitem__(int nargs, VALUE *args, VALUE self
           _v = SWIG_CheckState(res);
         }
         if (_v) {
-          return _wrap_VByteIndex___getitem____SWIG_0(nargs, args, self);
+          return _wrap_StringVector___getitem____SWIG_0(nargs, args, self);
         }
       }
     }
@@ -34393,8 +35195,8 @@ SWIGINTERN VALUE _wrap_VByteIndex___getitem__(int nargs, VALUE *args, VALUE self
   
 fail:
   Ruby_Format_OverloadedError( argc, 4, "__getitem__", 
-    "    VALUE __getitem__(std::vector< twenty48::vbyte_index_entry_t >::difference_type i, std::vector< twenty48::vbyte_index_entry_t >::difference_type length)\n"
-    "    VALUE __getitem__(std::vector< twenty48::vbyte_index_entry_t >::difference_type i)\n"
+    "    VALUE __getitem__(std::vector< std::string >::difference_type i, std::vector< std::string >::difference_type length)\n"
+    "    VALUE __getitem__(std::vector< std::string >::difference_type i)\n"
     "    VALUE __getitem__(VALUE i)\n");
   
   return Qnil;
@@ -34403,7 +35205,7 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.[]=
+  Document-method: Twenty48::StringVector.[]=
 
   call-seq:
     []=(i, x) -> VALUE
@@ -34412,42 +35214,44 @@ fail:
 Element setter/slicing.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex___setitem____SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
-  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg3 = 0 ;
+_wrap_StringVector___setitem____SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::difference_type arg2 ;
+  std::vector< std::string >::value_type *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   ptrdiff_t val2 ;
   int ecode2 = 0 ;
-  void *argp3 ;
-  int res3 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
   VALUE result;
   VALUE vresult = Qnil;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","__setitem__", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","__setitem__", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__setitem__", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__setitem__", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
-  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","__setitem__", 3, argv[1] )); 
-  }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","__setitem__", 3, argv[1])); 
+  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","__setitem__", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","__setitem__", 3, argv[1])); 
+    }
+    arg3 = ptr;
   }
-  arg3 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp3);
   try {
-    result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____setitem____SWIG_0(arg1,arg2,(twenty48::vbyte_index_entry_t const &)*arg3);
+    result = (VALUE)std_vector_Sl_std_string_Sg____setitem____SWIG_0(arg1,arg2,(std::string const &)*arg3);
   }
   catch(std::invalid_argument &_e) {
     SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
@@ -34457,18 +35261,20 @@ _wrap_VByteIndex___setitem____SWIG_0(int argc, VALUE *argv, VALUE self) {
   }
   
   vresult = result;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return vresult;
 fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_VByteIndex___setitem____SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
-  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg3 ;
-  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *arg4 = 0 ;
+_wrap_StringVector___setitem____SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::difference_type arg2 ;
+  std::vector< std::string >::difference_type arg3 ;
+  std::vector< std::string,std::allocator< std::string > > *arg4 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   ptrdiff_t val2 ;
@@ -34482,34 +35288,34 @@ _wrap_VByteIndex___setitem____SWIG_1(int argc, VALUE *argv, VALUE self) {
   if ((argc < 3) || (argc > 3)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","__setitem__", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","__setitem__", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__setitem__", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__setitem__", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
+  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
   ecode3 = SWIG_AsVal_ptrdiff_t(argv[1], &val3);
   if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","__setitem__", 3, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","__setitem__", 3, argv[1] ));
   } 
-  arg3 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val3);
+  arg3 = static_cast< std::vector< std::string >::difference_type >(val3);
   {
-    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *ptr = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)0;
+    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
     res4 = swig::asptr(argv[2], &ptr);
     if (!SWIG_IsOK(res4)) {
-      SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > const &","__setitem__", 4, argv[2] )); 
+      SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","__setitem__", 4, argv[2] )); 
     }
     if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > const &","__setitem__", 4, argv[2])); 
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","__setitem__", 4, argv[2])); 
     }
     arg4 = ptr;
   }
   try {
-    result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg____setitem____SWIG_1(arg1,arg2,arg3,(std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > const &)*arg4);
+    result = (VALUE)std_vector_Sl_std_string_Sg____setitem____SWIG_1(arg1,arg2,arg3,(std::vector< std::string,std::allocator< std::string > > const &)*arg4);
   }
   catch(std::invalid_argument &_e) {
     SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
@@ -34524,7 +35330,7 @@ fail:
 }
 
 
-SWIGINTERN VALUE _wrap_VByteIndex___setitem__(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_StringVector___setitem__(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[5];
   int ii;
@@ -34537,7 +35343,7 @@ SWIGINTERN VALUE _wrap_VByteIndex___setitem__(int nargs, VALUE *args, VALUE self
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -34545,18 +35351,17 @@ SWIGINTERN VALUE _wrap_VByteIndex___setitem__(int nargs, VALUE *args, VALUE self
         _v = SWIG_CheckState(res);
       }
       if (_v) {
-        void *vptr = 0;
-        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0);
+        int res = SWIG_AsPtr_std_string(argv[2], (std::string**)(0));
         _v = SWIG_CheckState(res);
         if (_v) {
-          return _wrap_VByteIndex___setitem____SWIG_0(nargs, args, self);
+          return _wrap_StringVector___setitem____SWIG_0(nargs, args, self);
         }
       }
     }
   }
   if (argc == 4) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -34569,10 +35374,10 @@ SWIGINTERN VALUE _wrap_VByteIndex___setitem__(int nargs, VALUE *args, VALUE self
           _v = SWIG_CheckState(res);
         }
         if (_v) {
-          int res = swig::asptr(argv[3], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+          int res = swig::asptr(argv[3], (std::vector< std::string,std::allocator< std::string > >**)(0));
           _v = SWIG_CheckState(res);
           if (_v) {
-            return _wrap_VByteIndex___setitem____SWIG_1(nargs, args, self);
+            return _wrap_StringVector___setitem____SWIG_1(nargs, args, self);
           }
         }
       }
@@ -34581,8 +35386,8 @@ SWIGINTERN VALUE _wrap_VByteIndex___setitem__(int nargs, VALUE *args, VALUE self
   
 fail:
   Ruby_Format_OverloadedError( argc, 5, "__setitem__", 
-    "    VALUE __setitem__(std::vector< twenty48::vbyte_index_entry_t >::difference_type i, std::vector< twenty48::vbyte_index_entry_t >::value_type const &x)\n"
-    "    VALUE __setitem__(std::vector< twenty48::vbyte_index_entry_t >::difference_type i, std::vector< twenty48::vbyte_index_entry_t >::difference_type length, std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > const &v)\n");
+    "    VALUE __setitem__(std::vector< std::string >::difference_type i, std::vector< std::string >::value_type const &x)\n"
+    "    VALUE __setitem__(std::vector< std::string >::difference_type i, std::vector< std::string >::difference_type length, std::vector< std::string,std::allocator< std::string > > const &v)\n");
   
   return Qnil;
 }
@@ -34590,31 +35395,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.reject!
+  Document-method: Twenty48::StringVector.reject!
 
   call-seq:
-    reject! -> VByteIndex
+    reject! -> StringVector
 
-Iterate thru each element in the VByteIndex and reject those that fail a condition.  A block must be provided.  VByteIndex is modified in place.
+Iterate thru each element in the StringVector and reject those that fail a condition.  A block must be provided.  StringVector is modified in place.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_rejectN___(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_rejectN___(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
+  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","reject_bang", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","reject_bang", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__reject_bang(arg1);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__reject_bang(arg1);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -34623,16 +35428,16 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.pop
+  Document-method: Twenty48::StringVector.pop
 
   call-seq:
     pop -> VALUE
 
-Remove and return element at the end of the VByteIndex.
+Remove and return element at the end of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_pop(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_pop(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   VALUE result;
@@ -34641,12 +35446,12 @@ _wrap_VByteIndex_pop(int argc, VALUE *argv, VALUE self) {
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","pop", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","pop", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__pop(arg1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (VALUE)std_vector_Sl_std_string_Sg__pop(arg1);
   vresult = result;
   return vresult;
 fail:
@@ -34656,75 +35461,79 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.push
+  Document-method: Twenty48::StringVector.push
 
   call-seq:
-    push(e) -> VByteIndexEntry
+    push(e) -> std::vector< std::string >::value_type const
 
-Add an element at the end of the VByteIndex.
+Add an element at the end of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_push(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg2 = 0 ;
+_wrap_StringVector_push(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::value_type *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::value_type result;
+  int res2 = SWIG_OLDOBJ ;
+  std::vector< std::string >::value_type result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","push", 1, self )); 
-  }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","push", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","push", 1, self )); 
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","push", 2, argv[0])); 
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","push", 2, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","push", 2, argv[0])); 
+    }
+    arg2 = ptr;
   }
-  arg2 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp2);
-  result = std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__push(arg1,(twenty48::vbyte_index_entry_t const &)*arg2);
-  vresult = SWIG_NewPointerObj((new std::vector< twenty48::vbyte_index_entry_t >::value_type(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::value_type& >(result))), SWIGTYPE_p_twenty48__vbyte_index_entry_t, SWIG_POINTER_OWN |  0 );
+  result = std_vector_Sl_std_string_Sg__push(arg1,(std::string const &)*arg2);
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return vresult;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return Qnil;
 }
 
 
 
 /*
-  Document-method: Twenty48::VByteIndex.reject
+  Document-method: Twenty48::StringVector.reject
 
   call-seq:
-    reject -> VByteIndex
+    reject -> StringVector
 
-Iterate thru each element in the VByteIndex and reject those that fail a condition returning a new VByteIndex.  A block must be provided.
+Iterate thru each element in the StringVector and reject those that fail a condition returning a new StringVector.  A block must be provided.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_reject(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_reject(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
+  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","reject", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","reject", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__reject(arg1);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, SWIG_POINTER_OWN |  0 );
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__reject(arg1);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -34733,16 +35542,16 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.shift
+  Document-method: Twenty48::StringVector.shift
 
   call-seq:
     shift -> VALUE
 
-Remove and return element at the beginning of the VByteIndex.
+Remove and return element at the beginning of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_shift(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_shift(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   VALUE result;
@@ -34751,12 +35560,12 @@ _wrap_VByteIndex_shift(int argc, VALUE *argv, VALUE self) {
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","shift", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","shift", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (VALUE)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__shift(arg1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (VALUE)std_vector_Sl_std_string_Sg__shift(arg1);
   vresult = result;
   return vresult;
 fail:
@@ -34766,19 +35575,19 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.insert
+  Document-method: Twenty48::StringVector.insert
 
   call-seq:
-    insert(pos, argc) -> VByteIndex
-    insert(pos, x) -> std::vector< twenty48::vbyte_index_entry_t >::iterator
+    insert(pos, argc) -> StringVector
+    insert(pos, x) -> std::vector< std::string >::iterator
     insert(pos, n, x)
 
-Insert one or more new elements in the VByteIndex.
+Insert one or more new elements in the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_insert__SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::difference_type arg2 ;
+_wrap_StringVector_insert__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::difference_type arg2 ;
   int arg3 ;
   VALUE *arg4 = (VALUE *) 0 ;
   void *arg5 = 0 ;
@@ -34786,28 +35595,28 @@ _wrap_VByteIndex_insert__SWIG_0(int argc, VALUE *argv, VALUE self) {
   int res1 = 0 ;
   ptrdiff_t val2 ;
   int ecode2 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
+  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if (argc < 2) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","insert", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","insert", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_ptrdiff_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::difference_type","insert", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::difference_type","insert", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::difference_type >(val2);
+  arg2 = static_cast< std::vector< std::string >::difference_type >(val2);
   {
     arg3 = argc - 1;
     arg4 = argv + 1;
   }
-  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__insert__SWIG_0(arg1,arg2,arg3,arg4,arg5);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__insert__SWIG_0(arg1,arg2,arg3,arg4,arg5);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -34816,38 +35625,38 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.unshift
+  Document-method: Twenty48::StringVector.unshift
 
   call-seq:
-    unshift(argc) -> VByteIndex
+    unshift(argc) -> StringVector
 
-Add one or more elements at the beginning of the VByteIndex.
+Add one or more elements at the beginning of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_unshift(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_unshift(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   int arg2 ;
   VALUE *arg3 = (VALUE *) 0 ;
   void *arg4 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *result = 0 ;
+  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if (argc < 1) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","unshift", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","unshift", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   {
     arg2 = argc;
     arg3 = argv;
   }
-  result = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__unshift(arg1,arg2,arg3,arg4);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__unshift(arg1,arg2,arg3,arg4);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -34855,13 +35664,13 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_new_VByteIndex__SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *result = 0 ;
+_wrap_new_StringVector__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *result = 0 ;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  result = (std::vector< twenty48::vbyte_index_entry_t > *)new std::vector< twenty48::vbyte_index_entry_t >();
+  result = (std::vector< std::string > *)new std::vector< std::string >();
   DATA_PTR(self) = result;
   return self;
 fail:
@@ -34870,26 +35679,26 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_new_VByteIndex__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = 0 ;
+_wrap_new_StringVector__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = 0 ;
   int res1 = SWIG_OLDOBJ ;
-  std::vector< twenty48::vbyte_index_entry_t > *result = 0 ;
+  std::vector< std::string > *result = 0 ;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
   {
-    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *ptr = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)0;
+    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
     res1 = swig::asptr(argv[0], &ptr);
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const &","vector<(twenty48::vbyte_index_entry_t)>", 1, argv[0] )); 
+      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const &","vector<(std::string)>", 1, argv[0] )); 
     }
     if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t > const &","vector<(twenty48::vbyte_index_entry_t)>", 1, argv[0])); 
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string > const &","vector<(std::string)>", 1, argv[0])); 
     }
     arg1 = ptr;
   }
-  result = (std::vector< twenty48::vbyte_index_entry_t > *)new std::vector< twenty48::vbyte_index_entry_t >((std::vector< twenty48::vbyte_index_entry_t > const &)*arg1);
+  result = (std::vector< std::string > *)new std::vector< std::string >((std::vector< std::string > const &)*arg1);
   DATA_PTR(self) = result;
   if (SWIG_IsNewObj(res1)) delete arg1;
   return self;
@@ -34901,16 +35710,16 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.empty?
+  Document-method: Twenty48::StringVector.empty?
 
   call-seq:
     empty? -> bool
 
-Check if the VByteIndex is empty or not.
+Check if the StringVector is empty or not.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_emptyq___(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_emptyq___(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   bool result;
@@ -34919,12 +35728,12 @@ _wrap_VByteIndex_emptyq___(int argc, VALUE *argv, VALUE self) {
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","empty", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","empty", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (bool)((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->empty();
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (bool)((std::vector< std::string > const *)arg1)->empty();
   vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
@@ -34934,30 +35743,30 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.size
+  Document-method: Twenty48::StringVector.size
 
   call-seq:
-    size -> std::vector< twenty48::vbyte_index_entry_t >::size_type
+    size -> std::vector< std::string >::size_type
 
-Size or Length of the VByteIndex.
+Size or Length of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_size(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_size(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::size_type result;
+  std::vector< std::string >::size_type result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","size", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","size", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = ((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->size();
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = ((std::vector< std::string > const *)arg1)->size();
   vresult = SWIG_From_size_t(static_cast< size_t >(result));
   return vresult;
 fail:
@@ -34966,9 +35775,9 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteIndex_swap(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t > *arg2 = 0 ;
+_wrap_StringVector_swap(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 = 0 ;
@@ -34977,19 +35786,19 @@ _wrap_VByteIndex_swap(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","swap", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","swap", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t,  0 );
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t,  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > &","swap", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< std::string > &","swap", 2, argv[0] )); 
   }
   if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t > &","swap", 2, argv[0])); 
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string > &","swap", 2, argv[0])); 
   }
-  arg2 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp2);
+  arg2 = reinterpret_cast< std::vector< std::string > * >(argp2);
   (arg1)->swap(*arg2);
   return Qnil;
 fail:
@@ -34999,31 +35808,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.begin
+  Document-method: Twenty48::StringVector.begin
 
   call-seq:
-    begin -> std::vector< twenty48::vbyte_index_entry_t >::iterator
+    begin -> std::vector< std::string >::iterator
 
-Return an iterator to the beginning of the VByteIndex.
+Return an iterator to the beginning of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_begin(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_begin(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::iterator result;
+  std::vector< std::string >::iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","begin", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","begin", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   result = (arg1)->begin();
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::iterator & >(result),
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -35034,31 +35843,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.end
+  Document-method: Twenty48::StringVector.end
 
   call-seq:
-    end -> std::vector< twenty48::vbyte_index_entry_t >::iterator
+    end -> std::vector< std::string >::iterator
 
-Return an iterator to past the end of the VByteIndex.
+Return an iterator to past the end of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_end(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_end(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::iterator result;
+  std::vector< std::string >::iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","end", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","end", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   result = (arg1)->end();
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::iterator & >(result),
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -35069,31 +35878,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.rbegin
+  Document-method: Twenty48::StringVector.rbegin
 
   call-seq:
-    rbegin -> std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator
+    rbegin -> std::vector< std::string >::reverse_iterator
 
-Return a reverse iterator to the beginning (the end) of the VByteIndex.
+Return a reverse iterator to the beginning (the end) of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_rbegin(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_rbegin(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator result;
+  std::vector< std::string >::reverse_iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","rbegin", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","rbegin", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   result = (arg1)->rbegin();
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator & >(result),
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::reverse_iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -35104,31 +35913,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.rend
+  Document-method: Twenty48::StringVector.rend
 
   call-seq:
-    rend -> std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator
+    rend -> std::vector< std::string >::reverse_iterator
 
-Return a reverse iterator to past the end (past the beginning) of the VByteIndex.
+Return a reverse iterator to past the end (past the beginning) of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_rend(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_rend(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator result;
+  std::vector< std::string >::reverse_iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","rend", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","rend", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   result = (arg1)->rend();
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::reverse_iterator & >(result),
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::reverse_iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -35139,27 +35948,27 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.clear
+  Document-method: Twenty48::StringVector.clear
 
   call-seq:
     clear
 
-Clear VByteIndex contents.
+Clear StringVector contents.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_clear(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_clear(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","clear", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","clear", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   (arg1)->clear();
   return Qnil;
 fail:
@@ -35168,23 +35977,23 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteIndex_get_allocator(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_get_allocator(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  SwigValueWrapper< std::allocator< twenty48::vbyte_index_entry_t > > result;
+  SwigValueWrapper< std::allocator< std::string > > result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","get_allocator", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","get_allocator", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = ((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->get_allocator();
-  vresult = SWIG_NewPointerObj((new std::vector< twenty48::vbyte_index_entry_t >::allocator_type(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::allocator_type& >(result))), SWIGTYPE_p_std__allocatorT_twenty48__vbyte_index_entry_t_t, SWIG_POINTER_OWN |  0 );
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = ((std::vector< std::string > const *)arg1)->get_allocator();
+  vresult = SWIG_NewPointerObj((new std::vector< std::string >::allocator_type(static_cast< const std::vector< std::string >::allocator_type& >(result))), SWIGTYPE_p_std__allocatorT_std__string_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -35192,21 +36001,21 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_new_VByteIndex__SWIG_2(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t >::size_type arg1 ;
+_wrap_new_StringVector__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string >::size_type arg1 ;
   size_t val1 ;
   int ecode1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t > *result = 0 ;
+  std::vector< std::string > *result = 0 ;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
   ecode1 = SWIG_AsVal_size_t(argv[0], &val1);
   if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","vector<(twenty48::vbyte_index_entry_t)>", 1, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","vector<(std::string)>", 1, argv[0] ));
   } 
-  arg1 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val1);
-  result = (std::vector< twenty48::vbyte_index_entry_t > *)new std::vector< twenty48::vbyte_index_entry_t >(arg1);
+  arg1 = static_cast< std::vector< std::string >::size_type >(val1);
+  result = (std::vector< std::string > *)new std::vector< std::string >(arg1);
   DATA_PTR(self) = result;
   return self;
 fail:
@@ -35216,18 +36025,18 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.resize
+  Document-method: Twenty48::StringVector.resize
 
   call-seq:
     resize(new_size)
     resize(new_size, x)
 
-Resize the size of the VByteIndex.
+Resize the size of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_resize__SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::size_type arg2 ;
+_wrap_StringVector_resize__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::size_type arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
@@ -35236,16 +36045,16 @@ _wrap_VByteIndex_resize__SWIG_0(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","resize", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","resize", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_size_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","resize", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","resize", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val2);
+  arg2 = static_cast< std::vector< std::string >::size_type >(val2);
   (arg1)->resize(arg2);
   return Qnil;
 fail:
@@ -35255,46 +36064,46 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.erase
+  Document-method: Twenty48::StringVector.erase
 
   call-seq:
-    erase(pos) -> std::vector< twenty48::vbyte_index_entry_t >::iterator
-    erase(first, last) -> std::vector< twenty48::vbyte_index_entry_t >::iterator
+    erase(pos) -> std::vector< std::string >::iterator
+    erase(first, last) -> std::vector< std::string >::iterator
 
-Delete a portion of the VByteIndex.
+Delete a portion of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_erase__SWIG_0(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::iterator arg2 ;
+_wrap_StringVector_erase__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::iterator arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   swig::Iterator *iter2 = 0 ;
   int res2 ;
-  std::vector< twenty48::vbyte_index_entry_t >::iterator result;
+  std::vector< std::string >::iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","erase", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","erase", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], SWIG_as_voidptrptr(&iter2), swig::Iterator::descriptor(), 0);
   if (!SWIG_IsOK(res2) || !iter2) {
-    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 2, argv[0] ));
   } else {
-    swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter2);
+    swig::Iterator_T<std::vector< std::string >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter2);
     if (iter_t) {
       arg2 = iter_t->get_current();
     } else {
-      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 2, argv[0] ));
+      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 2, argv[0] ));
     }
   }
-  result = std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__erase__SWIG_0(arg1,arg2);
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::iterator & >(result),
+  result = std_vector_Sl_std_string_Sg__erase__SWIG_0(arg1,arg2);
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -35304,51 +36113,51 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteIndex_erase__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::iterator arg2 ;
-  std::vector< twenty48::vbyte_index_entry_t >::iterator arg3 ;
+_wrap_StringVector_erase__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::iterator arg2 ;
+  std::vector< std::string >::iterator arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   swig::Iterator *iter2 = 0 ;
   int res2 ;
   swig::Iterator *iter3 = 0 ;
   int res3 ;
-  std::vector< twenty48::vbyte_index_entry_t >::iterator result;
+  std::vector< std::string >::iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","erase", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","erase", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], SWIG_as_voidptrptr(&iter2), swig::Iterator::descriptor(), 0);
   if (!SWIG_IsOK(res2) || !iter2) {
-    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 2, argv[0] ));
   } else {
-    swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter2);
+    swig::Iterator_T<std::vector< std::string >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter2);
     if (iter_t) {
       arg2 = iter_t->get_current();
     } else {
-      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 2, argv[0] ));
+      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 2, argv[0] ));
     }
   }
   res3 = SWIG_ConvertPtr(argv[1], SWIG_as_voidptrptr(&iter3), swig::Iterator::descriptor(), 0);
   if (!SWIG_IsOK(res3) || !iter3) {
-    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 3, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 3, argv[1] ));
   } else {
-    swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter3);
+    swig::Iterator_T<std::vector< std::string >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter3);
     if (iter_t) {
       arg3 = iter_t->get_current();
     } else {
-      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","erase", 3, argv[1] ));
+      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","erase", 3, argv[1] ));
     }
   }
-  result = std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__erase__SWIG_1(arg1,arg2,arg3);
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::iterator & >(result),
+  result = std_vector_Sl_std_string_Sg__erase__SWIG_1(arg1,arg2,arg3);
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
   return vresult;
@@ -35357,7 +36166,7 @@ fail:
 }
 
 
-SWIGINTERN VALUE _wrap_VByteIndex_erase(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_StringVector_erase(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[4];
   int ii;
@@ -35370,31 +36179,31 @@ SWIGINTERN VALUE _wrap_VByteIndex_erase(int nargs, VALUE *args, VALUE self) {
   }
   if (argc == 2) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       swig::ConstIterator *iter = 0;
       int res = SWIG_ConvertPtr(argv[1], SWIG_as_voidptrptr(&iter), swig::Iterator::descriptor(), 0);
-      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter) != 0));
+      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter) != 0));
       if (_v) {
-        return _wrap_VByteIndex_erase__SWIG_0(nargs, args, self);
+        return _wrap_StringVector_erase__SWIG_0(nargs, args, self);
       }
     }
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       swig::ConstIterator *iter = 0;
       int res = SWIG_ConvertPtr(argv[1], SWIG_as_voidptrptr(&iter), swig::Iterator::descriptor(), 0);
-      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter) != 0));
+      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter) != 0));
       if (_v) {
         swig::ConstIterator *iter = 0;
         int res = SWIG_ConvertPtr(argv[2], SWIG_as_voidptrptr(&iter), swig::Iterator::descriptor(), 0);
-        _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter) != 0));
+        _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter) != 0));
         if (_v) {
-          return _wrap_VByteIndex_erase__SWIG_1(nargs, args, self);
+          return _wrap_StringVector_erase__SWIG_1(nargs, args, self);
         }
       }
     }
@@ -35402,8 +36211,8 @@ SWIGINTERN VALUE _wrap_VByteIndex_erase(int nargs, VALUE *args, VALUE self) {
   
 fail:
   Ruby_Format_OverloadedError( argc, 4, "erase", 
-    "    std::vector< twenty48::vbyte_index_entry_t >::iterator erase(std::vector< twenty48::vbyte_index_entry_t >::iterator pos)\n"
-    "    std::vector< twenty48::vbyte_index_entry_t >::iterator erase(std::vector< twenty48::vbyte_index_entry_t >::iterator first, std::vector< twenty48::vbyte_index_entry_t >::iterator last)\n");
+    "    std::vector< std::string >::iterator erase(std::vector< std::string >::iterator pos)\n"
+    "    std::vector< std::string >::iterator erase(std::vector< std::string >::iterator first, std::vector< std::string >::iterator last)\n");
   
   return Qnil;
 }
@@ -35411,12 +36220,12 @@ fail:
 
 SWIGINTERN VALUE
 #ifdef HAVE_RB_DEFINE_ALLOC_FUNC
-_wrap_VByteIndex_allocate(VALUE self)
+_wrap_StringVector_allocate(VALUE self)
 #else
-_wrap_VByteIndex_allocate(int argc, VALUE *argv, VALUE self)
+_wrap_StringVector_allocate(int argc, VALUE *argv, VALUE self)
 #endif
 {
-  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t);
+  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t);
 #ifndef HAVE_RB_DEFINE_ALLOC_FUNC
   rb_obj_call_init(vresult, argc, argv);
 #endif
@@ -35425,40 +36234,44 @@ _wrap_VByteIndex_allocate(int argc, VALUE *argv, VALUE self)
 
 
 SWIGINTERN VALUE
-_wrap_new_VByteIndex__SWIG_3(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t >::size_type arg1 ;
-  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg2 = 0 ;
+_wrap_new_StringVector__SWIG_3(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string >::size_type arg1 ;
+  std::vector< std::string >::value_type *arg2 = 0 ;
   size_t val1 ;
   int ecode1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t > *result = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  std::vector< std::string > *result = 0 ;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
   ecode1 = SWIG_AsVal_size_t(argv[0], &val1);
   if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","vector<(twenty48::vbyte_index_entry_t)>", 1, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","vector<(std::string)>", 1, argv[0] ));
   } 
-  arg1 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val1);
-  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","vector<(twenty48::vbyte_index_entry_t)>", 2, argv[1] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","vector<(twenty48::vbyte_index_entry_t)>", 2, argv[1])); 
+  arg1 = static_cast< std::vector< std::string >::size_type >(val1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(argv[1], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","vector<(std::string)>", 2, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","vector<(std::string)>", 2, argv[1])); 
+    }
+    arg2 = ptr;
   }
-  arg2 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp2);
-  result = (std::vector< twenty48::vbyte_index_entry_t > *)new std::vector< twenty48::vbyte_index_entry_t >(arg1,(std::vector< twenty48::vbyte_index_entry_t >::value_type const &)*arg2);
+  result = (std::vector< std::string > *)new std::vector< std::string >(arg1,(std::vector< std::string >::value_type const &)*arg2);
   DATA_PTR(self) = result;
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return self;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_new_VByteIndex(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_new_StringVector(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[2];
   int ii;
@@ -35469,7 +36282,7 @@ SWIGINTERN VALUE _wrap_new_VByteIndex(int nargs, VALUE *args, VALUE self) {
     argv[ii] = args[ii];
   }
   if (argc == 0) {
-    return _wrap_new_VByteIndex__SWIG_0(nargs, args, self);
+    return _wrap_new_StringVector__SWIG_0(nargs, args, self);
   }
   if (argc == 1) {
     int _v;
@@ -35478,15 +36291,15 @@ SWIGINTERN VALUE _wrap_new_VByteIndex(int nargs, VALUE *args, VALUE self) {
       _v = SWIG_CheckState(res);
     }
     if (_v) {
-      return _wrap_new_VByteIndex__SWIG_2(nargs, args, self);
+      return _wrap_new_StringVector__SWIG_2(nargs, args, self);
     }
   }
   if (argc == 1) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
-      return _wrap_new_VByteIndex__SWIG_1(nargs, args, self);
+      return _wrap_new_StringVector__SWIG_1(nargs, args, self);
     }
   }
   if (argc == 2) {
@@ -35496,21 +36309,20 @@ SWIGINTERN VALUE _wrap_new_VByteIndex(int nargs, VALUE *args, VALUE self) {
       _v = SWIG_CheckState(res);
     }
     if (_v) {
-      void *vptr = 0;
-      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0);
+      int res = SWIG_AsPtr_std_string(argv[1], (std::string**)(0));
       _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_new_VByteIndex__SWIG_3(nargs, args, self);
+        return _wrap_new_StringVector__SWIG_3(nargs, args, self);
       }
     }
   }
   
 fail:
-  Ruby_Format_OverloadedError( argc, 2, "VByteIndex.new", 
-    "    VByteIndex.new()\n"
-    "    VByteIndex.new(std::vector< twenty48::vbyte_index_entry_t > const &)\n"
-    "    VByteIndex.new(std::vector< twenty48::vbyte_index_entry_t >::size_type size)\n"
-    "    VByteIndex.new(std::vector< twenty48::vbyte_index_entry_t >::size_type size, std::vector< twenty48::vbyte_index_entry_t >::value_type const &value)\n");
+  Ruby_Format_OverloadedError( argc, 2, "StringVector.new", 
+    "    StringVector.new()\n"
+    "    StringVector.new(std::vector< std::string > const &)\n"
+    "    StringVector.new(std::vector< std::string >::size_type size)\n"
+    "    StringVector.new(std::vector< std::string >::size_type size, std::vector< std::string >::value_type const &value)\n");
   
   return Qnil;
 }
@@ -35518,31 +36330,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.front
+  Document-method: Twenty48::StringVector.front
 
   call-seq:
-    front -> VByteIndexEntry
+    front -> std::vector< std::string >::value_type const &
 
-Return the first element in VByteIndex.
+Return the first element in StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_front(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_front(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::value_type *result = 0 ;
+  std::vector< std::string >::value_type *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","front", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","front", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (std::vector< twenty48::vbyte_index_entry_t >::value_type *) &((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->front();
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (std::vector< std::string >::value_type *) &((std::vector< std::string > const *)arg1)->front();
+  vresult = SWIG_From_std_string(static_cast< std::string >(*result));
   return vresult;
 fail:
   return Qnil;
@@ -35551,31 +36363,31 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.back
+  Document-method: Twenty48::StringVector.back
 
   call-seq:
-    back -> VByteIndexEntry
+    back -> std::vector< std::string >::value_type const &
 
-Return the last element in VByteIndex.
+Return the last element in StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_back(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_back(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::value_type *result = 0 ;
+  std::vector< std::string >::value_type *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","back", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","back", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = (std::vector< twenty48::vbyte_index_entry_t >::value_type *) &((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->back();
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0 |  0 );
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (std::vector< std::string >::value_type *) &((std::vector< std::string > const *)arg1)->back();
+  vresult = SWIG_From_std_string(static_cast< std::string >(*result));
   return vresult;
 fail:
   return Qnil;
@@ -35584,104 +36396,112 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.assign
+  Document-method: Twenty48::StringVector.assign
 
   call-seq:
     assign(n, x)
 
-Assign a new VByteIndex or portion of it.
+Assign a new StringVector or portion of it.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_assign(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::size_type arg2 ;
-  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg3 = 0 ;
+_wrap_StringVector_assign(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::size_type arg2 ;
+  std::vector< std::string >::value_type *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
   int ecode2 = 0 ;
-  void *argp3 ;
-  int res3 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","assign", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","assign", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_size_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","assign", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","assign", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val2);
-  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","assign", 3, argv[1] )); 
-  }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","assign", 3, argv[1])); 
+  arg2 = static_cast< std::vector< std::string >::size_type >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","assign", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","assign", 3, argv[1])); 
+    }
+    arg3 = ptr;
   }
-  arg3 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp3);
-  (arg1)->assign(arg2,(std::vector< twenty48::vbyte_index_entry_t >::value_type const &)*arg3);
+  (arg1)->assign(arg2,(std::vector< std::string >::value_type const &)*arg3);
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 }
 
 
 
 /*
-  Document-method: Twenty48::VByteIndex.resize
+  Document-method: Twenty48::StringVector.resize
 
   call-seq:
     resize(new_size)
     resize(new_size, x)
 
-Resize the size of the VByteIndex.
+Resize the size of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_resize__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::size_type arg2 ;
-  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg3 = 0 ;
+_wrap_StringVector_resize__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::size_type arg2 ;
+  std::vector< std::string >::value_type *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
   int ecode2 = 0 ;
-  void *argp3 ;
-  int res3 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","resize", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","resize", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_size_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","resize", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","resize", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val2);
-  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","resize", 3, argv[1] )); 
-  }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","resize", 3, argv[1])); 
+  arg2 = static_cast< std::vector< std::string >::size_type >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","resize", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","resize", 3, argv[1])); 
+    }
+    arg3 = ptr;
   }
-  arg3 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp3);
-  (arg1)->resize(arg2,(std::vector< twenty48::vbyte_index_entry_t >::value_type const &)*arg3);
+  (arg1)->resize(arg2,(std::vector< std::string >::value_type const &)*arg3);
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_VByteIndex_resize(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_StringVector_resize(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[4];
   int ii;
@@ -35694,7 +36514,7 @@ SWIGINTERN VALUE _wrap_VByteIndex_resize(int nargs, VALUE *args, VALUE self) {
   }
   if (argc == 2) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -35702,13 +36522,13 @@ SWIGINTERN VALUE _wrap_VByteIndex_resize(int nargs, VALUE *args, VALUE self) {
         _v = SWIG_CheckState(res);
       }
       if (_v) {
-        return _wrap_VByteIndex_resize__SWIG_0(nargs, args, self);
+        return _wrap_StringVector_resize__SWIG_0(nargs, args, self);
       }
     }
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -35716,20 +36536,19 @@ SWIGINTERN VALUE _wrap_VByteIndex_resize(int nargs, VALUE *args, VALUE self) {
         _v = SWIG_CheckState(res);
       }
       if (_v) {
-        void *vptr = 0;
-        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0);
+        int res = SWIG_AsPtr_std_string(argv[2], (std::string**)(0));
         _v = SWIG_CheckState(res);
         if (_v) {
-          return _wrap_VByteIndex_resize__SWIG_1(nargs, args, self);
+          return _wrap_StringVector_resize__SWIG_1(nargs, args, self);
         }
       }
     }
   }
   
 fail:
-  Ruby_Format_OverloadedError( argc, 4, "VByteIndex.resize", 
-    "    void VByteIndex.resize(std::vector< twenty48::vbyte_index_entry_t >::size_type new_size)\n"
-    "    void VByteIndex.resize(std::vector< twenty48::vbyte_index_entry_t >::size_type new_size, std::vector< twenty48::vbyte_index_entry_t >::value_type const &x)\n");
+  Ruby_Format_OverloadedError( argc, 4, "StringVector.resize", 
+    "    void StringVector.resize(std::vector< std::string >::size_type new_size)\n"
+    "    void StringVector.resize(std::vector< std::string >::size_type new_size, std::vector< std::string >::value_type const &x)\n");
   
   return Qnil;
 }
@@ -35737,121 +36556,129 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.insert
+  Document-method: Twenty48::StringVector.insert
 
   call-seq:
-    insert(pos, argc) -> VByteIndex
-    insert(pos, x) -> std::vector< twenty48::vbyte_index_entry_t >::iterator
+    insert(pos, argc) -> StringVector
+    insert(pos, x) -> std::vector< std::string >::iterator
     insert(pos, n, x)
 
-Insert one or more new elements in the VByteIndex.
+Insert one or more new elements in the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_insert__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::iterator arg2 ;
-  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg3 = 0 ;
+_wrap_StringVector_insert__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::iterator arg2 ;
+  std::vector< std::string >::value_type *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   swig::Iterator *iter2 = 0 ;
   int res2 ;
-  void *argp3 ;
-  int res3 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::iterator result;
+  int res3 = SWIG_OLDOBJ ;
+  std::vector< std::string >::iterator result;
   VALUE vresult = Qnil;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","insert", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","insert", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], SWIG_as_voidptrptr(&iter2), swig::Iterator::descriptor(), 0);
   if (!SWIG_IsOK(res2) || !iter2) {
-    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","insert", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","insert", 2, argv[0] ));
   } else {
-    swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter2);
+    swig::Iterator_T<std::vector< std::string >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter2);
     if (iter_t) {
       arg2 = iter_t->get_current();
     } else {
-      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","insert", 2, argv[0] ));
+      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","insert", 2, argv[0] ));
     }
   }
-  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","insert", 3, argv[1] )); 
-  }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","insert", 3, argv[1])); 
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","insert", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","insert", 3, argv[1])); 
+    }
+    arg3 = ptr;
   }
-  arg3 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp3);
-  result = std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__insert__SWIG_1(arg1,arg2,(twenty48::vbyte_index_entry_t const &)*arg3);
-  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< twenty48::vbyte_index_entry_t >::iterator & >(result),
+  result = std_vector_Sl_std_string_Sg__insert__SWIG_1(arg1,arg2,(std::string const &)*arg3);
+  vresult = SWIG_NewPointerObj(swig::make_nonconst_iterator(static_cast< const std::vector< std::string >::iterator & >(result),
       self),
     swig::Iterator::descriptor(),SWIG_POINTER_OWN);
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return vresult;
 fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_VByteIndex_insert__SWIG_2(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::iterator arg2 ;
-  std::vector< twenty48::vbyte_index_entry_t >::size_type arg3 ;
-  std::vector< twenty48::vbyte_index_entry_t >::value_type *arg4 = 0 ;
+_wrap_StringVector_insert__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::iterator arg2 ;
+  std::vector< std::string >::size_type arg3 ;
+  std::vector< std::string >::value_type *arg4 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   swig::Iterator *iter2 = 0 ;
   int res2 ;
   size_t val3 ;
   int ecode3 = 0 ;
-  void *argp4 ;
-  int res4 = 0 ;
+  int res4 = SWIG_OLDOBJ ;
   
   if ((argc < 3) || (argc > 3)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","insert", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","insert", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], SWIG_as_voidptrptr(&iter2), swig::Iterator::descriptor(), 0);
   if (!SWIG_IsOK(res2) || !iter2) {
-    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","insert", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","insert", 2, argv[0] ));
   } else {
-    swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter2);
+    swig::Iterator_T<std::vector< std::string >::iterator > *iter_t = dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter2);
     if (iter_t) {
       arg2 = iter_t->get_current();
     } else {
-      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::iterator","insert", 2, argv[0] ));
+      SWIG_exception_fail(SWIG_ArgError(SWIG_TypeError), Ruby_Format_TypeError( "", "std::vector< std::string >::iterator","insert", 2, argv[0] ));
     }
   }
   ecode3 = SWIG_AsVal_size_t(argv[1], &val3);
   if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","insert", 3, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","insert", 3, argv[1] ));
   } 
-  arg3 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val3);
-  res4 = SWIG_ConvertPtr(argv[2], &argp4, SWIGTYPE_p_twenty48__vbyte_index_entry_t,  0 );
-  if (!SWIG_IsOK(res4)) {
-    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","insert", 4, argv[2] )); 
-  }
-  if (!argp4) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< twenty48::vbyte_index_entry_t >::value_type const &","insert", 4, argv[2])); 
+  arg3 = static_cast< std::vector< std::string >::size_type >(val3);
+  {
+    std::string *ptr = (std::string *)0;
+    res4 = SWIG_AsPtr_std_string(argv[2], &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "std::vector< std::string >::value_type const &","insert", 4, argv[2] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string >::value_type const &","insert", 4, argv[2])); 
+    }
+    arg4 = ptr;
   }
-  arg4 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t >::value_type * >(argp4);
-  std_vector_Sl_twenty48_vbyte_index_entry_t_Sg__insert__SWIG_2(arg1,arg2,arg3,(twenty48::vbyte_index_entry_t const &)*arg4);
+  std_vector_Sl_std_string_Sg__insert__SWIG_2(arg1,arg2,arg3,(std::string const &)*arg4);
+  if (SWIG_IsNewObj(res4)) delete arg4;
   return Qnil;
 fail:
+  if (SWIG_IsNewObj(res4)) delete arg4;
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_VByteIndex_insert(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_StringVector_insert(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[5];
   int ii;
@@ -35864,25 +36691,24 @@ SWIGINTERN VALUE _wrap_VByteIndex_insert(int nargs, VALUE *args, VALUE self) {
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       swig::ConstIterator *iter = 0;
       int res = SWIG_ConvertPtr(argv[1], SWIG_as_voidptrptr(&iter), swig::Iterator::descriptor(), 0);
-      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter) != 0));
+      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter) != 0));
       if (_v) {
-        void *vptr = 0;
-        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0);
+        int res = SWIG_AsPtr_std_string(argv[2], (std::string**)(0));
         _v = SWIG_CheckState(res);
         if (_v) {
-          return _wrap_VByteIndex_insert__SWIG_1(nargs, args, self);
+          return _wrap_StringVector_insert__SWIG_1(nargs, args, self);
         }
       }
     }
   }
   if (argc == 3) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -35896,32 +36722,31 @@ SWIGINTERN VALUE _wrap_VByteIndex_insert(int nargs, VALUE *args, VALUE self) {
         }
         if (_v) {
           if (argc <= 3) {
-            return _wrap_VByteIndex_insert__SWIG_0(nargs, args, self);
+            return _wrap_StringVector_insert__SWIG_0(nargs, args, self);
           }
-          return _wrap_VByteIndex_insert__SWIG_0(nargs, args, self);
+          return _wrap_StringVector_insert__SWIG_0(nargs, args, self);
         }
       }
     }
   }
   if (argc == 4) {
     int _v;
-    int res = swig::asptr(argv[0], (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > >**)(0));
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
     _v = SWIG_CheckState(res);
     if (_v) {
       swig::ConstIterator *iter = 0;
       int res = SWIG_ConvertPtr(argv[1], SWIG_as_voidptrptr(&iter), swig::Iterator::descriptor(), 0);
-      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< twenty48::vbyte_index_entry_t >::iterator > *>(iter) != 0));
+      _v = (SWIG_IsOK(res) && iter && (dynamic_cast<swig::Iterator_T<std::vector< std::string >::iterator > *>(iter) != 0));
       if (_v) {
         {
           int res = SWIG_AsVal_size_t(argv[2], NULL);
           _v = SWIG_CheckState(res);
         }
         if (_v) {
-          void *vptr = 0;
-          int res = SWIG_ConvertPtr(argv[3], &vptr, SWIGTYPE_p_twenty48__vbyte_index_entry_t, 0);
+          int res = SWIG_AsPtr_std_string(argv[3], (std::string**)(0));
           _v = SWIG_CheckState(res);
           if (_v) {
-            return _wrap_VByteIndex_insert__SWIG_2(nargs, args, self);
+            return _wrap_StringVector_insert__SWIG_2(nargs, args, self);
           }
         }
       }
@@ -35930,9 +36755,9 @@ SWIGINTERN VALUE _wrap_VByteIndex_insert(int nargs, VALUE *args, VALUE self) {
   
 fail:
   Ruby_Format_OverloadedError( argc, 5, "insert", 
-    "    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > insert(std::vector< twenty48::vbyte_index_entry_t >::difference_type pos, int argc, VALUE *argv, ...)\n"
-    "    std::vector< twenty48::vbyte_index_entry_t >::iterator insert(std::vector< twenty48::vbyte_index_entry_t >::iterator pos, std::vector< twenty48::vbyte_index_entry_t >::value_type const &x)\n"
-    "    void insert(std::vector< twenty48::vbyte_index_entry_t >::iterator pos, std::vector< twenty48::vbyte_index_entry_t >::size_type n, std::vector< twenty48::vbyte_index_entry_t >::value_type const &x)\n");
+    "    std::vector< std::string,std::allocator< std::string > > insert(std::vector< std::string >::difference_type pos, int argc, VALUE *argv, ...)\n"
+    "    std::vector< std::string >::iterator insert(std::vector< std::string >::iterator pos, std::vector< std::string >::value_type const &x)\n"
+    "    void insert(std::vector< std::string >::iterator pos, std::vector< std::string >::size_type n, std::vector< std::string >::value_type const &x)\n");
   
   return Qnil;
 }
@@ -35940,17 +36765,17 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.reserve
+  Document-method: Twenty48::StringVector.reserve
 
   call-seq:
     reserve(n)
 
-Reserve memory in the VByteIndex for a number of elements.
+Reserve memory in the StringVector for a number of elements.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_reserve(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::size_type arg2 ;
+_wrap_StringVector_reserve(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::vector< std::string >::size_type arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
@@ -35959,16 +36784,16 @@ _wrap_VByteIndex_reserve(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > *","reserve", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","reserve", 1, self )); 
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
   ecode2 = SWIG_AsVal_size_t(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t >::size_type","reserve", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "std::vector< std::string >::size_type","reserve", 2, argv[0] ));
   } 
-  arg2 = static_cast< std::vector< twenty48::vbyte_index_entry_t >::size_type >(val2);
+  arg2 = static_cast< std::vector< std::string >::size_type >(val2);
   (arg1)->reserve(arg2);
   return Qnil;
 fail:
@@ -35978,179 +36803,2928 @@ fail:
 
 
 /*
-  Document-method: Twenty48::VByteIndex.capacity
+  Document-method: Twenty48::StringVector.capacity
 
   call-seq:
-    capacity -> std::vector< twenty48::vbyte_index_entry_t >::size_type
+    capacity -> std::vector< std::string >::size_type
 
-Reserved capacity of the VByteIndex.
+Reserved capacity of the StringVector.
 */
 SWIGINTERN VALUE
-_wrap_VByteIndex_capacity(int argc, VALUE *argv, VALUE self) {
-  std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *) 0 ;
+_wrap_StringVector_capacity(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< twenty48::vbyte_index_entry_t >::size_type result;
+  std::vector< std::string >::size_type result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > const *","capacity", 1, self )); 
+  }
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = ((std::vector< std::string > const *)arg1)->capacity();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_StringVector_map_bang(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< std::string,std::allocator< std::string > > *result = 0 ;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< twenty48::vbyte_index_entry_t > const *","capacity", 1, self )); 
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","map_bang", 1, self )); 
+  }
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  result = (std::vector< std::string,std::allocator< std::string > > *)std_vector_Sl_std_string_Sg__map_bang(arg1);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+
+/*
+  Document-method: Twenty48::StringVector.__delete__
+
+  call-seq:
+    __delete__(val) -> VALUE
+
+Delete a matching element.
+*/
+SWIGINTERN VALUE
+_wrap_StringVector___delete__(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string > *arg1 = (std::vector< std::string > *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  VALUE result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string > *","__delete__", 1, self )); 
+  }
+  arg1 = reinterpret_cast< std::vector< std::string > * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::string const &","__delete__", 2, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string const &","__delete__", 2, argv[0])); 
+    }
+    arg2 = ptr;
+  }
+  result = (VALUE)std_vector_Sl_std_string_Sg____delete__(arg1,(std::string const &)*arg2);
+  vresult = result;
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return vresult;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_std_vector_Sl_std_string_Sg_(void *self) {
+    std::vector< std::string > *arg1 = (std::vector< std::string > *)self;
+    delete arg1;
+}
+
+SWIGINTERN VALUE
+_wrap_merge_states__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string,std::allocator< std::string > > *arg1 = 0 ;
+  char *arg2 = (char *) 0 ;
+  size_t arg3 ;
+  twenty48::vbyte_index_t *arg4 = 0 ;
+  size_t arg5 ;
+  size_t arg6 ;
+  int res1 = SWIG_OLDOBJ ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  size_t val3 ;
+  int ecode3 = 0 ;
+  void *argp4 = 0 ;
+  int res4 = 0 ;
+  size_t val5 ;
+  int ecode5 = 0 ;
+  size_t val6 ;
+  int ecode6 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 6) || (argc > 6)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
+  }
+  {
+    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
+    res1 = swig::asptr(argv[0], &ptr);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_states", 1, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_states", 1, argv[0])); 
+    }
+    arg1 = ptr;
+  }
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","twenty48::merge_states", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  ecode3 = SWIG_AsVal_size_t(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "size_t","twenty48::merge_states", 3, argv[2] ));
+  } 
+  arg3 = static_cast< size_t >(val3);
+  res4 = SWIG_ConvertPtr(argv[3], &argp4, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t,  0 );
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t &","twenty48::merge_states", 4, argv[3] )); 
+  }
+  if (!argp4) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t &","twenty48::merge_states", 4, argv[3])); 
+  }
+  arg4 = reinterpret_cast< twenty48::vbyte_index_t * >(argp4);
+  ecode5 = SWIG_AsVal_size_t(argv[4], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "size_t","twenty48::merge_states", 5, argv[4] ));
+  } 
+  arg5 = static_cast< size_t >(val5);
+  ecode6 = SWIG_AsVal_size_t(argv[5], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "size_t","twenty48::merge_states", 6, argv[5] ));
+  } 
+  arg6 = static_cast< size_t >(val6);
+  result = twenty48::merge_states((std::vector< std::string,std::allocator< std::string > > const &)*arg1,(char const *)arg2,arg3,*arg4,arg5,arg6);
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return vresult;
+fail:
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_merge_states__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string,std::allocator< std::string > > *arg1 = 0 ;
+  char *arg2 = (char *) 0 ;
+  size_t arg3 ;
+  twenty48::vbyte_index_t *arg4 = 0 ;
+  size_t arg5 ;
+  int res1 = SWIG_OLDOBJ ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  size_t val3 ;
+  int ecode3 = 0 ;
+  void *argp4 = 0 ;
+  int res4 = 0 ;
+  size_t val5 ;
+  int ecode5 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 5) || (argc > 5)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 5)",argc); SWIG_fail;
+  }
+  {
+    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
+    res1 = swig::asptr(argv[0], &ptr);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_states", 1, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_states", 1, argv[0])); 
+    }
+    arg1 = ptr;
+  }
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","twenty48::merge_states", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  ecode3 = SWIG_AsVal_size_t(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "size_t","twenty48::merge_states", 3, argv[2] ));
+  } 
+  arg3 = static_cast< size_t >(val3);
+  res4 = SWIG_ConvertPtr(argv[3], &argp4, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t,  0 );
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t &","twenty48::merge_states", 4, argv[3] )); 
+  }
+  if (!argp4) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t &","twenty48::merge_states", 4, argv[3])); 
+  }
+  arg4 = reinterpret_cast< twenty48::vbyte_index_t * >(argp4);
+  ecode5 = SWIG_AsVal_size_t(argv[4], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "size_t","twenty48::merge_states", 5, argv[4] ));
+  } 
+  arg5 = static_cast< size_t >(val5);
+  result = twenty48::merge_states((std::vector< std::string,std::allocator< std::string > > const &)*arg1,(char const *)arg2,arg3,*arg4,arg5);
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return vresult;
+fail:
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_merge_states__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string,std::allocator< std::string > > *arg1 = 0 ;
+  char *arg2 = (char *) 0 ;
+  size_t arg3 ;
+  twenty48::vbyte_index_t *arg4 = 0 ;
+  int res1 = SWIG_OLDOBJ ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  size_t val3 ;
+  int ecode3 = 0 ;
+  void *argp4 = 0 ;
+  int res4 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  {
+    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
+    res1 = swig::asptr(argv[0], &ptr);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_states", 1, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_states", 1, argv[0])); 
+    }
+    arg1 = ptr;
+  }
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","twenty48::merge_states", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  ecode3 = SWIG_AsVal_size_t(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "size_t","twenty48::merge_states", 3, argv[2] ));
+  } 
+  arg3 = static_cast< size_t >(val3);
+  res4 = SWIG_ConvertPtr(argv[3], &argp4, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t,  0 );
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t &","twenty48::merge_states", 4, argv[3] )); 
+  }
+  if (!argp4) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t &","twenty48::merge_states", 4, argv[3])); 
+  }
+  arg4 = reinterpret_cast< twenty48::vbyte_index_t * >(argp4);
+  result = twenty48::merge_states((std::vector< std::string,std::allocator< std::string > > const &)*arg1,(char const *)arg2,arg3,*arg4);
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return vresult;
+fail:
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_merge_states(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[6];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 6) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 4) {
+    int _v;
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_size_t(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            void *vptr = 0;
+            int res = SWIG_ConvertPtr(argv[3], &vptr, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_merge_states__SWIG_2(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  if (argc == 5) {
+    int _v;
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_size_t(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            void *vptr = 0;
+            int res = SWIG_ConvertPtr(argv[3], &vptr, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_size_t(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_merge_states__SWIG_1(nargs, args, self);
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 6) {
+    int _v;
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_size_t(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            void *vptr = 0;
+            int res = SWIG_ConvertPtr(argv[3], &vptr, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_size_t(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                int res = SWIG_AsVal_size_t(argv[5], NULL);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                return _wrap_merge_states__SWIG_0(nargs, args, self);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 6, "merge_states", 
+    "    size_t merge_states(std::vector< std::string,std::allocator< std::string > > const &input_pathnames, char const *output_pathname, size_t index_stride, twenty48::vbyte_index_t &vbyte_index, size_t num_threads, size_t max_files)\n"
+    "    size_t merge_states(std::vector< std::string,std::allocator< std::string > > const &input_pathnames, char const *output_pathname, size_t index_stride, twenty48::vbyte_index_t &vbyte_index, size_t num_threads)\n"
+    "    size_t merge_states(std::vector< std::string,std::allocator< std::string > > const &input_pathnames, char const *output_pathname, size_t index_stride, twenty48::vbyte_index_t &vbyte_index)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_merge_state_probabilities__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string,std::allocator< std::string > > *arg1 = 0 ;
+  char *arg2 = (char *) 0 ;
+  size_t arg3 ;
+  int res1 = SWIG_OLDOBJ ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  size_t val3 ;
+  int ecode3 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  {
+    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
+    res1 = swig::asptr(argv[0], &ptr);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_state_probabilities", 1, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_state_probabilities", 1, argv[0])); 
+    }
+    arg1 = ptr;
+  }
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","twenty48::merge_state_probabilities", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  ecode3 = SWIG_AsVal_size_t(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "size_t","twenty48::merge_state_probabilities", 3, argv[2] ));
+  } 
+  arg3 = static_cast< size_t >(val3);
+  result = twenty48::merge_state_probabilities((std::vector< std::string,std::allocator< std::string > > const &)*arg1,(char const *)arg2,arg3);
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return vresult;
+fail:
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_merge_state_probabilities__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  std::vector< std::string,std::allocator< std::string > > *arg1 = 0 ;
+  char *arg2 = (char *) 0 ;
+  int res1 = SWIG_OLDOBJ ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  {
+    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
+    res1 = swig::asptr(argv[0], &ptr);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_state_probabilities", 1, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_state_probabilities", 1, argv[0])); 
+    }
+    arg1 = ptr;
+  }
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","twenty48::merge_state_probabilities", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  result = twenty48::merge_state_probabilities((std::vector< std::string,std::allocator< std::string > > const &)*arg1,(char const *)arg2);
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return vresult;
+fail:
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_merge_state_probabilities(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[3];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 3) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 2) {
+    int _v;
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_merge_state_probabilities__SWIG_1(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 3) {
+    int _v;
+    int res = swig::asptr(argv[0], (std::vector< std::string,std::allocator< std::string > >**)(0));
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_size_t(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_merge_state_probabilities__SWIG_0(nargs, args, self);
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 3, "merge_state_probabilities", 
+    "    size_t merge_state_probabilities(std::vector< std::string,std::allocator< std::string > > const &input_pathnames, char const *output_pathname, size_t max_files)\n"
+    "    size_t merge_state_probabilities(std::vector< std::string,std::allocator< std::string > > const &input_pathnames, char const *output_pathname)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_write_batch_checkpoint(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  std::vector< std::string,std::allocator< std::string > > *arg2 = 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","twenty48::write_batch_checkpoint", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  {
+    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
+    res2 = swig::asptr(argv[1], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::write_batch_checkpoint", 2, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::write_batch_checkpoint", 2, argv[1])); 
+    }
+    arg2 = ptr;
+  }
+  twenty48::write_batch_checkpoint((char const *)arg1,(std::vector< std::string,std::allocator< std::string > > const &)*arg2);
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_check_batch_checkpoint(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  bool result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","twenty48::check_batch_checkpoint", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  result = (bool)twenty48::check_batch_checkpoint((char const *)arg1);
+  vresult = SWIG_From_bool(static_cast< bool >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+static swig_class SwigClassLayerBuilder2;
+
+SWIGINTERN VALUE
+_wrap_new_LayerBuilder2__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 2 > *arg6 = 0 ;
+  bool arg7 ;
+  size_t arg8 ;
+  size_t arg9 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  bool val7 ;
+  int ecode7 = 0 ;
+  size_t val8 ;
+  int ecode8 = 0 ;
+  size_t val9 ;
+  int ecode9 = 0 ;
+  twenty48::layer_builder_t< 2 > *result = 0 ;
+  
+  if ((argc < 9) || (argc > 9)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 9)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(2)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 5, argv[4] ));
+  }
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_2_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 2 > const &","layer_builder_t<(2)>", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 2 > const &","layer_builder_t<(2)>", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< twenty48::valuer_t< 2 > * >(argp6);
+  ecode7 = SWIG_AsVal_bool(argv[6], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "bool","layer_builder_t<(2)>", 7, argv[6] ));
+  } 
+  arg7 = static_cast< bool >(val7);
+  ecode8 = SWIG_AsVal_size_t(argv[7], &val8);
+  if (!SWIG_IsOK(ecode8)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode8), Ruby_Format_TypeError( "", "size_t","layer_builder_t<(2)>", 8, argv[7] ));
+  } 
+  arg8 = static_cast< size_t >(val8);
+  ecode9 = SWIG_AsVal_size_t(argv[8], &val9);
+  if (!SWIG_IsOK(ecode9)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode9), Ruby_Format_TypeError( "", "size_t","layer_builder_t<(2)>", 9, argv[8] ));
+  } 
+  arg9 = static_cast< size_t >(val9);
+  result = (twenty48::layer_builder_t< 2 > *)new twenty48::layer_builder_t< 2 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 2 > const &)*arg6,arg7,arg8,arg9);
+  DATA_PTR(self) = result;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return self;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_LayerBuilder2__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 2 > *arg6 = 0 ;
+  bool arg7 ;
+  size_t arg8 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  bool val7 ;
+  int ecode7 = 0 ;
+  size_t val8 ;
+  int ecode8 = 0 ;
+  twenty48::layer_builder_t< 2 > *result = 0 ;
+  
+  if ((argc < 8) || (argc > 8)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 8)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(2)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 5, argv[4] ));
+  }
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_2_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 2 > const &","layer_builder_t<(2)>", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 2 > const &","layer_builder_t<(2)>", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< twenty48::valuer_t< 2 > * >(argp6);
+  ecode7 = SWIG_AsVal_bool(argv[6], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "bool","layer_builder_t<(2)>", 7, argv[6] ));
+  } 
+  arg7 = static_cast< bool >(val7);
+  ecode8 = SWIG_AsVal_size_t(argv[7], &val8);
+  if (!SWIG_IsOK(ecode8)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode8), Ruby_Format_TypeError( "", "size_t","layer_builder_t<(2)>", 8, argv[7] ));
+  } 
+  arg8 = static_cast< size_t >(val8);
+  result = (twenty48::layer_builder_t< 2 > *)new twenty48::layer_builder_t< 2 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 2 > const &)*arg6,arg7,arg8);
+  DATA_PTR(self) = result;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return self;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_LayerBuilder2__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 2 > *arg6 = 0 ;
+  bool arg7 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  bool val7 ;
+  int ecode7 = 0 ;
+  twenty48::layer_builder_t< 2 > *result = 0 ;
+  
+  if ((argc < 7) || (argc > 7)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 7)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(2)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 5, argv[4] ));
+  }
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_2_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 2 > const &","layer_builder_t<(2)>", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 2 > const &","layer_builder_t<(2)>", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< twenty48::valuer_t< 2 > * >(argp6);
+  ecode7 = SWIG_AsVal_bool(argv[6], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "bool","layer_builder_t<(2)>", 7, argv[6] ));
+  } 
+  arg7 = static_cast< bool >(val7);
+  result = (twenty48::layer_builder_t< 2 > *)new twenty48::layer_builder_t< 2 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 2 > const &)*arg6,arg7);
+  DATA_PTR(self) = result;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return self;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+_wrap_LayerBuilder2_allocate(VALUE self)
+#else
+_wrap_LayerBuilder2_allocate(int argc, VALUE *argv, VALUE self)
+#endif
+{
+  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__layer_builder_tT_2_t);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+  rb_obj_call_init(vresult, argc, argv);
+#endif
+  return vresult;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_LayerBuilder2__SWIG_3(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 2 > *arg6 = 0 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  twenty48::layer_builder_t< 2 > *result = 0 ;
+  
+  if ((argc < 6) || (argc > 6)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(2)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(2)>", 5, argv[4] ));
+  }
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_2_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 2 > const &","layer_builder_t<(2)>", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 2 > const &","layer_builder_t<(2)>", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< twenty48::valuer_t< 2 > * >(argp6);
+  result = (twenty48::layer_builder_t< 2 > *)new twenty48::layer_builder_t< 2 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 2 > const &)*arg6);
+  DATA_PTR(self) = result;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return self;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_new_LayerBuilder2(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[9];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 9) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 6) {
+    int _v;
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_2_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                return _wrap_new_LayerBuilder2__SWIG_3(nargs, args, self);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 7) {
+    int _v;
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_2_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                {
+                  int res = SWIG_AsVal_bool(argv[6], NULL);
+                  _v = SWIG_CheckState(res);
+                }
+                if (_v) {
+                  return _wrap_new_LayerBuilder2__SWIG_2(nargs, args, self);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 8) {
+    int _v;
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_2_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                {
+                  int res = SWIG_AsVal_bool(argv[6], NULL);
+                  _v = SWIG_CheckState(res);
+                }
+                if (_v) {
+                  {
+                    int res = SWIG_AsVal_size_t(argv[7], NULL);
+                    _v = SWIG_CheckState(res);
+                  }
+                  if (_v) {
+                    return _wrap_new_LayerBuilder2__SWIG_1(nargs, args, self);
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 9) {
+    int _v;
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_2_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                {
+                  int res = SWIG_AsVal_bool(argv[6], NULL);
+                  _v = SWIG_CheckState(res);
+                }
+                if (_v) {
+                  {
+                    int res = SWIG_AsVal_size_t(argv[7], NULL);
+                    _v = SWIG_CheckState(res);
+                  }
+                  if (_v) {
+                    {
+                      int res = SWIG_AsVal_size_t(argv[8], NULL);
+                      _v = SWIG_CheckState(res);
+                    }
+                    if (_v) {
+                      return _wrap_new_LayerBuilder2__SWIG_0(nargs, args, self);
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 9, "LayerBuilder2.new", 
+    "    LayerBuilder2.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 2 > const &valuer, bool sort_outputs, size_t sort_threads, size_t max_bytes)\n"
+    "    LayerBuilder2.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 2 > const &valuer, bool sort_outputs, size_t sort_threads)\n"
+    "    LayerBuilder2.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 2 > const &valuer, bool sort_outputs)\n"
+    "    LayerBuilder2.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 2 > const &valuer)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder2_spill_pathname(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  std::string result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","twenty48::layer_builder_t<(2)>::spill_pathname", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  ecode2 = SWIG_AsVal_size_t(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","twenty48::layer_builder_t<(2)>::spill_pathname", 2, argv[1] ));
+  } 
+  arg2 = static_cast< size_t >(val2);
+  result = twenty48::layer_builder_t< 2 >::SWIGTEMPLATEDISAMBIGUATOR spill_pathname((char const *)arg1,arg2);
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder2_get_num_filter_lookups(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 2 > const *","get_num_filter_lookups", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 2 > * >(argp1);
+  result = ((twenty48::layer_builder_t< 2 > const *)arg1)->get_num_filter_lookups();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder2_get_num_filter_hits(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 2 > const *","get_num_filter_hits", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 2 > * >(argp1);
+  result = ((twenty48::layer_builder_t< 2 > const *)arg1)->get_num_filter_hits();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder2_expand_all(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *) 0 ;
+  twenty48::vbyte_reader_t *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 2 > *","expand_all", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 2 > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
+  (arg1)->expand_all(*arg2);
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder2_expand_all_threaded(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *) 0 ;
+  char *arg2 = (char *) 0 ;
+  twenty48::vbyte_index_t *arg3 = 0 ;
+  size_t arg4 ;
+  size_t arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  size_t val4 ;
+  int ecode4 = 0 ;
+  size_t val5 ;
+  int ecode5 = 0 ;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 2 > *","expand_all_threaded", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 2 > * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","expand_all_threaded", 2, argv[0] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *ptr = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)0;
+    res3 = swig::asptr(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t const &","expand_all_threaded", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t const &","expand_all_threaded", 3, argv[1])); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_size_t(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","expand_all_threaded", 4, argv[2] ));
+  } 
+  arg4 = static_cast< size_t >(val4);
+  ecode5 = SWIG_AsVal_size_t(argv[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "size_t","expand_all_threaded", 5, argv[3] ));
+  } 
+  arg5 = static_cast< size_t >(val5);
+  (arg1)->expand_all_threaded((char const *)arg2,(twenty48::vbyte_index_t const &)*arg3,arg4,arg5);
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return Qnil;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder2_expand_all_threaded_and_merge(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *) 0 ;
+  char *arg2 = (char *) 0 ;
+  twenty48::vbyte_index_t *arg3 = 0 ;
+  size_t arg4 ;
+  size_t arg5 ;
+  std::vector< std::string,std::allocator< std::string > > *arg6 = 0 ;
+  char *arg7 = (char *) 0 ;
+  size_t arg8 ;
+  twenty48::vbyte_index_t *arg9 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  size_t val4 ;
+  int ecode4 = 0 ;
+  size_t val5 ;
+  int ecode5 = 0 ;
+  int res6 = SWIG_OLDOBJ ;
+  int res7 ;
+  char *buf7 = 0 ;
+  int alloc7 = 0 ;
+  size_t val8 ;
+  int ecode8 = 0 ;
+  void *argp9 = 0 ;
+  int res9 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 8) || (argc > 8)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 8)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 2 > *","expand_all_threaded_and_merge", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 2 > * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","expand_all_threaded_and_merge", 2, argv[0] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *ptr = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)0;
+    res3 = swig::asptr(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t const &","expand_all_threaded_and_merge", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t const &","expand_all_threaded_and_merge", 3, argv[1])); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_size_t(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","expand_all_threaded_and_merge", 4, argv[2] ));
+  } 
+  arg4 = static_cast< size_t >(val4);
+  ecode5 = SWIG_AsVal_size_t(argv[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "size_t","expand_all_threaded_and_merge", 5, argv[3] ));
+  } 
+  arg5 = static_cast< size_t >(val5);
+  {
+    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
+    res6 = swig::asptr(argv[4], &ptr);
+    if (!SWIG_IsOK(res6)) {
+      SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","expand_all_threaded_and_merge", 6, argv[4] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","expand_all_threaded_and_merge", 6, argv[4])); 
+    }
+    arg6 = ptr;
+  }
+  res7 = SWIG_AsCharPtrAndSize(argv[5], &buf7, NULL, &alloc7);
+  if (!SWIG_IsOK(res7)) {
+    SWIG_exception_fail(SWIG_ArgError(res7), Ruby_Format_TypeError( "", "char const *","expand_all_threaded_and_merge", 7, argv[5] ));
+  }
+  arg7 = reinterpret_cast< char * >(buf7);
+  ecode8 = SWIG_AsVal_size_t(argv[6], &val8);
+  if (!SWIG_IsOK(ecode8)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode8), Ruby_Format_TypeError( "", "size_t","expand_all_threaded_and_merge", 8, argv[6] ));
+  } 
+  arg8 = static_cast< size_t >(val8);
+  res9 = SWIG_ConvertPtr(argv[7], &argp9, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t,  0 );
+  if (!SWIG_IsOK(res9)) {
+    SWIG_exception_fail(SWIG_ArgError(res9), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t &","expand_all_threaded_and_merge", 9, argv[7] )); 
+  }
+  if (!argp9) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t &","expand_all_threaded_and_merge", 9, argv[7])); 
+  }
+  arg9 = reinterpret_cast< twenty48::vbyte_index_t * >(argp9);
+  result = (arg1)->expand_all_threaded_and_merge((char const *)arg2,(twenty48::vbyte_index_t const &)*arg3,arg4,arg5,(std::vector< std::string,std::allocator< std::string > > const &)*arg6,(char const *)arg7,arg8,*arg9);
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res6)) delete arg6;
+  if (alloc7 == SWIG_NEWOBJ) delete[] buf7;
+  return vresult;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res6)) delete arg6;
+  if (alloc7 == SWIG_NEWOBJ) delete[] buf7;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder2_expand_with_policy(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *) 0 ;
+  twenty48::vbyte_reader_t *arg2 = 0 ;
+  twenty48::policy_reader_t *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 2 > *","expand_with_policy", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 2 > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1])); 
+  }
+  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
+  (arg1)->expand_with_policy(*arg2,*arg3);
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder2_expand_with_policy_and_alternate_actions(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *) 0 ;
+  twenty48::vbyte_reader_t *arg2 = 0 ;
+  twenty48::policy_reader_t *arg3 = 0 ;
+  twenty48::alternate_action_reader_t *arg4 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  void *argp4 = 0 ;
+  int res4 = 0 ;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_2_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 2 > *","expand_with_policy_and_alternate_actions", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 2 > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1])); 
+  }
+  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
+  res4 = SWIG_ConvertPtr(argv[2], &argp4, SWIGTYPE_p_twenty48__alternate_action_reader_t,  0 );
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2] )); 
+  }
+  if (!argp4) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2])); 
+  }
+  arg4 = reinterpret_cast< twenty48::alternate_action_reader_t * >(argp4);
+  (arg1)->expand_with_policy_and_alternate_actions(*arg2,*arg3,*arg4);
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_twenty48_layer_builder_t_Sl_2_Sg_(void *self) {
+    twenty48::layer_builder_t< 2 > *arg1 = (twenty48::layer_builder_t< 2 > *)self;
+    delete arg1;
+}
+
+static swig_class SwigClassLayerBuilder3;
+
+SWIGINTERN VALUE
+_wrap_new_LayerBuilder3__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 3 > *arg6 = 0 ;
+  bool arg7 ;
+  size_t arg8 ;
+  size_t arg9 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  bool val7 ;
+  int ecode7 = 0 ;
+  size_t val8 ;
+  int ecode8 = 0 ;
+  size_t val9 ;
+  int ecode9 = 0 ;
+  twenty48::layer_builder_t< 3 > *result = 0 ;
+  
+  if ((argc < 9) || (argc > 9)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 9)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(3)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 5, argv[4] ));
+  }
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_3_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 3 > const &","layer_builder_t<(3)>", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 3 > const &","layer_builder_t<(3)>", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< twenty48::valuer_t< 3 > * >(argp6);
+  ecode7 = SWIG_AsVal_bool(argv[6], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "bool","layer_builder_t<(3)>", 7, argv[6] ));
+  } 
+  arg7 = static_cast< bool >(val7);
+  ecode8 = SWIG_AsVal_size_t(argv[7], &val8);
+  if (!SWIG_IsOK(ecode8)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode8), Ruby_Format_TypeError( "", "size_t","layer_builder_t<(3)>", 8, argv[7] ));
+  } 
+  arg8 = static_cast< size_t >(val8);
+  ecode9 = SWIG_AsVal_size_t(argv[8], &val9);
+  if (!SWIG_IsOK(ecode9)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode9), Ruby_Format_TypeError( "", "size_t","layer_builder_t<(3)>", 9, argv[8] ));
+  } 
+  arg9 = static_cast< size_t >(val9);
+  result = (twenty48::layer_builder_t< 3 > *)new twenty48::layer_builder_t< 3 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 3 > const &)*arg6,arg7,arg8,arg9);
+  DATA_PTR(self) = result;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return self;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_LayerBuilder3__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 3 > *arg6 = 0 ;
+  bool arg7 ;
+  size_t arg8 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  bool val7 ;
+  int ecode7 = 0 ;
+  size_t val8 ;
+  int ecode8 = 0 ;
+  twenty48::layer_builder_t< 3 > *result = 0 ;
+  
+  if ((argc < 8) || (argc > 8)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 8)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(3)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 5, argv[4] ));
+  }
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_3_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 3 > const &","layer_builder_t<(3)>", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 3 > const &","layer_builder_t<(3)>", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< twenty48::valuer_t< 3 > * >(argp6);
+  ecode7 = SWIG_AsVal_bool(argv[6], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "bool","layer_builder_t<(3)>", 7, argv[6] ));
+  } 
+  arg7 = static_cast< bool >(val7);
+  ecode8 = SWIG_AsVal_size_t(argv[7], &val8);
+  if (!SWIG_IsOK(ecode8)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode8), Ruby_Format_TypeError( "", "size_t","layer_builder_t<(3)>", 8, argv[7] ));
+  } 
+  arg8 = static_cast< size_t >(val8);
+  result = (twenty48::layer_builder_t< 3 > *)new twenty48::layer_builder_t< 3 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 3 > const &)*arg6,arg7,arg8);
+  DATA_PTR(self) = result;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return self;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_LayerBuilder3__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 3 > *arg6 = 0 ;
+  bool arg7 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  bool val7 ;
+  int ecode7 = 0 ;
+  twenty48::layer_builder_t< 3 > *result = 0 ;
+  
+  if ((argc < 7) || (argc > 7)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 7)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(3)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 5, argv[4] ));
+  }
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_3_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 3 > const &","layer_builder_t<(3)>", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 3 > const &","layer_builder_t<(3)>", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< twenty48::valuer_t< 3 > * >(argp6);
+  ecode7 = SWIG_AsVal_bool(argv[6], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "bool","layer_builder_t<(3)>", 7, argv[6] ));
+  } 
+  arg7 = static_cast< bool >(val7);
+  result = (twenty48::layer_builder_t< 3 > *)new twenty48::layer_builder_t< 3 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 3 > const &)*arg6,arg7);
+  DATA_PTR(self) = result;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return self;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+_wrap_LayerBuilder3_allocate(VALUE self)
+#else
+_wrap_LayerBuilder3_allocate(int argc, VALUE *argv, VALUE self)
+#endif
+{
+  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__layer_builder_tT_3_t);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+  rb_obj_call_init(vresult, argc, argv);
+#endif
+  return vresult;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_LayerBuilder3__SWIG_3(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 3 > *arg6 = 0 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  twenty48::layer_builder_t< 3 > *result = 0 ;
+  
+  if ((argc < 6) || (argc > 6)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(3)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(3)>", 5, argv[4] ));
+  }
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_3_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 3 > const &","layer_builder_t<(3)>", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 3 > const &","layer_builder_t<(3)>", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< twenty48::valuer_t< 3 > * >(argp6);
+  result = (twenty48::layer_builder_t< 3 > *)new twenty48::layer_builder_t< 3 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 3 > const &)*arg6);
+  DATA_PTR(self) = result;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return self;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_new_LayerBuilder3(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[9];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 9) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 6) {
+    int _v;
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_3_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                return _wrap_new_LayerBuilder3__SWIG_3(nargs, args, self);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 7) {
+    int _v;
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_3_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                {
+                  int res = SWIG_AsVal_bool(argv[6], NULL);
+                  _v = SWIG_CheckState(res);
+                }
+                if (_v) {
+                  return _wrap_new_LayerBuilder3__SWIG_2(nargs, args, self);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 8) {
+    int _v;
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_3_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                {
+                  int res = SWIG_AsVal_bool(argv[6], NULL);
+                  _v = SWIG_CheckState(res);
+                }
+                if (_v) {
+                  {
+                    int res = SWIG_AsVal_size_t(argv[7], NULL);
+                    _v = SWIG_CheckState(res);
+                  }
+                  if (_v) {
+                    return _wrap_new_LayerBuilder3__SWIG_1(nargs, args, self);
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 9) {
+    int _v;
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_3_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                {
+                  int res = SWIG_AsVal_bool(argv[6], NULL);
+                  _v = SWIG_CheckState(res);
+                }
+                if (_v) {
+                  {
+                    int res = SWIG_AsVal_size_t(argv[7], NULL);
+                    _v = SWIG_CheckState(res);
+                  }
+                  if (_v) {
+                    {
+                      int res = SWIG_AsVal_size_t(argv[8], NULL);
+                      _v = SWIG_CheckState(res);
+                    }
+                    if (_v) {
+                      return _wrap_new_LayerBuilder3__SWIG_0(nargs, args, self);
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 9, "LayerBuilder3.new", 
+    "    LayerBuilder3.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 3 > const &valuer, bool sort_outputs, size_t sort_threads, size_t max_bytes)\n"
+    "    LayerBuilder3.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 3 > const &valuer, bool sort_outputs, size_t sort_threads)\n"
+    "    LayerBuilder3.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 3 > const &valuer, bool sort_outputs)\n"
+    "    LayerBuilder3.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 3 > const &valuer)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder3_spill_pathname(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  std::string result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","twenty48::layer_builder_t<(3)>::spill_pathname", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  ecode2 = SWIG_AsVal_size_t(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","twenty48::layer_builder_t<(3)>::spill_pathname", 2, argv[1] ));
+  } 
+  arg2 = static_cast< size_t >(val2);
+  result = twenty48::layer_builder_t< 3 >::SWIGTEMPLATEDISAMBIGUATOR spill_pathname((char const *)arg1,arg2);
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder3_get_num_filter_lookups(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 3 > const *","get_num_filter_lookups", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 3 > * >(argp1);
+  result = ((twenty48::layer_builder_t< 3 > const *)arg1)->get_num_filter_lookups();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder3_get_num_filter_hits(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 3 > const *","get_num_filter_hits", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 3 > * >(argp1);
+  result = ((twenty48::layer_builder_t< 3 > const *)arg1)->get_num_filter_hits();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder3_expand_all(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *) 0 ;
+  twenty48::vbyte_reader_t *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 3 > *","expand_all", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 3 > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
+  (arg1)->expand_all(*arg2);
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder3_expand_all_threaded(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *) 0 ;
+  char *arg2 = (char *) 0 ;
+  twenty48::vbyte_index_t *arg3 = 0 ;
+  size_t arg4 ;
+  size_t arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  size_t val4 ;
+  int ecode4 = 0 ;
+  size_t val5 ;
+  int ecode5 = 0 ;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 3 > *","expand_all_threaded", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 3 > * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","expand_all_threaded", 2, argv[0] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *ptr = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)0;
+    res3 = swig::asptr(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t const &","expand_all_threaded", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t const &","expand_all_threaded", 3, argv[1])); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_size_t(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","expand_all_threaded", 4, argv[2] ));
+  } 
+  arg4 = static_cast< size_t >(val4);
+  ecode5 = SWIG_AsVal_size_t(argv[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "size_t","expand_all_threaded", 5, argv[3] ));
+  } 
+  arg5 = static_cast< size_t >(val5);
+  (arg1)->expand_all_threaded((char const *)arg2,(twenty48::vbyte_index_t const &)*arg3,arg4,arg5);
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return Qnil;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder3_expand_all_threaded_and_merge(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *) 0 ;
+  char *arg2 = (char *) 0 ;
+  twenty48::vbyte_index_t *arg3 = 0 ;
+  size_t arg4 ;
+  size_t arg5 ;
+  std::vector< std::string,std::allocator< std::string > > *arg6 = 0 ;
+  char *arg7 = (char *) 0 ;
+  size_t arg8 ;
+  twenty48::vbyte_index_t *arg9 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  size_t val4 ;
+  int ecode4 = 0 ;
+  size_t val5 ;
+  int ecode5 = 0 ;
+  int res6 = SWIG_OLDOBJ ;
+  int res7 ;
+  char *buf7 = 0 ;
+  int alloc7 = 0 ;
+  size_t val8 ;
+  int ecode8 = 0 ;
+  void *argp9 = 0 ;
+  int res9 = 0 ;
+  size_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 8) || (argc > 8)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 8)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 3 > *","expand_all_threaded_and_merge", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 3 > * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","expand_all_threaded_and_merge", 2, argv[0] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *ptr = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)0;
+    res3 = swig::asptr(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t const &","expand_all_threaded_and_merge", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t const &","expand_all_threaded_and_merge", 3, argv[1])); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_size_t(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","expand_all_threaded_and_merge", 4, argv[2] ));
+  } 
+  arg4 = static_cast< size_t >(val4);
+  ecode5 = SWIG_AsVal_size_t(argv[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "size_t","expand_all_threaded_and_merge", 5, argv[3] ));
+  } 
+  arg5 = static_cast< size_t >(val5);
+  {
+    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
+    res6 = swig::asptr(argv[4], &ptr);
+    if (!SWIG_IsOK(res6)) {
+      SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","expand_all_threaded_and_merge", 6, argv[4] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","expand_all_threaded_and_merge", 6, argv[4])); 
+    }
+    arg6 = ptr;
+  }
+  res7 = SWIG_AsCharPtrAndSize(argv[5], &buf7, NULL, &alloc7);
+  if (!SWIG_IsOK(res7)) {
+    SWIG_exception_fail(SWIG_ArgError(res7), Ruby_Format_TypeError( "", "char const *","expand_all_threaded_and_merge", 7, argv[5] ));
+  }
+  arg7 = reinterpret_cast< char * >(buf7);
+  ecode8 = SWIG_AsVal_size_t(argv[6], &val8);
+  if (!SWIG_IsOK(ecode8)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode8), Ruby_Format_TypeError( "", "size_t","expand_all_threaded_and_merge", 8, argv[6] ));
+  } 
+  arg8 = static_cast< size_t >(val8);
+  res9 = SWIG_ConvertPtr(argv[7], &argp9, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t,  0 );
+  if (!SWIG_IsOK(res9)) {
+    SWIG_exception_fail(SWIG_ArgError(res9), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t &","expand_all_threaded_and_merge", 9, argv[7] )); 
+  }
+  if (!argp9) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t &","expand_all_threaded_and_merge", 9, argv[7])); 
+  }
+  arg9 = reinterpret_cast< twenty48::vbyte_index_t * >(argp9);
+  result = (arg1)->expand_all_threaded_and_merge((char const *)arg2,(twenty48::vbyte_index_t const &)*arg3,arg4,arg5,(std::vector< std::string,std::allocator< std::string > > const &)*arg6,(char const *)arg7,arg8,*arg9);
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res6)) delete arg6;
+  if (alloc7 == SWIG_NEWOBJ) delete[] buf7;
+  return vresult;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res6)) delete arg6;
+  if (alloc7 == SWIG_NEWOBJ) delete[] buf7;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder3_expand_with_policy(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *) 0 ;
+  twenty48::vbyte_reader_t *arg2 = 0 ;
+  twenty48::policy_reader_t *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 3 > *","expand_with_policy", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 3 > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1])); 
+  }
+  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
+  (arg1)->expand_with_policy(*arg2,*arg3);
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder3_expand_with_policy_and_alternate_actions(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *) 0 ;
+  twenty48::vbyte_reader_t *arg2 = 0 ;
+  twenty48::policy_reader_t *arg3 = 0 ;
+  twenty48::alternate_action_reader_t *arg4 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  void *argp4 = 0 ;
+  int res4 = 0 ;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_3_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 3 > *","expand_with_policy_and_alternate_actions", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 3 > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1])); 
+  }
+  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
+  res4 = SWIG_ConvertPtr(argv[2], &argp4, SWIGTYPE_p_twenty48__alternate_action_reader_t,  0 );
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2] )); 
+  }
+  if (!argp4) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2])); 
+  }
+  arg4 = reinterpret_cast< twenty48::alternate_action_reader_t * >(argp4);
+  (arg1)->expand_with_policy_and_alternate_actions(*arg2,*arg3,*arg4);
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_twenty48_layer_builder_t_Sl_3_Sg_(void *self) {
+    twenty48::layer_builder_t< 3 > *arg1 = (twenty48::layer_builder_t< 3 > *)self;
+    delete arg1;
+}
+
+static swig_class SwigClassLayerBuilder4;
+
+SWIGINTERN VALUE
+_wrap_new_LayerBuilder4__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 4 > *arg6 = 0 ;
+  bool arg7 ;
+  size_t arg8 ;
+  size_t arg9 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  bool val7 ;
+  int ecode7 = 0 ;
+  size_t val8 ;
+  int ecode8 = 0 ;
+  size_t val9 ;
+  int ecode9 = 0 ;
+  twenty48::layer_builder_t< 4 > *result = 0 ;
+  
+  if ((argc < 9) || (argc > 9)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 9)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(4)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 2, argv[1] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 5, argv[4] ));
   }
-  arg1 = reinterpret_cast< std::vector< twenty48::vbyte_index_entry_t > * >(argp1);
-  result = ((std::vector< twenty48::vbyte_index_entry_t > const *)arg1)->capacity();
-  vresult = SWIG_From_size_t(static_cast< size_t >(result));
-  return vresult;
-fail:
-  return Qnil;
-}
-
-
-SWIGINTERN void
-free_std_vector_Sl_twenty48_vbyte_index_entry_t_Sg_(void *self) {
-    std::vector< twenty48::vbyte_index_entry_t > *arg1 = (std::vector< twenty48::vbyte_index_entry_t > *)self;
-    delete arg1;
-}
-
-static swig_class SwigClassVByteReader;
-
-SWIGINTERN VALUE
-_wrap_new_VByteReader__SWIG_0(int argc, VALUE *argv, VALUE self) {
-  char *arg1 = (char *) 0 ;
-  size_t arg2 ;
-  uint64_t arg3 ;
-  size_t arg4 ;
-  int res1 ;
-  char *buf1 = 0 ;
-  int alloc1 = 0 ;
-  size_t val2 ;
-  int ecode2 = 0 ;
-  unsigned long long val3 ;
-  int ecode3 = 0 ;
-  size_t val4 ;
-  int ecode4 = 0 ;
-  twenty48::vbyte_reader_t *result = 0 ;
-  
-  if ((argc < 4) || (argc > 4)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_4_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 4 > const &","layer_builder_t<(4)>", 6, argv[5] )); 
   }
-  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","vbyte_reader_t", 1, argv[0] ));
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 4 > const &","layer_builder_t<(4)>", 6, argv[5])); 
   }
-  arg1 = reinterpret_cast< char * >(buf1);
-  ecode2 = SWIG_AsVal_size_t(argv[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","vbyte_reader_t", 2, argv[1] ));
+  arg6 = reinterpret_cast< twenty48::valuer_t< 4 > * >(argp6);
+  ecode7 = SWIG_AsVal_bool(argv[6], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "bool","layer_builder_t<(4)>", 7, argv[6] ));
   } 
-  arg2 = static_cast< size_t >(val2);
-  ecode3 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "uint64_t","vbyte_reader_t", 3, argv[2] ));
+  arg7 = static_cast< bool >(val7);
+  ecode8 = SWIG_AsVal_size_t(argv[7], &val8);
+  if (!SWIG_IsOK(ecode8)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode8), Ruby_Format_TypeError( "", "size_t","layer_builder_t<(4)>", 8, argv[7] ));
   } 
-  arg3 = static_cast< uint64_t >(val3);
-  ecode4 = SWIG_AsVal_size_t(argv[3], &val4);
-  if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","vbyte_reader_t", 4, argv[3] ));
+  arg8 = static_cast< size_t >(val8);
+  ecode9 = SWIG_AsVal_size_t(argv[8], &val9);
+  if (!SWIG_IsOK(ecode9)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode9), Ruby_Format_TypeError( "", "size_t","layer_builder_t<(4)>", 9, argv[8] ));
   } 
-  arg4 = static_cast< size_t >(val4);
-  result = (twenty48::vbyte_reader_t *)new twenty48::vbyte_reader_t((char const *)arg1,arg2,arg3,arg4);
+  arg9 = static_cast< size_t >(val9);
+  result = (twenty48::layer_builder_t< 4 > *)new twenty48::layer_builder_t< 4 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 4 > const &)*arg6,arg7,arg8,arg9);
   DATA_PTR(self) = result;
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
   return self;
 fail:
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_new_VByteReader__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  char *arg1 = (char *) 0 ;
-  size_t arg2 ;
-  uint64_t arg3 ;
-  int res1 ;
-  char *buf1 = 0 ;
-  int alloc1 = 0 ;
-  size_t val2 ;
-  int ecode2 = 0 ;
-  unsigned long long val3 ;
-  int ecode3 = 0 ;
-  twenty48::vbyte_reader_t *result = 0 ;
+_wrap_new_LayerBuilder4__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 4 > *arg6 = 0 ;
+  bool arg7 ;
+  size_t arg8 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  bool val7 ;
+  int ecode7 = 0 ;
+  size_t val8 ;
+  int ecode8 = 0 ;
+  twenty48::layer_builder_t< 4 > *result = 0 ;
   
-  if ((argc < 3) || (argc > 3)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  if ((argc < 8) || (argc > 8)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 8)",argc); SWIG_fail;
   }
-  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","vbyte_reader_t", 1, argv[0] ));
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(4)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 2, argv[1] ));
   }
-  arg1 = reinterpret_cast< char * >(buf1);
-  ecode2 = SWIG_AsVal_size_t(argv[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","vbyte_reader_t", 2, argv[1] ));
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 5, argv[4] ));
+  }
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_4_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 4 > const &","layer_builder_t<(4)>", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 4 > const &","layer_builder_t<(4)>", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< twenty48::valuer_t< 4 > * >(argp6);
+  ecode7 = SWIG_AsVal_bool(argv[6], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "bool","layer_builder_t<(4)>", 7, argv[6] ));
   } 
-  arg2 = static_cast< size_t >(val2);
-  ecode3 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "uint64_t","vbyte_reader_t", 3, argv[2] ));
+  arg7 = static_cast< bool >(val7);
+  ecode8 = SWIG_AsVal_size_t(argv[7], &val8);
+  if (!SWIG_IsOK(ecode8)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode8), Ruby_Format_TypeError( "", "size_t","layer_builder_t<(4)>", 8, argv[7] ));
   } 
-  arg3 = static_cast< uint64_t >(val3);
-  result = (twenty48::vbyte_reader_t *)new twenty48::vbyte_reader_t((char const *)arg1,arg2,arg3);
+  arg8 = static_cast< size_t >(val8);
+  result = (twenty48::layer_builder_t< 4 > *)new twenty48::layer_builder_t< 4 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 4 > const &)*arg6,arg7,arg8);
   DATA_PTR(self) = result;
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
   return self;
 fail:
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_new_VByteReader__SWIG_2(int argc, VALUE *argv, VALUE self) {
-  char *arg1 = (char *) 0 ;
-  size_t arg2 ;
-  int res1 ;
-  char *buf1 = 0 ;
-  int alloc1 = 0 ;
-  size_t val2 ;
-  int ecode2 = 0 ;
-  twenty48::vbyte_reader_t *result = 0 ;
+_wrap_new_LayerBuilder4__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 4 > *arg6 = 0 ;
+  bool arg7 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  bool val7 ;
+  int ecode7 = 0 ;
+  twenty48::layer_builder_t< 4 > *result = 0 ;
   
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  if ((argc < 7) || (argc > 7)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 7)",argc); SWIG_fail;
   }
-  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","vbyte_reader_t", 1, argv[0] ));
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(4)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 2, argv[1] ));
   }
-  arg1 = reinterpret_cast< char * >(buf1);
-  ecode2 = SWIG_AsVal_size_t(argv[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","vbyte_reader_t", 2, argv[1] ));
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 5, argv[4] ));
+  }
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_4_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 4 > const &","layer_builder_t<(4)>", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 4 > const &","layer_builder_t<(4)>", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< twenty48::valuer_t< 4 > * >(argp6);
+  ecode7 = SWIG_AsVal_bool(argv[6], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "bool","layer_builder_t<(4)>", 7, argv[6] ));
   } 
-  arg2 = static_cast< size_t >(val2);
-  result = (twenty48::vbyte_reader_t *)new twenty48::vbyte_reader_t((char const *)arg1,arg2);
+  arg7 = static_cast< bool >(val7);
+  result = (twenty48::layer_builder_t< 4 > *)new twenty48::layer_builder_t< 4 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 4 > const &)*arg6,arg7);
   DATA_PTR(self) = result;
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
   return self;
 fail:
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
 #ifdef HAVE_RB_DEFINE_ALLOC_FUNC
-_wrap_VByteReader_allocate(VALUE self)
+_wrap_LayerBuilder4_allocate(VALUE self)
 #else
-_wrap_VByteReader_allocate(int argc, VALUE *argv, VALUE self)
+_wrap_LayerBuilder4_allocate(int argc, VALUE *argv, VALUE self)
 #endif
 {
-  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__vbyte_reader_t);
+  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__layer_builder_tT_4_t);
 #ifndef HAVE_RB_DEFINE_ALLOC_FUNC
   rb_obj_call_init(vresult, argc, argv);
 #endif
@@ -36159,209 +39733,334 @@ _wrap_VByteReader_allocate(int argc, VALUE *argv, VALUE self)
 
 
 SWIGINTERN VALUE
-_wrap_new_VByteReader__SWIG_3(int argc, VALUE *argv, VALUE self) {
-  char *arg1 = (char *) 0 ;
-  int res1 ;
-  char *buf1 = 0 ;
-  int alloc1 = 0 ;
-  twenty48::vbyte_reader_t *result = 0 ;
+_wrap_new_LayerBuilder4__SWIG_3(int argc, VALUE *argv, VALUE self) {
+  uint8_t arg1 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  char *arg5 = (char *) 0 ;
+  twenty48::valuer_t< 4 > *arg6 = 0 ;
+  unsigned char val1 ;
+  int ecode1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  void *argp6 ;
+  int res6 = 0 ;
+  twenty48::layer_builder_t< 4 > *result = 0 ;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 6) || (argc > 6)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
   }
-  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","vbyte_reader_t", 1, argv[0] ));
+  ecode1 = SWIG_AsVal_unsigned_SS_char(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint8_t","layer_builder_t<(4)>", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint8_t >(val1);
+  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 2, argv[1] ));
   }
-  arg1 = reinterpret_cast< char * >(buf1);
-  result = (twenty48::vbyte_reader_t *)new twenty48::vbyte_reader_t((char const *)arg1);
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(argv[2], &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 3, argv[2] ));
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  res4 = SWIG_AsCharPtrAndSize(argv[3], &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 4, argv[3] ));
+  }
+  arg4 = reinterpret_cast< char * >(buf4);
+  res5 = SWIG_AsCharPtrAndSize(argv[4], &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "char const *","layer_builder_t<(4)>", 5, argv[4] ));
+  }
+  arg5 = reinterpret_cast< char * >(buf5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_twenty48__valuer_tT_4_t,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "twenty48::valuer_t< 4 > const &","layer_builder_t<(4)>", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::valuer_t< 4 > const &","layer_builder_t<(4)>", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< twenty48::valuer_t< 4 > * >(argp6);
+  result = (twenty48::layer_builder_t< 4 > *)new twenty48::layer_builder_t< 4 >(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,(char const *)arg5,(twenty48::valuer_t< 4 > const &)*arg6);
   DATA_PTR(self) = result;
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
   return self;
 fail:
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  if (alloc4 == SWIG_NEWOBJ) delete[] buf4;
+  if (alloc5 == SWIG_NEWOBJ) delete[] buf5;
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_new_VByteReader(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_new_LayerBuilder4(int nargs, VALUE *args, VALUE self) {
   int argc;
-  VALUE argv[4];
+  VALUE argv[9];
   int ii;
   
   argc = nargs;
-  if (argc > 4) SWIG_fail;
+  if (argc > 9) SWIG_fail;
   for (ii = 0; (ii < argc); ++ii) {
     argv[ii] = args[ii];
   }
-  if (argc == 1) {
+  if (argc == 6) {
     int _v;
-    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_new_VByteReader__SWIG_3(nargs, args, self);
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
     }
-  }
-  if (argc == 2) {
-    int _v;
-    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
-    _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_size_t(argv[1], NULL);
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
-        return _wrap_new_VByteReader__SWIG_2(nargs, args, self);
+        {
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_4_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                return _wrap_new_LayerBuilder4__SWIG_3(nargs, args, self);
+              }
+            }
+          }
+        }
       }
     }
   }
-  if (argc == 3) {
+  if (argc == 7) {
     int _v;
-    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
-    _v = SWIG_CheckState(res);
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
     if (_v) {
       {
-        int res = SWIG_AsVal_size_t(argv[1], NULL);
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
         {
-          int res = SWIG_AsVal_unsigned_SS_long_SS_long(argv[2], NULL);
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
           _v = SWIG_CheckState(res);
         }
         if (_v) {
-          return _wrap_new_VByteReader__SWIG_1(nargs, args, self);
+          {
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_4_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                {
+                  int res = SWIG_AsVal_bool(argv[6], NULL);
+                  _v = SWIG_CheckState(res);
+                }
+                if (_v) {
+                  return _wrap_new_LayerBuilder4__SWIG_2(nargs, args, self);
+                }
+              }
+            }
+          }
         }
       }
     }
   }
-  if (argc == 4) {
+  if (argc == 8) {
     int _v;
-    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
-    _v = SWIG_CheckState(res);
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
     if (_v) {
       {
-        int res = SWIG_AsVal_size_t(argv[1], NULL);
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
         {
-          int res = SWIG_AsVal_unsigned_SS_long_SS_long(argv[2], NULL);
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
           _v = SWIG_CheckState(res);
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_size_t(argv[3], NULL);
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
-            return _wrap_new_VByteReader__SWIG_0(nargs, args, self);
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_4_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                {
+                  int res = SWIG_AsVal_bool(argv[6], NULL);
+                  _v = SWIG_CheckState(res);
+                }
+                if (_v) {
+                  {
+                    int res = SWIG_AsVal_size_t(argv[7], NULL);
+                    _v = SWIG_CheckState(res);
+                  }
+                  if (_v) {
+                    return _wrap_new_LayerBuilder4__SWIG_1(nargs, args, self);
+                  }
+                }
+              }
+            }
           }
         }
       }
     }
   }
-  
-fail:
-  Ruby_Format_OverloadedError( argc, 4, "vbyte_reader_t.new", 
-    "    vbyte_reader_t.new(char const *pathname, size_t byte_offset, uint64_t previous, size_t max_states)\n"
-    "    vbyte_reader_t.new(char const *pathname, size_t byte_offset, uint64_t previous)\n"
-    "    vbyte_reader_t.new(char const *pathname, size_t byte_offset)\n"
-    "    vbyte_reader_t.new(char const *pathname)\n");
-  
-  return Qnil;
-}
-
-
-SWIGINTERN VALUE
-_wrap_VByteReader_read(int argc, VALUE *argv, VALUE self) {
-  twenty48::vbyte_reader_t *arg1 = (twenty48::vbyte_reader_t *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  uint64_t result;
-  VALUE vresult = Qnil;
-  
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_reader_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t *","read", 1, self )); 
-  }
-  arg1 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp1);
-  result = (uint64_t)(arg1)->read();
-  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
-  return vresult;
-fail:
-  return Qnil;
-}
-
-
-SWIGINTERN VALUE
-_wrap_VByteReader_close(int argc, VALUE *argv, VALUE self) {
-  twenty48::vbyte_reader_t *arg1 = (twenty48::vbyte_reader_t *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_reader_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t *","close", 1, self )); 
+  if (argc == 9) {
+    int _v;
+    {
+      int res = SWIG_AsVal_unsigned_SS_char(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsCharPtrAndSize(argv[2], 0, NULL, 0);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsCharPtrAndSize(argv[3], 0, NULL, 0);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsCharPtrAndSize(argv[4], 0, NULL, 0);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_twenty48__valuer_tT_4_t, 0);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                {
+                  int res = SWIG_AsVal_bool(argv[6], NULL);
+                  _v = SWIG_CheckState(res);
+                }
+                if (_v) {
+                  {
+                    int res = SWIG_AsVal_size_t(argv[7], NULL);
+                    _v = SWIG_CheckState(res);
+                  }
+                  if (_v) {
+                    {
+                      int res = SWIG_AsVal_size_t(argv[8], NULL);
+                      _v = SWIG_CheckState(res);
+                    }
+                    if (_v) {
+                      return _wrap_new_LayerBuilder4__SWIG_0(nargs, args, self);
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
   }
-  arg1 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp1);
-  (arg1)->close();
-  return Qnil;
+  
 fail:
+  Ruby_Format_OverloadedError( argc, 9, "LayerBuilder4.new", 
+    "    LayerBuilder4.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 4 > const &valuer, bool sort_outputs, size_t sort_threads, size_t max_bytes)\n"
+    "    LayerBuilder4.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 4 > const &valuer, bool sort_outputs, size_t sort_threads)\n"
+    "    LayerBuilder4.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 4 > const &valuer, bool sort_outputs)\n"
+    "    LayerBuilder4.new(uint8_t input_max_value, char const *pathname_1_0, char const *pathname_1_1, char const *pathname_2_0, char const *pathname_2_1, twenty48::valuer_t< 4 > const &valuer)\n");
+  
   return Qnil;
 }
 
 
-SWIGINTERN void
-free_twenty48_vbyte_reader_t(void *self) {
-    twenty48::vbyte_reader_t *arg1 = (twenty48::vbyte_reader_t *)self;
-    delete arg1;
-}
-
-static swig_class SwigClassVByteWriter;
-
-SWIGINTERN VALUE
-#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
-_wrap_VByteWriter_allocate(VALUE self)
-#else
-_wrap_VByteWriter_allocate(int argc, VALUE *argv, VALUE self)
-#endif
-{
-  VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_twenty48__vbyte_writer_t);
-#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
-  rb_obj_call_init(vresult, argc, argv);
-#endif
-  return vresult;
-}
-
-
 SWIGINTERN VALUE
-_wrap_new_VByteWriter(int argc, VALUE *argv, VALUE self) {
+_wrap_LayerBuilder4_spill_pathname(int argc, VALUE *argv, VALUE self) {
   char *arg1 = (char *) 0 ;
+  size_t arg2 ;
   int res1 ;
   char *buf1 = 0 ;
   int alloc1 = 0 ;
-  twenty48::vbyte_writer_t *result = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  std::string result;
+  VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
   res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","vbyte_writer_t", 1, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","twenty48::layer_builder_t<(4)>::spill_pathname", 1, argv[0] ));
   }
   arg1 = reinterpret_cast< char * >(buf1);
-  result = (twenty48::vbyte_writer_t *)new twenty48::vbyte_writer_t((char const *)arg1);
-  DATA_PTR(self) = result;
+  ecode2 = SWIG_AsVal_size_t(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "size_t","twenty48::layer_builder_t<(4)>::spill_pathname", 2, argv[1] ));
+  } 
+  arg2 = static_cast< size_t >(val2);
+  result = twenty48::layer_builder_t< 4 >::SWIGTEMPLATEDISAMBIGUATOR spill_pathname((char const *)arg1,arg2);
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
   if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
-  return self;
+  return vresult;
 fail:
   if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return Qnil;
@@ -36369,23 +40068,23 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteWriter_get_bytes_written(int argc, VALUE *argv, VALUE self) {
-  twenty48::vbyte_writer_t *arg1 = (twenty48::vbyte_writer_t *) 0 ;
+_wrap_LayerBuilder4_get_num_filter_lookups(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  uint64_t result;
+  size_t result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_writer_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_4_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_writer_t const *","get_bytes_written", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 4 > const *","get_num_filter_lookups", 1, self )); 
   }
-  arg1 = reinterpret_cast< twenty48::vbyte_writer_t * >(argp1);
-  result = (uint64_t)((twenty48::vbyte_writer_t const *)arg1)->get_bytes_written();
-  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 4 > * >(argp1);
+  result = ((twenty48::layer_builder_t< 4 > const *)arg1)->get_num_filter_lookups();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
   return vresult;
 fail:
   return Qnil;
@@ -36393,23 +40092,23 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteWriter_get_previous(int argc, VALUE *argv, VALUE self) {
-  twenty48::vbyte_writer_t *arg1 = (twenty48::vbyte_writer_t *) 0 ;
+_wrap_LayerBuilder4_get_num_filter_hits(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  uint64_t result;
+  size_t result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_writer_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_4_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_writer_t const *","get_previous", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 4 > const *","get_num_filter_hits", 1, self )); 
   }
-  arg1 = reinterpret_cast< twenty48::vbyte_writer_t * >(argp1);
-  result = (uint64_t)((twenty48::vbyte_writer_t const *)arg1)->get_previous();
-  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 4 > * >(argp1);
+  result = ((twenty48::layer_builder_t< 4 > const *)arg1)->get_num_filter_hits();
+  vresult = SWIG_From_size_t(static_cast< size_t >(result));
   return vresult;
 fail:
   return Qnil;
@@ -36417,28 +40116,31 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteWriter_write(int argc, VALUE *argv, VALUE self) {
-  twenty48::vbyte_writer_t *arg1 = (twenty48::vbyte_writer_t *) 0 ;
-  uint64_t arg2 ;
+_wrap_LayerBuilder4_expand_all(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *) 0 ;
+  twenty48::vbyte_reader_t *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned long long val2 ;
-  int ecode2 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_writer_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_4_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_writer_t *","write", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 4 > *","expand_all", 1, self )); 
   }
-  arg1 = reinterpret_cast< twenty48::vbyte_writer_t * >(argp1);
-  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","write", 2, argv[0] ));
-  } 
-  arg2 = static_cast< uint64_t >(val2);
-  (arg1)->write(arg2);
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 4 > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_all", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
+  (arg1)->expand_all(*arg2);
   return Qnil;
 fail:
   return Qnil;
@@ -36446,135 +40148,282 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_VByteWriter_close(int argc, VALUE *argv, VALUE self) {
-  twenty48::vbyte_writer_t *arg1 = (twenty48::vbyte_writer_t *) 0 ;
+_wrap_LayerBuilder4_expand_all_threaded(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *) 0 ;
+  char *arg2 = (char *) 0 ;
+  twenty48::vbyte_index_t *arg3 = 0 ;
+  size_t arg4 ;
+  size_t arg5 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  size_t val4 ;
+  int ecode4 = 0 ;
+  size_t val5 ;
+  int ecode5 = 0 ;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__vbyte_writer_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_4_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::vbyte_writer_t *","close", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 4 > *","expand_all_threaded", 1, self )); 
   }
-  arg1 = reinterpret_cast< twenty48::vbyte_writer_t * >(argp1);
-  (arg1)->close();
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 4 > * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","expand_all_threaded", 2, argv[0] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *ptr = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)0;
+    res3 = swig::asptr(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t const &","expand_all_threaded", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t const &","expand_all_threaded", 3, argv[1])); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_size_t(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","expand_all_threaded", 4, argv[2] ));
+  } 
+  arg4 = static_cast< size_t >(val4);
+  ecode5 = SWIG_AsVal_size_t(argv[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "size_t","expand_all_threaded", 5, argv[3] ));
+  } 
+  arg5 = static_cast< size_t >(val5);
+  (arg1)->expand_all_threaded((char const *)arg2,(twenty48::vbyte_index_t const &)*arg3,arg4,arg5);
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 }
 
 
-SWIGINTERN void
-free_twenty48_vbyte_writer_t(void *self) {
-    twenty48::vbyte_writer_t *arg1 = (twenty48::vbyte_writer_t *)self;
-    delete arg1;
-}
-
 SWIGINTERN VALUE
-_wrap_merge_states(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string,std::allocator< std::string > > *arg1 = 0 ;
+_wrap_LayerBuilder4_expand_all_threaded_and_merge(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *) 0 ;
   char *arg2 = (char *) 0 ;
-  size_t arg3 ;
-  twenty48::vbyte_index_t *arg4 = 0 ;
-  int res1 = SWIG_OLDOBJ ;
+  twenty48::vbyte_index_t *arg3 = 0 ;
+  size_t arg4 ;
+  size_t arg5 ;
+  std::vector< std::string,std::allocator< std::string > > *arg6 = 0 ;
+  char *arg7 = (char *) 0 ;
+  size_t arg8 ;
+  twenty48::vbyte_index_t *arg9 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
   int res2 ;
   char *buf2 = 0 ;
   int alloc2 = 0 ;
-  size_t val3 ;
-  int ecode3 = 0 ;
-  void *argp4 = 0 ;
-  int res4 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  size_t val4 ;
+  int ecode4 = 0 ;
+  size_t val5 ;
+  int ecode5 = 0 ;
+  int res6 = SWIG_OLDOBJ ;
+  int res7 ;
+  char *buf7 = 0 ;
+  int alloc7 = 0 ;
+  size_t val8 ;
+  int ecode8 = 0 ;
+  void *argp9 = 0 ;
+  int res9 = 0 ;
   size_t result;
   VALUE vresult = Qnil;
   
-  if ((argc < 4) || (argc > 4)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  if ((argc < 8) || (argc > 8)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 8)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_4_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 4 > *","expand_all_threaded_and_merge", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 4 > * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","expand_all_threaded_and_merge", 2, argv[0] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *ptr = (std::vector< twenty48::vbyte_index_entry_t,std::allocator< twenty48::vbyte_index_entry_t > > *)0;
+    res3 = swig::asptr(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t const &","expand_all_threaded_and_merge", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t const &","expand_all_threaded_and_merge", 3, argv[1])); 
+    }
+    arg3 = ptr;
   }
+  ecode4 = SWIG_AsVal_size_t(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "size_t","expand_all_threaded_and_merge", 4, argv[2] ));
+  } 
+  arg4 = static_cast< size_t >(val4);
+  ecode5 = SWIG_AsVal_size_t(argv[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "size_t","expand_all_threaded_and_merge", 5, argv[3] ));
+  } 
+  arg5 = static_cast< size_t >(val5);
   {
     std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
-    res1 = swig::asptr(argv[0], &ptr);
-    if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_states", 1, argv[0] )); 
+    res6 = swig::asptr(argv[4], &ptr);
+    if (!SWIG_IsOK(res6)) {
+      SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","expand_all_threaded_and_merge", 6, argv[4] )); 
     }
     if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_states", 1, argv[0])); 
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","expand_all_threaded_and_merge", 6, argv[4])); 
     }
-    arg1 = ptr;
+    arg6 = ptr;
   }
-  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","twenty48::merge_states", 2, argv[1] ));
+  res7 = SWIG_AsCharPtrAndSize(argv[5], &buf7, NULL, &alloc7);
+  if (!SWIG_IsOK(res7)) {
+    SWIG_exception_fail(SWIG_ArgError(res7), Ruby_Format_TypeError( "", "char const *","expand_all_threaded_and_merge", 7, argv[5] ));
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  ecode3 = SWIG_AsVal_size_t(argv[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "size_t","twenty48::merge_states", 3, argv[2] ));
+  arg7 = reinterpret_cast< char * >(buf7);
+  ecode8 = SWIG_AsVal_size_t(argv[6], &val8);
+  if (!SWIG_IsOK(ecode8)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode8), Ruby_Format_TypeError( "", "size_t","expand_all_threaded_and_merge", 8, argv[6] ));
   } 
-  arg3 = static_cast< size_t >(val3);
-  res4 = SWIG_ConvertPtr(argv[3], &argp4, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t,  0 );
-  if (!SWIG_IsOK(res4)) {
-    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t &","twenty48::merge_states", 4, argv[3] )); 
+  arg8 = static_cast< size_t >(val8);
+  res9 = SWIG_ConvertPtr(argv[7], &argp9, SWIGTYPE_p_std__vectorT_twenty48__vbyte_index_entry_t_std__allocatorT_twenty48__vbyte_index_entry_t_t_t,  0 );
+  if (!SWIG_IsOK(res9)) {
+    SWIG_exception_fail(SWIG_ArgError(res9), Ruby_Format_TypeError( "", "twenty48::vbyte_index_t &","expand_all_threaded_and_merge", 9, argv[7] )); 
   }
-  if (!argp4) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t &","twenty48::merge_states", 4, argv[3])); 
+  if (!argp9) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_index_t &","expand_all_threaded_and_merge", 9, argv[7])); 
   }
-  arg4 = reinterpret_cast< twenty48::vbyte_index_t * >(argp4);
-  result = twenty48::merge_states((std::vector< std::string,std::allocator< std::string > > const &)*arg1,(char const *)arg2,arg3,*arg4);
+  arg9 = reinterpret_cast< twenty48::vbyte_index_t * >(argp9);
+  result = (arg1)->expand_all_threaded_and_merge((char const *)arg2,(twenty48::vbyte_index_t const &)*arg3,arg4,arg5,(std::vector< std::string,std::allocator< std::string > > const &)*arg6,(char const *)arg7,arg8,*arg9);
   vresult = SWIG_From_size_t(static_cast< size_t >(result));
-  if (SWIG_IsNewObj(res1)) delete arg1;
   if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res6)) delete arg6;
+  if (alloc7 == SWIG_NEWOBJ) delete[] buf7;
   return vresult;
 fail:
-  if (SWIG_IsNewObj(res1)) delete arg1;
   if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res6)) delete arg6;
+  if (alloc7 == SWIG_NEWOBJ) delete[] buf7;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_merge_state_probabilities(int argc, VALUE *argv, VALUE self) {
-  std::vector< std::string,std::allocator< std::string > > *arg1 = 0 ;
-  char *arg2 = (char *) 0 ;
-  int res1 = SWIG_OLDOBJ ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
-  size_t result;
-  VALUE vresult = Qnil;
+_wrap_LayerBuilder4_expand_with_policy(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *) 0 ;
+  twenty48::vbyte_reader_t *arg2 = 0 ;
+  twenty48::policy_reader_t *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
   
   if ((argc < 2) || (argc > 2)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  {
-    std::vector< std::string,std::allocator< std::string > > *ptr = (std::vector< std::string,std::allocator< std::string > > *)0;
-    res1 = swig::asptr(argv[0], &ptr);
-    if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_state_probabilities", 1, argv[0] )); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< std::string,std::allocator< std::string > > const &","twenty48::merge_state_probabilities", 1, argv[0])); 
-    }
-    arg1 = ptr;
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_4_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 4 > *","expand_with_policy", 1, self )); 
   }
-  res2 = SWIG_AsCharPtrAndSize(argv[1], &buf2, NULL, &alloc2);
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 4 > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","twenty48::merge_state_probabilities", 2, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0] )); 
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  result = twenty48::merge_state_probabilities((std::vector< std::string,std::allocator< std::string > > const &)*arg1,(char const *)arg2);
-  vresult = SWIG_From_size_t(static_cast< size_t >(result));
-  if (SWIG_IsNewObj(res1)) delete arg1;
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  return vresult;
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy", 3, argv[1])); 
+  }
+  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
+  (arg1)->expand_with_policy(*arg2,*arg3);
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_LayerBuilder4_expand_with_policy_and_alternate_actions(int argc, VALUE *argv, VALUE self) {
+  twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *) 0 ;
+  twenty48::vbyte_reader_t *arg2 = 0 ;
+  twenty48::policy_reader_t *arg3 = 0 ;
+  twenty48::alternate_action_reader_t *arg4 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  void *argp4 = 0 ;
+  int res4 = 0 ;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_twenty48__layer_builder_tT_4_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "twenty48::layer_builder_t< 4 > *","expand_with_policy_and_alternate_actions", 1, self )); 
+  }
+  arg1 = reinterpret_cast< twenty48::layer_builder_t< 4 > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_twenty48__vbyte_reader_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::vbyte_reader_t &","expand_with_policy_and_alternate_actions", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< twenty48::vbyte_reader_t * >(argp2);
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_twenty48__policy_reader_t,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::policy_reader_t &","expand_with_policy_and_alternate_actions", 3, argv[1])); 
+  }
+  arg3 = reinterpret_cast< twenty48::policy_reader_t * >(argp3);
+  res4 = SWIG_ConvertPtr(argv[2], &argp4, SWIGTYPE_p_twenty48__alternate_action_reader_t,  0 );
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2] )); 
+  }
+  if (!argp4) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "twenty48::alternate_action_reader_t &","expand_with_policy_and_alternate_actions", 4, argv[2])); 
+  }
+  arg4 = reinterpret_cast< twenty48::alternate_action_reader_t * >(argp4);
+  (arg1)->expand_with_policy_and_alternate_actions(*arg2,*arg3,*arg4);
+  return Qnil;
 fail:
-  if (SWIG_IsNewObj(res1)) delete arg1;
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return Qnil;
 }
 
 
+SWIGINTERN void
+free_twenty48_layer_builder_t_Sl_4_Sg_(void *self) {
+    twenty48::layer_builder_t< 4 > *arg1 = (twenty48::layer_builder_t< 4 > *)self;
+    delete arg1;
+}
+
 static swig_class SwigClassLayerSolver2;
 
 SWIGINTERN VALUE
@@ -43520,7 +47369,9 @@ SWIGEXPORT void Init_twenty48(void) {
   rb_define_method(SwigClassLine2.klass, "has_adjacent_pair", VALUEFUNC(_wrap_Line2_has_adjacent_pair), -1);
   rb_define_method(SwigClassLine2.klass, "get_nybbles", VALUEFUNC(_wrap_Line2_get_nybbles), -1);
   rb_define_method(SwigClassLine2.klass, "to_a", VALUEFUNC(_wrap_Line2_to_a), -1);
+  rb_define_method(SwigClassLine2.klass, "reverse", VALUEFUNC(_wrap_Line2_reverse), -1);
   rb_define_singleton_method(SwigClassLine2.klass, "lookup_move", VALUEFUNC(_wrap_Line2_lookup_move), -1);
+  rb_define_singleton_method(SwigClassLine2.klass, "lookup_reverse_move", VALUEFUNC(_wrap_Line2_lookup_reverse_move), -1);
   rb_define_singleton_method(SwigClassLine2.klass, "get_nybble", VALUEFUNC(_wrap_Line2_get_nybble), -1);
   rb_define_singleton_method(SwigClassLine2.klass, "set_nybble", VALUEFUNC(_wrap_Line2_set_nybble), -1);
   rb_define_method(SwigClassLine2.klass, "[]", VALUEFUNC(_wrap_Line2___getitem__), -1);
@@ -43538,7 +47389,9 @@ SWIGEXPORT void Init_twenty48(void) {
   rb_define_method(SwigClassLine3.klass, "has_adjacent_pair", VALUEFUNC(_wrap_Line3_has_adjacent_pair), -1);
   rb_define_method(SwigClassLine3.klass, "get_nybbles", VALUEFUNC(_wrap_Line3_get_nybbles), -1);
   rb_define_method(SwigClassLine3.klass, "to_a", VALUEFUNC(_wrap_Line3_to_a), -1);
+  rb_define_method(SwigClassLine3.klass, "reverse", VALUEFUNC(_wrap_Line3_reverse), -1);
   rb_define_singleton_method(SwigClassLine3.klass, "lookup_move", VALUEFUNC(_wrap_Line3_lookup_move), -1);
+  rb_define_singleton_method(SwigClassLine3.klass, "lookup_reverse_move", VALUEFUNC(_wrap_Line3_lookup_reverse_move), -1);
   rb_define_singleton_method(SwigClassLine3.klass, "get_nybble", VALUEFUNC(_wrap_Line3_get_nybble), -1);
   rb_define_singleton_method(SwigClassLine3.klass, "set_nybble", VALUEFUNC(_wrap_Line3_set_nybble), -1);
   rb_define_method(SwigClassLine3.klass, "[]", VALUEFUNC(_wrap_Line3___getitem__), -1);
@@ -43556,7 +47409,9 @@ SWIGEXPORT void Init_twenty48(void) {
   rb_define_method(SwigClassLine4.klass, "has_adjacent_pair", VALUEFUNC(_wrap_Line4_has_adjacent_pair), -1);
   rb_define_method(SwigClassLine4.klass, "get_nybbles", VALUEFUNC(_wrap_Line4_get_nybbles), -1);
   rb_define_method(SwigClassLine4.klass, "to_a", VALUEFUNC(_wrap_Line4_to_a), -1);
+  rb_define_method(SwigClassLine4.klass, "reverse", VALUEFUNC(_wrap_Line4_reverse), -1);
   rb_define_singleton_method(SwigClassLine4.klass, "lookup_move", VALUEFUNC(_wrap_Line4_lookup_move), -1);
+  rb_define_singleton_method(SwigClassLine4.klass, "lookup_reverse_move", VALUEFUNC(_wrap_Line4_lookup_reverse_move), -1);
   rb_define_singleton_method(SwigClassLine4.klass, "get_nybble", VALUEFUNC(_wrap_Line4_get_nybble), -1);
   rb_define_singleton_method(SwigClassLine4.klass, "set_nybble", VALUEFUNC(_wrap_Line4_set_nybble), -1);
   rb_define_method(SwigClassLine4.klass, "[]", VALUEFUNC(_wrap_Line4___getitem__), -1);
@@ -43618,6 +47473,8 @@ SWIGEXPORT void Init_twenty48(void) {
   rb_define_method(SwigClassState2.klass, "initialize", VALUEFUNC(_wrap_new_State2), -1);
   rb_define_method(SwigClassState2.klass, "get_nybbles", VALUEFUNC(_wrap_State2_get_nybbles), -1);
   rb_define_method(SwigClassState2.klass, "lose", VALUEFUNC(_wrap_State2_lose), -1);
+  rb_define_method(SwigClassState2.klass, "can_move", VALUEFUNC(_wrap_State2_can_move), -1);
+  rb_define_method(SwigClassState2.klass, "legal_moves", VALUEFUNC(_wrap_State2_legal_moves), -1);
   rb_define_method(SwigClassState2.klass, "max_value", VALUEFUNC(_wrap_State2_max_value), -1);
   rb_define_method(SwigClassState2.klass, "cells_available", VALUEFUNC(_wrap_State2_cells_available), -1);
   rb_define_method(SwigClassState2.klass, "sum", VALUEFUNC(_wrap_State2_sum), -1);
@@ -43631,6 +47488,7 @@ SWIGEXPORT void Init_twenty48(void) {
   rb_define_method(SwigClassState2.klass, "new_state_with_tile", VALUEFUNC(_wrap_State2_new_state_with_tile), -1);
   rb_define_method(SwigClassState2.klass, "place", VALUEFUNC(_wrap_State2_place), -1);
   rb_define_method(SwigClassState2.klass, "has_adjacent_pair", VALUEFUNC(_wrap_State2_has_adjacent_pair), -1);
+  rb_define_method(SwigClassState2.klass, "adjacent_pairs", VALUEFUNC(_wrap_State2_adjacent_pairs), -1);
   rb_define_method(SwigClassState2.klass, "==", VALUEFUNC(_wrap_State2___eq__), -1);
   rb_define_method(SwigClassState2.klass, "<", VALUEFUNC(_wrap_State2___lt__), -1);
   rb_define_singleton_method(SwigClassState2.klass, "read_bin", VALUEFUNC(_wrap_State2_read_bin), -1);
@@ -43648,6 +47506,8 @@ SWIGEXPORT void Init_twenty48(void) {
   rb_define_method(SwigClassState3.klass, "initialize", VALUEFUNC(_wrap_new_State3), -1);
   rb_define_method(SwigClassState3.klass, "get_nybbles", VALUEFUNC(_wrap_State3_get_nybbles), -1);
   rb_define_method(SwigClassState3.klass, "lose", VALUEFUNC(_wrap_State3_lose), -1);
+  rb_define_method(SwigClassState3.klass, "can_move", VALUEFUNC(_wrap_State3_can_move), -1);
+  rb_define_method(SwigClassState3.klass, "legal_moves", VALUEFUNC(_wrap_State3_legal_moves), -1);
   rb_define_method(SwigClassState3.klass, "max_value", VALUEFUNC(_wrap_State3_max_value), -1);
   rb_define_method(SwigClassState3.klass, "cells_available", VALUEFUNC(_wrap_State3_cells_available), -1);
   rb_define_method(SwigClassState3.klass, "sum", VALUEFUNC(_wrap_State3_sum), -1);
@@ -43661,6 +47521,7 @@ SWIGEXPORT void Init_twenty48(void) {
   rb_define_method(SwigClassState3.klass, "new_state_with_tile", VALUEFUNC(_wrap_State3_new_state_with_tile), -1);
   rb_define_method(SwigClassState3.klass, "place", VALUEFUNC(_wrap_State3_place), -1);
   rb_define_method(SwigClassState3.klass, "has_adjacent_pair", VALUEFUNC(_wrap_State3_has_adjacent_pair), -1);
+  rb_define_method(SwigClassState3.klass, "adjacent_pairs", VALUEFUNC(_wrap_State3_adjacent_pairs), -1);
   rb_define_method(SwigClassState3.klass, "==", VALUEFUNC(_wrap_State3___eq__), -1);
   rb_define_method(SwigClassState3.klass, "<", VALUEFUNC(_wrap_State3___lt__), -1);
   rb_define_singleton_method(SwigClassState3.klass, "read_bin", VALUEFUNC(_wrap_State3_read_bin), -1);
@@ -43678,6 +47539,8 @@ SWIGEXPORT void Init_twenty48(void) {
   rb_define_method(SwigClassState4.klass, "initialize", VALUEFUNC(_wrap_new_State4), -1);
   rb_define_method(SwigClassState4.klass, "get_nybbles", VALUEFUNC(_wrap_State4_get_nybbles), -1);
   rb_define_method(SwigClassState4.klass, "lose", VALUEFUNC(_wrap_State4_lose), -1);
+  rb_define_method(SwigClassState4.klass, "can_move", VALUEFUNC(_wrap_State4_can_move), -1);
+  rb_define_method(SwigClassState4.klass, "legal_moves", VALUEFUNC(_wrap_State4_legal_moves), -1);
   rb_define_method(SwigClassState4.klass, "max_value", VALUEFUNC(_wrap_State4_max_value), -1);
   rb_define_method(SwigClassState4.klass, "cells_available", VALUEFUNC(_wrap_State4_cells_available), -1);
   rb_define_method(SwigClassState4.klass, "sum", VALUEFUNC(_wrap_State4_sum), -1);
@@ -43691,6 +47554,7 @@ SWIGEXPORT void Init_twenty48(void) {
   rb_define_method(SwigClassState4.klass, "new_state_with_tile", VALUEFUNC(_wrap_State4_new_state_with_tile), -1);
   rb_define_method(SwigClassState4.klass, "place", VALUEFUNC(_wrap_State4_place), -1);
   rb_define_method(SwigClassState4.klass, "has_adjacent_pair", VALUEFUNC(_wrap_State4_has_adjacent_pair), -1);
+  rb_define_method(SwigClassState4.klass, "adjacent_pairs", VALUEFUNC(_wrap_State4_adjacent_pairs), -1);
   rb_define_method(SwigClassState4.klass, "==", VALUEFUNC(_wrap_State4___eq__), -1);
   rb_define_method(SwigClassState4.klass, "<", VALUEFUNC(_wrap_State4___lt__), -1);
   rb_define_singleton_method(SwigClassState4.klass, "read_bin", VALUEFUNC(_wrap_State4_read_bin), -1);
@@ -43969,10 +47833,15 @@ SWIGEXPORT void Init_twenty48(void) {
   SwigClassValuer2.klass = rb_define_class_under(mTwenty48, "Valuer2", rb_cObject);
   SWIG_TypeClientData(SWIGTYPE_p_twenty48__valuer_tT_2_t, (void *) &SwigClassValuer2);
   rb_define_alloc_func(SwigClassValuer2.klass, _wrap_Valuer2_allocate);
+  rb_define_const(SwigClassValuer2.klass, "MAX_DEPTH", SWIG_From_int(static_cast< int >(twenty48::valuer_t< 2 >::MAX_DEPTH)));
   rb_define_method(SwigClassValuer2.klass, "initialize", VALUEFUNC(_wrap_new_Valuer2), -1);
   rb_define_method(SwigClassValuer2.klass, "get_max_exponent", VALUEFUNC(_wrap_Valuer2_get_max_exponent), -1);
   rb_define_method(SwigClassValuer2.klass, "get_max_depth", VALUEFUNC(_wrap_Valuer2_get_max_depth), -1);
   rb_define_method(SwigClassValuer2.klass, "get_discount", VALUEFUNC(_wrap_Valuer2_get_discount), -1);
+  rb_define_method(SwigClassValuer2.klass, "get_cache_size", VALUEFUNC(_wrap_Valuer2_get_cache_size), -1);
+  rb_define_method(SwigClassValuer2.klass, "get_cache_hits", VALUEFUNC(_wrap_Valuer2_get_cache_hits), -1);
+  rb_define_method(SwigClassValuer2.klass, "get_cache_misses", VALUEFUNC(_wrap_Valuer2_get_cache_misses), -1);
+  rb_define_method(SwigClassValuer2.klass, "clear_cache", VALUEFUNC(_wrap_Valuer2_clear_cache), -1);
   rb_define_method(SwigClassValuer2.klass, "value", VALUEFUNC(_wrap_Valuer2_value), -1);
   SwigClassValuer2.mark = 0;
   SwigClassValuer2.destroy = (void (*)(void *)) free_twenty48_valuer_t_Sl_2_Sg_;
@@ -43981,10 +47850,15 @@ SWIGEXPORT void Init_twenty48(void) {
   SwigClassValuer3.klass = rb_define_class_under(mTwenty48, "Valuer3", rb_cObject);
   SWIG_TypeClientData(SWIGTYPE_p_twenty48__valuer_tT_3_t, (void *) &SwigClassValuer3);
   rb_define_alloc_func(SwigClassValuer3.klass, _wrap_Valuer3_allocate);
+  rb_define_const(SwigClassValuer3.klass, "MAX_DEPTH", SWIG_From_int(static_cast< int >(twenty48::valuer_t< 3 >::MAX_DEPTH)));
   rb_define_method(SwigClassValuer3.klass, "initialize", VALUEFUNC(_wrap_new_Valuer3), -1);
   rb_define_method(SwigClassValuer3.klass, "get_max_exponent", VALUEFUNC(_wrap_Valuer3_get_max_exponent), -1);
   rb_define_method(SwigClassValuer3.klass, "get_max_depth", VALUEFUNC(_wrap_Valuer3_get_max_depth), -1);
   rb_define_method(SwigClassValuer3.klass, "get_discount", VALUEFUNC(_wrap_Valuer3_get_discount), -1);
+  rb_define_method(SwigClassValuer3.klass, "get_cache_size", VALUEFUNC(_wrap_Valuer3_get_cache_size), -1);
+  rb_define_method(SwigClassValuer3.klass, "get_cache_hits", VALUEFUNC(_wrap_Valuer3_get_cache_hits), -1);
+  rb_define_method(SwigClassValuer3.klass, "get_cache_misses", VALUEFUNC(_wrap_Valuer3_get_cache_misses), -1);
+  rb_define_method(SwigClassValuer3.klass, "clear_cache", VALUEFUNC(_wrap_Valuer3_clear_cache), -1);
   rb_define_method(SwigClassValuer3.klass, "value", VALUEFUNC(_wrap_Valuer3_value), -1);
   SwigClassValuer3.mark = 0;
   SwigClassValuer3.destroy = (void (*)(void *)) free_twenty48_valuer_t_Sl_3_Sg_;
@@ -43993,96 +47867,20 @@ SWIGEXPORT void Init_twenty48(void) {
   SwigClassValuer4.klass = rb_define_class_under(mTwenty48, "Valuer4", rb_cObject);
   SWIG_TypeClientData(SWIGTYPE_p_twenty48__valuer_tT_4_t, (void *) &SwigClassValuer4);
   rb_define_alloc_func(SwigClassValuer4.klass, _wrap_Valuer4_allocate);
+  rb_define_const(SwigClassValuer4.klass, "MAX_DEPTH", SWIG_From_int(static_cast< int >(twenty48::valuer_t< 4 >::MAX_DEPTH)));
   rb_define_method(SwigClassValuer4.klass, "initialize", VALUEFUNC(_wrap_new_Valuer4), -1);
   rb_define_method(SwigClassValuer4.klass, "get_max_exponent", VALUEFUNC(_wrap_Valuer4_get_max_exponent), -1);
   rb_define_method(SwigClassValuer4.klass, "get_max_depth", VALUEFUNC(_wrap_Valuer4_get_max_depth), -1);
   rb_define_method(SwigClassValuer4.klass, "get_discount", VALUEFUNC(_wrap_Valuer4_get_discount), -1);
+  rb_define_method(SwigClassValuer4.klass, "get_cache_size", VALUEFUNC(_wrap_Valuer4_get_cache_size), -1);
+  rb_define_method(SwigClassValuer4.klass, "get_cache_hits", VALUEFUNC(_wrap_Valuer4_get_cache_hits), -1);
+  rb_define_method(SwigClassValuer4.klass, "get_cache_misses", VALUEFUNC(_wrap_Valuer4_get_cache_misses), -1);
+  rb_define_method(SwigClassValuer4.klass, "clear_cache", VALUEFUNC(_wrap_Valuer4_clear_cache), -1);
   rb_define_method(SwigClassValuer4.klass, "value", VALUEFUNC(_wrap_Valuer4_value), -1);
   SwigClassValuer4.mark = 0;
   SwigClassValuer4.destroy = (void (*)(void *)) free_twenty48_valuer_t_Sl_4_Sg_;
   SwigClassValuer4.trackObjects = 0;
   
-  SwigClassLayerBuilder2.klass = rb_define_class_under(mTwenty48, "LayerBuilder2", rb_cObject);
-  SWIG_TypeClientData(SWIGTYPE_p_twenty48__layer_builder_tT_2_t, (void *) &SwigClassLayerBuilder2);
-  rb_define_alloc_func(SwigClassLayerBuilder2.klass, _wrap_LayerBuilder2_allocate);
-  rb_define_method(SwigClassLayerBuilder2.klass, "initialize", VALUEFUNC(_wrap_new_LayerBuilder2), -1);
-  rb_define_method(SwigClassLayerBuilder2.klass, "expand_all", VALUEFUNC(_wrap_LayerBuilder2_expand_all), -1);
-  rb_define_method(SwigClassLayerBuilder2.klass, "expand_with_policy", VALUEFUNC(_wrap_LayerBuilder2_expand_with_policy), -1);
-  rb_define_method(SwigClassLayerBuilder2.klass, "expand_with_policy_and_alternate_actions", VALUEFUNC(_wrap_LayerBuilder2_expand_with_policy_and_alternate_actions), -1);
-  SwigClassLayerBuilder2.mark = 0;
-  SwigClassLayerBuilder2.destroy = (void (*)(void *)) free_twenty48_layer_builder_t_Sl_2_Sg_;
-  SwigClassLayerBuilder2.trackObjects = 0;
-  
-  SwigClassLayerBuilder3.klass = rb_define_class_under(mTwenty48, "LayerBuilder3", rb_cObject);
-  SWIG_TypeClientData(SWIGTYPE_p_twenty48__layer_builder_tT_3_t, (void *) &SwigClassLayerBuilder3);
-  rb_define_alloc_func(SwigClassLayerBuilder3.klass, _wrap_LayerBuilder3_allocate);
-  rb_define_method(SwigClassLayerBuilder3.klass, "initialize", VALUEFUNC(_wrap_new_LayerBuilder3), -1);
-  rb_define_method(SwigClassLayerBuilder3.klass, "expand_all", VALUEFUNC(_wrap_LayerBuilder3_expand_all), -1);
-  rb_define_method(SwigClassLayerBuilder3.klass, "expand_with_policy", VALUEFUNC(_wrap_LayerBuilder3_expand_with_policy), -1);
-  rb_define_method(SwigClassLayerBuilder3.klass, "expand_with_policy_and_alternate_actions", VALUEFUNC(_wrap_LayerBuilder3_expand_with_policy_and_alternate_actions), -1);
-  SwigClassLayerBuilder3.mark = 0;
-  SwigClassLayerBuilder3.destroy = (void (*)(void *)) free_twenty48_layer_builder_t_Sl_3_Sg_;
-  SwigClassLayerBuilder3.trackObjects = 0;
-  
-  SwigClassLayerBuilder4.klass = rb_define_class_under(mTwenty48, "LayerBuilder4", rb_cObject);
-  SWIG_TypeClientData(SWIGTYPE_p_twenty48__layer_builder_tT_4_t, (void *) &SwigClassLayerBuilder4);
-  rb_define_alloc_func(SwigClassLayerBuilder4.klass, _wrap_LayerBuilder4_allocate);
-  rb_define_method(SwigClassLayerBuilder4.klass, "initialize", VALUEFUNC(_wrap_new_LayerBuilder4), -1);
-  rb_define_method(SwigClassLayerBuilder4.klass, "expand_all", VALUEFUNC(_wrap_LayerBuilder4_expand_all), -1);
-  rb_define_method(SwigClassLayerBuilder4.klass, "expand_with_policy", VALUEFUNC(_wrap_LayerBuilder4_expand_with_policy), -1);
-  rb_define_method(SwigClassLayerBuilder4.klass, "expand_with_policy_and_alternate_actions", VALUEFUNC(_wrap_LayerBuilder4_expand_with_policy_and_alternate_actions), -1);
-  SwigClassLayerBuilder4.mark = 0;
-  SwigClassLayerBuilder4.destroy = (void (*)(void *)) free_twenty48_layer_builder_t_Sl_4_Sg_;
-  SwigClassLayerBuilder4.trackObjects = 0;
-  
-  SwigClassStringVector.klass = rb_define_class_under(mTwenty48, "StringVector", rb_cObject);
-  SWIG_TypeClientData(SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, (void *) &SwigClassStringVector);
-  rb_include_module(SwigClassStringVector.klass, rb_eval_string("Enumerable"));
-  rb_define_alloc_func(SwigClassStringVector.klass, _wrap_StringVector_allocate);
-  rb_define_method(SwigClassStringVector.klass, "initialize", VALUEFUNC(_wrap_new_StringVector), -1);
-  rb_define_method(SwigClassStringVector.klass, "dup", VALUEFUNC(_wrap_StringVector_dup), -1);
-  rb_define_method(SwigClassStringVector.klass, "inspect", VALUEFUNC(_wrap_StringVector_inspect), -1);
-  rb_define_method(SwigClassStringVector.klass, "to_a", VALUEFUNC(_wrap_StringVector_to_a), -1);
-  rb_define_method(SwigClassStringVector.klass, "to_s", VALUEFUNC(_wrap_StringVector_to_s), -1);
-  rb_define_method(SwigClassStringVector.klass, "slice", VALUEFUNC(_wrap_StringVector_slice), -1);
-  rb_define_method(SwigClassStringVector.klass, "each", VALUEFUNC(_wrap_StringVector_each), -1);
-  rb_define_method(SwigClassStringVector.klass, "__delete2__", VALUEFUNC(_wrap_StringVector___delete2__), -1);
-  rb_define_method(SwigClassStringVector.klass, "select", VALUEFUNC(_wrap_StringVector_select), -1);
-  rb_define_method(SwigClassStringVector.klass, "delete_at", VALUEFUNC(_wrap_StringVector_delete_at), -1);
-  rb_define_method(SwigClassStringVector.klass, "at", VALUEFUNC(_wrap_StringVector_at), -1);
-  rb_define_method(SwigClassStringVector.klass, "[]", VALUEFUNC(_wrap_StringVector___getitem__), -1);
-  rb_define_method(SwigClassStringVector.klass, "[]=", VALUEFUNC(_wrap_StringVector___setitem__), -1);
-  rb_define_method(SwigClassStringVector.klass, "reject!", VALUEFUNC(_wrap_StringVector_rejectN___), -1);
-  rb_define_alias(SwigClassStringVector.klass, "delete_if", "reject!");
-  rb_define_method(SwigClassStringVector.klass, "pop", VALUEFUNC(_wrap_StringVector_pop), -1);
-  rb_define_method(SwigClassStringVector.klass, "push", VALUEFUNC(_wrap_StringVector_push), -1);
-  rb_define_alias(SwigClassStringVector.klass, "<<", "push");
-  rb_define_method(SwigClassStringVector.klass, "reject", VALUEFUNC(_wrap_StringVector_reject), -1);
-  rb_define_method(SwigClassStringVector.klass, "shift", VALUEFUNC(_wrap_StringVector_shift), -1);
-  rb_define_method(SwigClassStringVector.klass, "unshift", VALUEFUNC(_wrap_StringVector_unshift), -1);
-  rb_define_method(SwigClassStringVector.klass, "empty?", VALUEFUNC(_wrap_StringVector_emptyq___), -1);
-  rb_define_method(SwigClassStringVector.klass, "size", VALUEFUNC(_wrap_StringVector_size), -1);
-  rb_define_method(SwigClassStringVector.klass, "swap", VALUEFUNC(_wrap_StringVector_swap), -1);
-  rb_define_method(SwigClassStringVector.klass, "begin", VALUEFUNC(_wrap_StringVector_begin), -1);
-  rb_define_method(SwigClassStringVector.klass, "end", VALUEFUNC(_wrap_StringVector_end), -1);
-  rb_define_method(SwigClassStringVector.klass, "rbegin", VALUEFUNC(_wrap_StringVector_rbegin), -1);
-  rb_define_method(SwigClassStringVector.klass, "rend", VALUEFUNC(_wrap_StringVector_rend), -1);
-  rb_define_method(SwigClassStringVector.klass, "clear", VALUEFUNC(_wrap_StringVector_clear), -1);
-  rb_define_method(SwigClassStringVector.klass, "get_allocator", VALUEFUNC(_wrap_StringVector_get_allocator), -1);
-  rb_define_method(SwigClassStringVector.klass, "erase", VALUEFUNC(_wrap_StringVector_erase), -1);
-  rb_define_method(SwigClassStringVector.klass, "front", VALUEFUNC(_wrap_StringVector_front), -1);
-  rb_define_method(SwigClassStringVector.klass, "back", VALUEFUNC(_wrap_StringVector_back), -1);
-  rb_define_method(SwigClassStringVector.klass, "assign", VALUEFUNC(_wrap_StringVector_assign), -1);
-  rb_define_method(SwigClassStringVector.klass, "resize", VALUEFUNC(_wrap_StringVector_resize), -1);
-  rb_define_method(SwigClassStringVector.klass, "insert", VALUEFUNC(_wrap_StringVector_insert), -1);
-  rb_define_method(SwigClassStringVector.klass, "reserve", VALUEFUNC(_wrap_StringVector_reserve), -1);
-  rb_define_method(SwigClassStringVector.klass, "capacity", VALUEFUNC(_wrap_StringVector_capacity), -1);
-  rb_define_method(SwigClassStringVector.klass, "map_bang", VALUEFUNC(_wrap_StringVector_map_bang), -1);
-  rb_define_method(SwigClassStringVector.klass, "__delete__", VALUEFUNC(_wrap_StringVector___delete__), -1);
-  SwigClassStringVector.mark = 0;
-  SwigClassStringVector.destroy = (void (*)(void *)) free_std_vector_Sl_std_string_Sg_;
-  SwigClassStringVector.trackObjects = 0;
-  
   SwigClassVByteIndexEntry.klass = rb_define_class_under(mTwenty48, "VByteIndexEntry", rb_cObject);
   SWIG_TypeClientData(SWIGTYPE_p_twenty48__vbyte_index_entry_t, (void *) &SwigClassVByteIndexEntry);
   rb_define_alloc_func(SwigClassVByteIndexEntry.klass, _wrap_VByteIndexEntry_allocate);
@@ -44144,7 +47942,9 @@ SWIGEXPORT void Init_twenty48(void) {
   SwigClassVByteReader.klass = rb_define_class_under(mTwenty48, "VByteReader", rb_cObject);
   SWIG_TypeClientData(SWIGTYPE_p_twenty48__vbyte_reader_t, (void *) &SwigClassVByteReader);
   rb_define_alloc_func(SwigClassVByteReader.klass, _wrap_VByteReader_allocate);
+  rb_define_const(SwigClassVByteReader.klass, "DEFAULT_BUFFER_SIZE", SWIG_From_size_t(static_cast< size_t >(twenty48::vbyte_reader_t::DEFAULT_BUFFER_SIZE)));
   rb_define_method(SwigClassVByteReader.klass, "initialize", VALUEFUNC(_wrap_new_VByteReader), -1);
+  rb_define_method(SwigClassVByteReader.klass, "is_open", VALUEFUNC(_wrap_VByteReader_is_open), -1);
   rb_define_method(SwigClassVByteReader.klass, "read", VALUEFUNC(_wrap_VByteReader_read), -1);
   rb_define_method(SwigClassVByteReader.klass, "close", VALUEFUNC(_wrap_VByteReader_close), -1);
   SwigClassVByteReader.mark = 0;
@@ -44162,8 +47962,106 @@ SWIGEXPORT void Init_twenty48(void) {
   SwigClassVByteWriter.mark = 0;
   SwigClassVByteWriter.destroy = (void (*)(void *)) free_twenty48_vbyte_writer_t;
   SwigClassVByteWriter.trackObjects = 0;
+  SwigClassStringVector.klass = rb_define_class_under(mTwenty48, "StringVector", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t, (void *) &SwigClassStringVector);
+  rb_include_module(SwigClassStringVector.klass, rb_eval_string("Enumerable"));
+  rb_define_alloc_func(SwigClassStringVector.klass, _wrap_StringVector_allocate);
+  rb_define_method(SwigClassStringVector.klass, "initialize", VALUEFUNC(_wrap_new_StringVector), -1);
+  rb_define_method(SwigClassStringVector.klass, "dup", VALUEFUNC(_wrap_StringVector_dup), -1);
+  rb_define_method(SwigClassStringVector.klass, "inspect", VALUEFUNC(_wrap_StringVector_inspect), -1);
+  rb_define_method(SwigClassStringVector.klass, "to_a", VALUEFUNC(_wrap_StringVector_to_a), -1);
+  rb_define_method(SwigClassStringVector.klass, "to_s", VALUEFUNC(_wrap_StringVector_to_s), -1);
+  rb_define_method(SwigClassStringVector.klass, "slice", VALUEFUNC(_wrap_StringVector_slice), -1);
+  rb_define_method(SwigClassStringVector.klass, "each", VALUEFUNC(_wrap_StringVector_each), -1);
+  rb_define_method(SwigClassStringVector.klass, "__delete2__", VALUEFUNC(_wrap_StringVector___delete2__), -1);
+  rb_define_method(SwigClassStringVector.klass, "select", VALUEFUNC(_wrap_StringVector_select), -1);
+  rb_define_method(SwigClassStringVector.klass, "delete_at", VALUEFUNC(_wrap_StringVector_delete_at), -1);
+  rb_define_method(SwigClassStringVector.klass, "at", VALUEFUNC(_wrap_StringVector_at), -1);
+  rb_define_method(SwigClassStringVector.klass, "[]", VALUEFUNC(_wrap_StringVector___getitem__), -1);
+  rb_define_method(SwigClassStringVector.klass, "[]=", VALUEFUNC(_wrap_StringVector___setitem__), -1);
+  rb_define_method(SwigClassStringVector.klass, "reject!", VALUEFUNC(_wrap_StringVector_rejectN___), -1);
+  rb_define_alias(SwigClassStringVector.klass, "delete_if", "reject!");
+  rb_define_method(SwigClassStringVector.klass, "pop", VALUEFUNC(_wrap_StringVector_pop), -1);
+  rb_define_method(SwigClassStringVector.klass, "push", VALUEFUNC(_wrap_StringVector_push), -1);
+  rb_define_alias(SwigClassStringVector.klass, "<<", "push");
+  rb_define_method(SwigClassStringVector.klass, "reject", VALUEFUNC(_wrap_StringVector_reject), -1);
+  rb_define_method(SwigClassStringVector.klass, "shift", VALUEFUNC(_wrap_StringVector_shift), -1);
+  rb_define_method(SwigClassStringVector.klass, "unshift", VALUEFUNC(_wrap_StringVector_unshift), -1);
+  rb_define_method(SwigClassStringVector.klass, "empty?", VALUEFUNC(_wrap_StringVector_emptyq___), -1);
+  rb_define_method(SwigClassStringVector.klass, "size", VALUEFUNC(_wrap_StringVector_size), -1);
+  rb_define_method(SwigClassStringVector.klass, "swap", VALUEFUNC(_wrap_StringVector_swap), -1);
+  rb_define_method(SwigClassStringVector.klass, "begin", VALUEFUNC(_wrap_StringVector_begin), -1);
+  rb_define_method(SwigClassStringVector.klass, "end", VALUEFUNC(_wrap_StringVector_end), -1);
+  rb_define_method(SwigClassStringVector.klass, "rbegin", VALUEFUNC(_wrap_StringVector_rbegin), -1);
+  rb_define_method(SwigClassStringVector.klass, "rend", VALUEFUNC(_wrap_StringVector_rend), -1);
+  rb_define_method(SwigClassStringVector.klass, "clear", VALUEFUNC(_wrap_StringVector_clear), -1);
+  rb_define_method(SwigClassStringVector.klass, "get_allocator", VALUEFUNC(_wrap_StringVector_get_allocator), -1);
+  rb_define_method(SwigClassStringVector.klass, "erase", VALUEFUNC(_wrap_StringVector_erase), -1);
+  rb_define_method(SwigClassStringVector.klass, "front", VALUEFUNC(_wrap_StringVector_front), -1);
+  rb_define_method(SwigClassStringVector.klass, "back", VALUEFUNC(_wrap_StringVector_back), -1);
+  rb_define_method(SwigClassStringVector.klass, "assign", VALUEFUNC(_wrap_StringVector_assign), -1);
+  rb_define_method(SwigClassStringVector.klass, "resize", VALUEFUNC(_wrap_StringVector_resize), -1);
+  rb_define_method(SwigClassStringVector.klass, "insert", VALUEFUNC(_wrap_StringVector_insert), -1);
+  rb_define_method(SwigClassStringVector.klass, "reserve", VALUEFUNC(_wrap_StringVector_reserve), -1);
+  rb_define_method(SwigClassStringVector.klass, "capacity", VALUEFUNC(_wrap_StringVector_capacity), -1);
+  rb_define_method(SwigClassStringVector.klass, "map_bang", VALUEFUNC(_wrap_StringVector_map_bang), -1);
+  rb_define_method(SwigClassStringVector.klass, "__delete__", VALUEFUNC(_wrap_StringVector___delete__), -1);
+  SwigClassStringVector.mark = 0;
+  SwigClassStringVector.destroy = (void (*)(void *)) free_std_vector_Sl_std_string_Sg_;
+  SwigClassStringVector.trackObjects = 0;
+  
   rb_define_module_function(mTwenty48, "merge_states", VALUEFUNC(_wrap_merge_states), -1);
   rb_define_module_function(mTwenty48, "merge_state_probabilities", VALUEFUNC(_wrap_merge_state_probabilities), -1);
+  rb_define_module_function(mTwenty48, "write_batch_checkpoint", VALUEFUNC(_wrap_write_batch_checkpoint), -1);
+  rb_define_module_function(mTwenty48, "check_batch_checkpoint", VALUEFUNC(_wrap_check_batch_checkpoint), -1);
+  
+  SwigClassLayerBuilder2.klass = rb_define_class_under(mTwenty48, "LayerBuilder2", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_twenty48__layer_builder_tT_2_t, (void *) &SwigClassLayerBuilder2);
+  rb_define_alloc_func(SwigClassLayerBuilder2.klass, _wrap_LayerBuilder2_allocate);
+  rb_define_method(SwigClassLayerBuilder2.klass, "initialize", VALUEFUNC(_wrap_new_LayerBuilder2), -1);
+  rb_define_singleton_method(SwigClassLayerBuilder2.klass, "spill_pathname", VALUEFUNC(_wrap_LayerBuilder2_spill_pathname), -1);
+  rb_define_method(SwigClassLayerBuilder2.klass, "get_num_filter_lookups", VALUEFUNC(_wrap_LayerBuilder2_get_num_filter_lookups), -1);
+  rb_define_method(SwigClassLayerBuilder2.klass, "get_num_filter_hits", VALUEFUNC(_wrap_LayerBuilder2_get_num_filter_hits), -1);
+  rb_define_method(SwigClassLayerBuilder2.klass, "expand_all", VALUEFUNC(_wrap_LayerBuilder2_expand_all), -1);
+  rb_define_method(SwigClassLayerBuilder2.klass, "expand_all_threaded", VALUEFUNC(_wrap_LayerBuilder2_expand_all_threaded), -1);
+  rb_define_method(SwigClassLayerBuilder2.klass, "expand_all_threaded_and_merge", VALUEFUNC(_wrap_LayerBuilder2_expand_all_threaded_and_merge), -1);
+  rb_define_method(SwigClassLayerBuilder2.klass, "expand_with_policy", VALUEFUNC(_wrap_LayerBuilder2_expand_with_policy), -1);
+  rb_define_method(SwigClassLayerBuilder2.klass, "expand_with_policy_and_alternate_actions", VALUEFUNC(_wrap_LayerBuilder2_expand_with_policy_and_alternate_actions), -1);
+  SwigClassLayerBuilder2.mark = 0;
+  SwigClassLayerBuilder2.destroy = (void (*)(void *)) free_twenty48_layer_builder_t_Sl_2_Sg_;
+  SwigClassLayerBuilder2.trackObjects = 0;
+  
+  SwigClassLayerBuilder3.klass = rb_define_class_under(mTwenty48, "LayerBuilder3", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_twenty48__layer_builder_tT_3_t, (void *) &SwigClassLayerBuilder3);
+  rb_define_alloc_func(SwigClassLayerBuilder3.klass, _wrap_LayerBuilder3_allocate);
+  rb_define_method(SwigClassLayerBuilder3.klass, "initialize", VALUEFUNC(_wrap_new_LayerBuilder3), -1);
+  rb_define_singleton_method(SwigClassLayerBuilder3.klass, "spill_pathname", VALUEFUNC(_wrap_LayerBuilder3_spill_pathname), -1);
+  rb_define_method(SwigClassLayerBuilder3.klass, "get_num_filter_lookups", VALUEFUNC(_wrap_LayerBuilder3_get_num_filter_lookups), -1);
+  rb_define_method(SwigClassLayerBuilder3.klass, "get_num_filter_hits", VALUEFUNC(_wrap_LayerBuilder3_get_num_filter_hits), -1);
+  rb_define_method(SwigClassLayerBuilder3.klass, "expand_all", VALUEFUNC(_wrap_LayerBuilder3_expand_all), -1);
+  rb_define_method(SwigClassLayerBuilder3.klass, "expand_all_threaded", VALUEFUNC(_wrap_LayerBuilder3_expand_all_threaded), -1);
+  rb_define_method(SwigClassLayerBuilder3.klass, "expand_all_threaded_and_merge", VALUEFUNC(_wrap_LayerBuilder3_expand_all_threaded_and_merge), -1);
+  rb_define_method(SwigClassLayerBuilder3.klass, "expand_with_policy", VALUEFUNC(_wrap_LayerBuilder3_expand_with_policy), -1);
+  rb_define_method(SwigClassLayerBuilder3.klass, "expand_with_policy_and_alternate_actions", VALUEFUNC(_wrap_LayerBuilder3_expand_with_policy_and_alternate_actions), -1);
+  SwigClassLayerBuilder3.mark = 0;
+  SwigClassLayerBuilder3.destroy = (void (*)(void *)) free_twenty48_layer_builder_t_Sl_3_Sg_;
+  SwigClassLayerBuilder3.trackObjects = 0;
+  
+  SwigClassLayerBuilder4.klass = rb_define_class_under(mTwenty48, "LayerBuilder4", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_twenty48__layer_builder_tT_4_t, (void *) &SwigClassLayerBuilder4);
+  rb_define_alloc_func(SwigClassLayerBuilder4.klass, _wrap_LayerBuilder4_allocate);
+  rb_define_method(SwigClassLayerBuilder4.klass, "initialize", VALUEFUNC(_wrap_new_LayerBuilder4), -1);
+  rb_define_singleton_method(SwigClassLayerBuilder4.klass, "spill_pathname", VALUEFUNC(_wrap_LayerBuilder4_spill_pathname), -1);
+  rb_define_method(SwigClassLayerBuilder4.klass, "get_num_filter_lookups", VALUEFUNC(_wrap_LayerBuilder4_get_num_filter_lookups), -1);
+  rb_define_method(SwigClassLayerBuilder4.klass, "get_num_filter_hits", VALUEFUNC(_wrap_LayerBuilder4_get_num_filter_hits), -1);
+  rb_define_method(SwigClassLayerBuilder4.klass, "expand_all", VALUEFUNC(_wrap_LayerBuilder4_expand_all), -1);
+  rb_define_method(SwigClassLayerBuilder4.klass, "expand_all_threaded", VALUEFUNC(_wrap_LayerBuilder4_expand_all_threaded), -1);
+  rb_define_method(SwigClassLayerBuilder4.klass, "expand_all_threaded_and_merge", VALUEFUNC(_wrap_LayerBuilder4_expand_all_threaded_and_merge), -1);
+  rb_define_method(SwigClassLayerBuilder4.klass, "expand_with_policy", VALUEFUNC(_wrap_LayerBuilder4_expand_with_policy), -1);
+  rb_define_method(SwigClassLayerBuilder4.klass, "expand_with_policy_and_alternate_actions", VALUEFUNC(_wrap_LayerBuilder4_expand_with_policy_and_alternate_actions), -1);
+  SwigClassLayerBuilder4.mark = 0;
+  SwigClassLayerBuilder4.destroy = (void (*)(void *)) free_twenty48_layer_builder_t_Sl_4_Sg_;
+  SwigClassLayerBuilder4.trackObjects = 0;
   
   SwigClassLayerSolver2.klass = rb_define_class_under(mTwenty48, "LayerSolver2", rb_cObject);
   SWIG_TypeClientData(SWIGTYPE_p_twenty48__layer_solver_tT_2_t, (void *) &SwigClassLayerSolver2);
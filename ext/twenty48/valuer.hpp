@@ -1,22 +1,45 @@
 #ifndef TWENTY48_VALUER_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 #include "twenty48.hpp"
 #include "state.hpp"
 
 namespace twenty48 {
+  /**
+   * Value states that are resolved within `max_depth` moves: either a win, in
+   * which case the value is discounted by the number of moves needed, or a
+   * loss, in which case the value is zero. Otherwise the value is NaN.
+   *
+   * If `cache_size` is positive, the results of the search are memoized in a
+   * direct-mapped cache with (at least) that many entries. The cache is not
+   * shared between copies, and it is not thread safe, so each thread should
+   * have its own copy of the valuer.
+   */
   template <int size>
   struct valuer_t {
-    typedef typename state_t<size>::transitions_t transitions_t;
+    typedef uint64_t nybbles_t;
 
-    valuer_t(int max_exponent, int max_depth, double discount) :
-      max_exponent(max_exponent), max_depth(max_depth), discount(discount) {
-      if (max_depth < 0 || max_depth > 1) {
+    static const int MAX_DEPTH = 15;
+
+    valuer_t(int max_exponent, int max_depth, double discount,
+      size_t cache_size = 0) :
+      max_exponent(max_exponent), max_depth(max_depth), discount(discount),
+      cache_shift(64), cache_hits(0), cache_misses(0) {
+      if (max_depth < 0 || max_depth > MAX_DEPTH) {
         throw new std::invalid_argument("bad max_depth");
       }
+      if (cache_size > 0) {
+        size_t capacity = 2;
+        for (cache_shift = 63; capacity < cache_size; --cache_shift) {
+          capacity <<= 1;
+        }
+        cache.resize(capacity);
+      }
     }
 
     int get_max_exponent() const {
@@ -31,59 +54,216 @@ namespace twenty48 {
       return discount;
     }
 
+    size_t get_cache_size() const {
+      return cache.size();
+    }
+
+    size_t get_cache_hits() const {
+      return cache_hits;
+    }
+
+    size_t get_cache_misses() const {
+      return cache_misses;
+    }
+
+    void clear_cache() {
+      std::fill(cache.begin(), cache.end(), cache_entry_t());
+      cache_hits = 0;
+      cache_misses = 0;
+    }
+
     double value(const state_t<size> &state) const {
       int win_delta = max_exponent - state.max_value();
 
       // We have already won.
       if (win_delta <= 0) return 1.0;
 
-      // If we're searching one move ahead, see whether we're about to win.
-      if (win_delta == 1 && max_depth > 0) {
-        if (state.has_adjacent_pair(max_exponent - 1)) return discount;
-      }
-
-      // We can't lose unless the board is full, and the number of available
-      // cells can decrease by at most one per move, so if we have more cells
-      // available than moves within search depth, we can't lose.
-      if (state.cells_available() > max_depth) return nan("");
+      // The max value can increase by at most one per move, so we can't win
+      // if it is too far from the max exponent. We also can't lose unless the
+      // board is full, and the number of available cells can decrease by at
+      // most one per move, so if we have more cells available than moves
+      // within search depth, we can't lose. Most states need no search.
+      bool may_win = win_delta <= max_depth;
+      bool may_lose = state.cells_available() <= max_depth;
+      if (!may_win && !may_lose) return nan("");
 
-      // Check for a loss.
-      if (lose_within(state, max_depth)) return 0.0;
+      int result;
+      if (max_depth == 0) {
+        // The search is just a call to lose(), which is cheaper than a cache
+        // lookup.
+        result = state.lose() ? RESULT_LOSE : RESULT_UNKNOWN;
+      } else {
+        bool hit;
+        cache_entry_t *entry = lookup(state, TAG_VALUE, hit);
+        if (hit) {
+          result = entry->result;
+        } else {
+          result = search(state, win_delta, may_lose);
+          if (entry) store(entry, state, TAG_VALUE, result);
+        }
+      }
 
-      // Otherwise, we don't know.
-      return nan("");
+      if (result == RESULT_LOSE) return 0.0;
+      if (result == RESULT_UNKNOWN) return nan("");
+      return pow(discount, result);
     }
 
   private:
+    typedef typename state_t<size>::transition_array_t transitions_t;
+
+    // Search results: the number of moves to a win, or one of these.
+    enum {
+      RESULT_LOSE = -1,
+      RESULT_UNKNOWN = -2
+    };
+
+    // Cache entries are tagged with the kind of search and the depth. A zero
+    // tag marks an unused entry.
+    enum {
+      TAG_VALUE = 0x10,
+      TAG_WIN = 0x20,
+      TAG_LOSE = 0x30
+    };
+
+    struct cache_entry_t {
+      cache_entry_t() : nybbles(0), tag(0), result(0) { }
+      nybbles_t nybbles;
+      uint8_t tag;
+      int8_t result;
+    };
+
     int max_exponent;
     int max_depth;
     double discount;
 
-    bool lose_within(const state_t<size> &state, int moves) const {
-      return
-        lose_within_after_move(state, moves, DIRECTION_UP) &&
-        lose_within_after_move(state, moves, DIRECTION_DOWN) &&
-        lose_within_after_move(state, moves, DIRECTION_LEFT) &&
-        lose_within_after_move(state, moves, DIRECTION_RIGHT);
+    size_t cache_shift;
+    mutable std::vector<cache_entry_t> cache;
+    mutable size_t cache_hits;
+    mutable size_t cache_misses;
+
+    int search(const state_t<size> &state, int win_delta,
+      bool may_lose) const {
+      for (int moves = win_delta; moves <= max_depth; ++moves) {
+        if (win_within(state, moves)) return moves;
+      }
+      if (may_lose && lose_within(state, max_depth)) return RESULT_LOSE;
+      return RESULT_UNKNOWN;
+    }
+
+    /**
+     * Is there a policy that wins within the given number of moves, whatever
+     * tiles are placed?
+     */
+    bool win_within(const state_t<size> &state, int moves) const {
+      int win_delta = max_exponent - state.max_value();
+      if (win_delta <= 0) return true;
+      if (win_delta > moves) return false;
+
+      // With one move to go, we must merge two tiles to make the max exponent,
+      // which we can check without moving.
+      if (moves == 1) return state.has_adjacent_pair(max_exponent - 1);
+
+      bool hit;
+      cache_entry_t *entry = lookup(state, TAG_WIN | moves, hit);
+      if (hit) return entry->result;
+
+      state_t<size> moved_states[4];
+      bool moved[4];
+      state.move_all(moved_states, moved);
+
+      bool result = false;
+      for (size_t i = 0; i < 4 && !result; ++i) {
+        if (!moved[i]) continue;
+        result = win_within_after_move(moved_states[i], moves);
+      }
+
+      if (entry) store(entry, state, TAG_WIN | moves, result);
+      return result;
+    }
+
+    bool win_within_after_move(const state_t<size> &moved_state,
+      int moves) const {
+      transitions_t transitions;
+      moved_state.random_transitions(transitions);
+      for (typename transitions_t::const_iterator it = transitions.begin();
+        it != transitions.end(); ++it) {
+        if (!win_within(it->first, moves - 1)) return false;
+      }
+      return true;
     }
 
-    bool lose_within_after_move(const state_t<size> &state, int moves,
-      direction_t direction) const {
-      // If we cannot move in this direction, we may have lost.
-      state_t<size> moved_state = state.move(direction);
-      if (moved_state == state) return true;
+    /**
+     * Do we lose within the given number of moves, whatever we do?
+     */
+    bool lose_within(const state_t<size> &state, int moves) const {
+      // Once we have won, the game is over, even if the board is stuck.
+      if (state.max_value() >= max_exponent) return false;
+      if (state.cells_available() > moves) return false;
 
-      // If we can move in this direction and we've reached our search depth,
-      // we have not lost.
+      // This checks whether we can move at all, which does not require
+      // actually moving.
+      if (state.lose()) return true;
       if (moves == 0) return false;
 
-      transitions_t transitions = moved_state.random_transitions();
+      // A search one move deep is about as cheap as a cache lookup.
+      bool hit = false;
+      cache_entry_t *entry =
+        moves > 1 ? lookup(state, TAG_LOSE | moves, hit) : NULL;
+      if (hit) return entry->result;
+
+      state_t<size> moved_states[4];
+      bool moved[4];
+      state.move_all(moved_states, moved);
+
+      bool result = true;
+      for (size_t i = 0; i < 4 && result; ++i) {
+        if (!moved[i]) continue;
+        result = lose_within_after_move(moved_states[i], moves);
+      }
+
+      if (entry) store(entry, state, TAG_LOSE | moves, result);
+      return result;
+    }
+
+    bool lose_within_after_move(const state_t<size> &moved_state,
+      int moves) const {
+      transitions_t transitions;
+      moved_state.random_transitions(transitions);
       for (typename transitions_t::const_iterator it = transitions.begin();
         it != transitions.end(); ++it) {
         if (!lose_within(it->first, moves - 1)) return false;
       }
       return true;
     }
+
+    /**
+     * Find the cache entry for the given search. Returns NULL if there is no
+     * cache. Otherwise, `hit` says whether the entry's result is valid; if
+     * not, the caller should store its result in the entry.
+     */
+    cache_entry_t *lookup(const state_t<size> &state, uint8_t tag,
+      bool &hit) const {
+      hit = false;
+      if (cache.empty()) return NULL;
+
+      nybbles_t nybbles = state.get_nybbles();
+      cache_entry_t &entry =
+        cache[((nybbles + tag) * 0x9E3779B97F4A7C15ULL) >> cache_shift];
+      if (entry.nybbles == nybbles && entry.tag == tag) {
+        ++cache_hits;
+        hit = true;
+      } else {
+        ++cache_misses;
+      }
+      return &entry;
+    }
+
+    void store(cache_entry_t *entry, const state_t<size> &state, uint8_t tag,
+      int result) const {
+      entry->nybbles = state.get_nybbles();
+      entry->tag = tag;
+      entry->result = result;
+    }
   };
 }
 
@@ -1,48 +1,131 @@
-#include <fstream>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
 
 #include "vbyte_reader.hpp"
 #include "vbyte.h"
 
 namespace twenty48 {
 
+const size_t vbyte_reader_t::DEFAULT_BUFFER_SIZE;
+const size_t vbyte_reader_t::MIN_BUFFER_SIZE;
+
 vbyte_reader_t::vbyte_reader_t(
   const char *pathname, size_t byte_offset, uint64_t previous,
-  size_t max_states) :
-  is(pathname, std::ios::in | std::ios::binary),
-  previous(previous), states_read(0), max_states(max_states),
-  buffer_length(0), eof(false) {
-    is.seekg(byte_offset);
+  size_t max_states, size_t buffer_size) :
+  fd(open(pathname, O_RDONLY)), previous(previous), states_left(max_states),
+  max_buffer_size(std::max(buffer_size, MIN_BUFFER_SIZE)),
+  buffer_begin(0), buffer_end(0), eof(fd == -1), next(NULL), end(NULL) {
+    if (fd != -1 && byte_offset > 0 &&
+      lseek(fd, byte_offset, SEEK_SET) == (off_t)-1) {
+      eof = true;
+    }
   }
 
-uint64_t vbyte_reader_t::read() {
-  if (states_read >= max_states) return 0;
+vbyte_reader_t::~vbyte_reader_t() {
+  close();
+}
+
+size_t vbyte_reader_t::read_batch(uint64_t *out, size_t max) {
+  // Hand out anything left over from calls to read first.
+  size_t count = std::min(max, (size_t)(end - next));
+  std::copy(next, next + count, out);
+  next += count;
 
-  if (!eof) {
-    is.read(reinterpret_cast<char *>(buffer + buffer_length),
-      BUFFER_SIZE - buffer_length);
-    buffer_length += is.gcount();
-    if (!is) eof = true;
+  while (count < max) {
+    size_t n = decode(out + count, max - count);
+    if (n == 0) break;
+    count += n;
   }
+  return count;
+}
 
-  if (buffer_length == 0) return 0;
+void vbyte_reader_t::close() {
+  if (fd != -1) ::close(fd);
+  fd = -1;
+  eof = true;
+}
+
+bool vbyte_reader_t::refill() {
+  if (block.empty()) block.resize(BLOCK_SIZE);
+  size_t length = decode(block.data(), BLOCK_SIZE);
+  next = block.data();
+  end = next + length;
+  return length > 0;
+}
 
-  uint64_t value;
-  size_t bytes_in = vbyte_uncompress_sorted64(buffer, &value, previous, 1);
+//
+// Decode up to `max` values, reading more of the file if we need to. Returns
+// zero only at the end.
+//
+size_t vbyte_reader_t::decode(uint64_t *out, size_t max) {
+  max = std::min(max, states_left);
+  if (max == 0) return 0;
 
-  // Shift the bytes we just read out of the buffer.
-  for (size_t i = 0; i + bytes_in < BUFFER_SIZE; ++i) {
-    buffer[i] = buffer[i + bytes_in];
+  // Read more if we are short, unless the buffer is already full.
+  if (!eof && buffer_end - buffer_begin < max * MAX_VALUE_BYTES &&
+    (buffer_begin > 0 || buffer_end < max_buffer_size)) {
+    read_bytes();
   }
 
-  buffer_length -= bytes_in;
-  states_read += 1;
-  previous = value;
+  size_t length = std::min(max, (buffer_end - buffer_begin) / MAX_VALUE_BYTES);
+  if (length > 0) {
+    buffer_begin += vbyte_uncompress_sorted64(buffer.data() + buffer_begin,
+      out, previous, length);
+    previous = out[length - 1];
+  }
+
+  // At the end of the file, the last few values may be short; decode them
+  // one at a time.
+  while (eof && length < max && buffer_begin < buffer_end) {
+    buffer_begin += vbyte_uncompress_sorted64(buffer.data() + buffer_begin,
+      out + length, previous, 1);
+    previous = out[length++];
+  }
 
-  return value;
+  states_left -= length;
+  return length;
 }
 
-void vbyte_reader_t::close() {
-  is.close();
+//
+// Move any bytes we have not decoded to the front of the buffer and fill
+// the rest from the file. Each time the buffer is refilled, it grows, up to
+// the maximum size.
+//
+void vbyte_reader_t::read_bytes() {
+  size_t remaining = buffer_end - buffer_begin;
+  if (buffer.size() < max_buffer_size) {
+    std::vector<uint8_t> larger(std::min(max_buffer_size,
+      std::max(2 * buffer.size(), MIN_BUFFER_SIZE)));
+    std::copy(buffer.begin() + buffer_begin, buffer.begin() + buffer_end,
+      larger.begin());
+    buffer.swap(larger);
+  } else {
+    memmove(buffer.data(), buffer.data() + buffer_begin, remaining);
+  }
+  buffer_begin = 0;
+  buffer_end = remaining;
+
+  while (buffer_end < buffer.size()) {
+    ssize_t bytes_read = ::read(fd, buffer.data() + buffer_end,
+      buffer.size() - buffer_end);
+    if (bytes_read < 0) {
+      if (errno == EINTR) continue;
+      std::ostringstream oss;
+      oss << "vbyte_reader_t: read failed: " << errno << " " <<
+        strerror(errno);
+      throw std::runtime_error(oss.str());
+    }
+    if (bytes_read == 0) {
+      eof = true;
+      break;
+    }
+    buffer_end += bytes_read;
+  }
 }
 
 }
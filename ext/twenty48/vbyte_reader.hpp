@@ -1,30 +1,76 @@
 #ifndef TWENTY48_VBYTE_READER_HPP
 
-#include <fstream>
+#include <cstdint>
+#include <cstddef>
 #include <limits>
+#include <vector>
 
 namespace twenty48 {
 
 /**
- * Read 64-bit integers one at a time using vbyte compression.
+ * Read 64-bit integers using vbyte compression.
+ *
+ * The file is read in large chunks, and many values are decoded at a time,
+ * either straight into the caller's buffer with read_batch, or into an
+ * internal block that read hands out one value at a time. The chunks start
+ * small and grow up to `buffer_size` bytes, so a reader that only needs a
+ * few states from a large file does not read much more than it needs.
  */
 struct vbyte_reader_t {
+  static const size_t DEFAULT_BUFFER_SIZE = 1 << 22;
+
   explicit vbyte_reader_t(const char *pathname,
     size_t byte_offset = 0, uint64_t previous = 0,
-    size_t max_states = std::numeric_limits<size_t>::max());
+    size_t max_states = std::numeric_limits<size_t>::max(),
+    size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+  ~vbyte_reader_t();
+
+  vbyte_reader_t(const vbyte_reader_t &) = delete;
+  vbyte_reader_t &operator=(const vbyte_reader_t &) = delete;
+
+  bool is_open() const { return fd != -1; }
+
+  /**
+   * The next value, or 0 if there are no more.
+   */
+  uint64_t read() {
+    if (next == end && !refill()) return 0;
+    return *next++;
+  }
+
+#ifndef SWIG
+  /**
+   * Read up to `max` values into `out`. Returns the number read, which is
+   * less than `max` only if there are no more.
+   */
+  size_t read_batch(uint64_t *out, size_t max);
+#endif
 
-  uint64_t read();
   void close();
 
 private:
-  static const int BUFFER_SIZE = 2 * sizeof(uint64_t);
-  std::ifstream is;
+  static const size_t MIN_BUFFER_SIZE = 1 << 14;
+  static const size_t BLOCK_SIZE = 1024;
+  // A 64-bit value takes at most 10 bytes; we must have this many bytes for
+  // each value that we decode, unless we are at the end of the file.
+  static const size_t MAX_VALUE_BYTES = 10;
+
+  int fd;
   uint64_t previous;
-  size_t states_read;
-  size_t max_states;
-  uint8_t buffer[BUFFER_SIZE];
-  size_t buffer_length;
+  size_t states_left;
+  size_t max_buffer_size;
+  std::vector<uint8_t> buffer;
+  size_t buffer_begin;
+  size_t buffer_end;
   bool eof;
+  std::vector<uint64_t> block;
+  const uint64_t *next;
+  const uint64_t *end;
+
+  bool refill();
+  size_t decode(uint64_t *out, size_t max);
+  void read_bytes();
 };
 
 }
@@ -22,20 +22,55 @@ module Twenty48
   class LayerBuilder
     include Layers
 
-    def initialize(layer_model, batch_size, verbose: false)
+    #
+    # If `sort_outputs` is set, the native builder collects successors in
+    # buffers that it sorts when it writes them, rather than in btree sets,
+    # which takes less memory per state. Each batch runs in its own process,
+    # so the sorts run on one thread each.
+    #
+    # If `threads` is set, each layer part is instead built in this process by
+    # one native builder, which shares the batches out between that many
+    # threads (or one per core, if zero) and merges their outputs. It writes
+    # one fragment per output part, like a single batch. The reduce step then
+    # merges each part's fragments on that many threads too, by key range;
+    # with zero, it stays on one thread for small parts.
+    #
+    # If `working_memory` is set, it is the number of bytes that the native
+    # builders may use for their successors, shared between the processes or
+    # threads. When a builder runs over its share, it writes the successors it
+    # has so far as extra fragments, which the reduce step merges with the
+    # others, so a large batch does not run out of memory.
+    #
+    # If `pipeline` is set (with `threads`), the successors of each part that
+    # stay in the next layer with the same max value are merged straight from
+    # memory into their output part, which is complete once the input part is
+    # done, rather than being written to a fragment and read back. Only the
+    # other successors, and any spills, go through fragments.
+    #
+    def initialize(layer_model, batch_size, verbose: false,
+      sort_outputs: false, threads: nil, working_memory: nil, pipeline: false)
       @layer_model = layer_model
       @batch_size = batch_size
       @valuer = layer_model.create_native_valuer
       @verbose = verbose
+      @sort_outputs = sort_outputs
+      @threads = threads
+      @working_memory = working_memory
+      @pipeline = pipeline
 
       # Otherwise we cannot concatenate the policy files as binary files.
       raise 'batch size must be multiple of 4' unless batch_size % 4 == 0
+      raise 'pipeline requires threads' if pipeline && !threads
     end
 
     attr_reader :batch_size
     attr_reader :layer_model
     attr_reader :builder
     attr_reader :valuer
+    attr_reader :sort_outputs
+    attr_reader :threads
+    attr_reader :working_memory
+    attr_reader :pipeline
 
     def board_size
       layer_model.board_size
@@ -78,7 +113,8 @@ module Twenty48
             new_part(layer_sum, max_value).fragment_vbyte.new(
               input_sum: layer_sum,
               input_max_value: max_value,
-              batch: 0
+              batch: 0,
+              spill: 0
             ).write_states(states)
           end
         end
@@ -90,7 +126,13 @@ module Twenty48
     # Starting with the output from `build_start_state_layers`, build each
     # subsequent layer.
     #
-    def build(start_layer_sum: 4)
+    # Each batch writes a checkpoint once its fragments are complete. If
+    # `resume` is set, carry on from a build that stopped in the layer with
+    # sum `start_layer_sum`: skip the batches that have valid checkpoints, and
+    # finish any reduce steps that were interrupted.
+    #
+    def build(start_layer_sum: 4, resume: false)
+      @resume = resume
       skips = 0
       layer_sum = start_layer_sum
       while skips < 2
@@ -138,6 +180,7 @@ module Twenty48
         count_states(layer_sum, max_value)
       end.inject(:+)
       reduce_layer_parts(layer_sum, max_values.max + 1)
+      remove_layer_checkpoints(layer_sum)
       num_states
     end
 
@@ -148,7 +191,13 @@ module Twenty48
 
       return if batches.empty?
 
-      build_layer_part_batches(sum, max_value, batches)
+      if threads
+        return if skip_batch?(sum, max_value, 0)
+        run_threaded_native_layer_builder(sum, max_value)
+        write_checkpoint(sum, max_value, 0)
+      else
+        build_layer_part_batches(sum, max_value, batches)
+      end
     end
 
     #
@@ -164,9 +213,9 @@ module Twenty48
     end
 
     #
-    # Find the maximum number of files we can open. This limit can be a problem
-    # when merging large parts. Note that we assume that this does not change
-    # over the lifetime of the process.
+    # Find the maximum number of files we can open. Merging a part with more
+    # fragments than this takes extra passes. Note that we assume that this
+    # does not change over the lifetime of the process.
     #
     def max_files
       grace = 16
@@ -176,48 +225,133 @@ module Twenty48
 
     private
 
+    #
+    # The info is written last, when a part is complete, so we rename it into
+    # place; a resumed build takes a part with an info file to be done.
+    #
     def write_layer_part_info(layer_sum, max_value, num_states:, index: [])
       pathname = new_part(layer_sum, max_value).info_json.to_s
-      File.open(pathname, 'w') do |info_file|
+      File.open("#{pathname}.tmp", 'w') do |info_file|
         JSON.dump({
           num_states: num_states,
           batch_size: batch_size,
           index: index.to_a
         }, info_file)
       end
+      FileUtils.mv "#{pathname}.tmp", pathname
     end
 
-    def layer_fragment_pathname(sum, max_value, step, jump, batch)
+    def layer_fragment_pathname(sum, max_value, step, jump, batch,
+      spill: 0)
       new_part(sum + 2 * step, max_value + jump).fragment_vbyte.new(
         input_sum: sum,
         input_max_value: max_value,
-        batch: batch
+        batch: batch,
+        spill: spill
       ).mkdir!.to_s
     end
 
+    OUTPUT_STEPS_AND_JUMPS = [[1, 0], [1, 1], [2, 0], [2, 1]].freeze
+
     def build_layer_part_batches(sum, max_value, batches)
       GC.start
       Parallel.each(batches) do |index, offset, previous, batch_size|
+        next if skip_batch?(sum, max_value, index)
         run_native_layer_builder(
           sum, max_value, index, offset, previous, batch_size
         )
+        rename_spills(sum, max_value, index)
+        write_checkpoint(sum, max_value, index)
         STDOUT.write('.') if @verbose
         GC.start
       end
       puts if @verbose # put a line break after the dots from the parts
     end
 
+    #
+    # How many bytes each native builder may use for its successors.
+    #
+    def native_layer_builder_max_bytes
+      return 0 unless working_memory
+      return working_memory if threads
+      [working_memory / Parallel.processor_count, 1].max
+    end
+
     def create_native_layer_builder(sum, max_value, index, valuer)
       NativeLayerBuilder.create(
         board_size, max_value,
-        layer_fragment_pathname(sum, max_value, 1, 0, index),
-        layer_fragment_pathname(sum, max_value, 1, 1, index),
-        layer_fragment_pathname(sum, max_value, 2, 0, index),
-        layer_fragment_pathname(sum, max_value, 2, 1, index),
-        valuer
+        *OUTPUT_STEPS_AND_JUMPS.map do |step, jump|
+          layer_fragment_pathname(sum, max_value, step, jump, index)
+        end,
+        valuer, sort_outputs, 1, native_layer_builder_max_bytes
       )
     end
 
+    #
+    # The native builder writes any runs that it spills next to its output
+    # fragments; give them fragment names, so the reduce step finds them.
+    #
+    def rename_spills(sum, max_value, index)
+      OUTPUT_STEPS_AND_JUMPS.each do |step, jump|
+        pathname = layer_fragment_pathname(sum, max_value, step, jump, index)
+        spill_pathnames = Dir.glob("#{pathname}.spill-*").sort
+        spill_pathnames.each.with_index(1) do |spill_pathname, spill|
+          FileUtils.mv spill_pathname, layer_fragment_pathname(
+            sum, max_value, step, jump, index, spill: spill
+          )
+        end
+      end
+    end
+
+    def batch_fragment_pathnames(sum, max_value, batch)
+      OUTPUT_STEPS_AND_JUMPS.flat_map do |step, jump|
+        new_part(sum + 2 * step, max_value + jump).fragment_vbyte.where(
+          input_sum: sum, input_max_value: max_value, batch: batch
+        ).map(&:to_s)
+      end
+    end
+
+    def write_checkpoint(sum, max_value, batch)
+      checkpoint = new_part(sum, max_value).checkpoint_txt.new(batch: batch)
+      Twenty48.write_batch_checkpoint(checkpoint.to_s,
+        StringVector.new(batch_fragment_pathnames(sum, max_value, batch)))
+    end
+
+    #
+    # When resuming, skip a batch if its checkpoint is valid. Otherwise, its
+    # fragments may be incomplete, so remove them, and any spills that were
+    # not renamed, before it runs again.
+    #
+    def skip_batch?(sum, max_value, batch)
+      return false unless @resume
+      checkpoint = new_part(sum, max_value).checkpoint_txt.new(batch: batch)
+      return true if Twenty48.check_batch_checkpoint(checkpoint.to_s)
+
+      FileUtils.rm_f batch_fragment_pathnames(sum, max_value, batch)
+      OUTPUT_STEPS_AND_JUMPS.each do |step, jump|
+        pathname = layer_fragment_pathname(sum, max_value, step, jump, batch)
+        FileUtils.rm_f Dir.glob("#{pathname}.spill-*")
+      end
+      false
+    end
+
+    def remove_layer_checkpoints(layer_sum)
+      layer_model.part.where(sum: layer_sum).each do |part|
+        FileUtils.rm part.checkpoint_txt.to_a.map(&:to_s)
+      end
+    end
+
+    #
+    # When resuming, an output part may already have been reduced, or it may
+    # have been partly written, in which case we remove it to start it again.
+    #
+    def resume_reduced?(part)
+      return false unless @resume
+      return true if part.info_json.exist?
+      FileUtils.rm_f part.states_vbyte.to_s
+      false
+    end
+
     def run_native_layer_builder(sum, max_value, index, offset, previous,
       batch_size)
       input_pathname = new_part(sum, max_value).states_vbyte.to_s
@@ -227,6 +361,40 @@ module Twenty48
       builder.expand_all(vbyte_reader)
     end
 
+    def run_threaded_native_layer_builder(sum, max_value)
+      input_info = read_layer_part_info(sum, max_value)
+      input_pathname = new_part(sum, max_value).states_vbyte.to_s
+      builder = create_native_layer_builder(sum, max_value, 0, valuer)
+      output_part = new_part(sum + 2, max_value)
+      if pipeline && !resume_reduced?(output_part)
+        expand_and_merge_layer_part(builder, input_info, input_pathname,
+          output_part)
+      else
+        builder.expand_all_threaded(input_pathname, input_info['index'],
+          input_info['batch_size'], threads)
+      end
+      rename_spills(sum, max_value, 0)
+      log_filter(sum, max_value, builder)
+    end
+
+    def expand_and_merge_layer_part(builder, input_info, input_pathname,
+      output_part)
+      fragment_pathnames = output_part.fragment_vbyte.to_a.map(&:to_s)
+      output_pathname = output_part.states_vbyte.to_s
+      raise "already done: #{output_pathname}" if File.exist?(output_pathname)
+
+      vbyte_index = VByteIndex.new
+      num_states = builder.expand_all_threaded_and_merge(
+        input_pathname, input_info['index'], input_info['batch_size'], threads,
+        StringVector.new(fragment_pathnames), output_pathname, batch_size,
+        vbyte_index
+      )
+      write_layer_part_info(output_part.sum, output_part.max_value,
+        num_states: num_states, index: vbyte_index)
+
+      FileUtils.rm fragment_pathnames
+    end
+
     def reduce_layer_parts(sum, max_value)
       # The max_values are processed in ascending order, so once we've built
       # successors from a part, all parts with layer_sum = this layer_sum + 2
@@ -257,11 +425,14 @@ module Twenty48
     end
 
     def reduce_output_part_fragments(output_name, input_names)
-      # We may run out of file descriptors when we try to merge a lot of files.
-      raise "too many batches: #{input_names.size}" if
-        input_names.size > max_files
       input_pathnames = input_names.map(&:to_s)
       return if input_pathnames.empty?
+
+      # Any fragments left in a part that was already reduced are merged.
+      if resume_reduced?(output_name)
+        FileUtils.rm input_pathnames
+        return
+      end
       log_reduce_step(output_name.sum, output_name.max_value, input_pathnames)
 
       output_pathname = output_name.states_vbyte.to_s
@@ -277,7 +448,7 @@ module Twenty48
     def merge_files(input_files, output_file)
       vbyte_index = VByteIndex.new
       num_states = Twenty48.merge_states(StringVector.new(input_files),
-        output_file, batch_size, vbyte_index)
+        output_file, batch_size, vbyte_index, threads || 1, max_files)
       [num_states, vbyte_index]
     end
 
@@ -286,6 +457,17 @@ module Twenty48
         layer_sum, max_value, count_states(layer_sum, max_value), num_batches)
     end
 
+    #
+    # How often the builder's filters of recent successors caught a repeat.
+    #
+    def log_filter(sum, max_value, builder)
+      num_lookups = builder.get_num_filter_lookups
+      return if num_lookups == 0
+      log format('filter %d-%x: %.1f%% of %d successors were repeats',
+        sum, max_value, 100.0 * builder.get_num_filter_hits / num_lookups,
+        num_lookups)
+    end
+
     def log_reduce_step(sum, max_value, input_pathnames)
       sizes = input_pathnames.map { |pathname| file_size(pathname) }
       total_size = sizes.inject(&:+)
@@ -260,12 +260,13 @@ module Twenty48
           parent.max_exponent
         end
 
-        def create_native_valuer(discount: 1.0)
+        def create_native_valuer(discount: 1.0, cache_size: 0)
           NativeValuer.create(
             board_size: board_size,
             max_exponent: max_exponent,
             max_depth: max_depth,
-            discount: discount # discount does not matter for build step
+            discount: discount, # discount does not matter for build step
+            cache_size: cache_size
           )
         end
 
@@ -168,14 +168,16 @@ module Twenty48
   # Common methods for the native Valuer class.
   #
   module NativeValuer
-    def self.create(board_size:, max_exponent:, max_depth:, discount:)
+    def self.create(
+      board_size:, max_exponent:, max_depth:, discount:, cache_size: 0
+    )
       klass = case board_size
               when 2 then Valuer2
               when 3 then Valuer3
               when 4 then Valuer4
               else raise "bad valuer board_size: #{board_size}"
               end
-      klass.new(max_exponent, max_depth, discount)
+      klass.new(max_exponent, max_depth, discount, cache_size)
     end
   end
 
@@ -71,6 +71,12 @@ module Twenty48
             key :input_sum, type: Integer, format: '%04d'
             key :input_max_value, type: Integer, format: '%x'
             key :batch, type: Integer, format: '%04d'
+            key :spill, type: Integer, format: '%04d'
+          end
+
+          # Written when a batch's fragments are complete, for restarts.
+          file :checkpoint, :txt do
+            key :batch, type: Integer, format: '%04d'
           end
 
           file :info, :json
@@ -209,4 +209,133 @@ class NativeLayerBuilderTest < Twenty48NativeTest
       assert_close 0.03831963657896261, state_values[1][1]
     end
   end
+
+  def build_2x2_to_32_states(**options)
+    with_tmp_data do |data|
+      model = data.game.new(board_size: 2, max_exponent: 5)
+        .layer_model.new(max_depth: 0).mkdir!
+
+      layer_builder = LayerBuilder.new(model, 4, **options)
+      layer_builder.build_start_state_layers
+      if block_given?
+        yield layer_builder, model
+      else
+        layer_builder.build
+      end
+
+      model.part.all.map do |part|
+        states = part.states_vbyte.read_states
+        [part.sum, part.max_value, states.map(&:get_nybbles)]
+      end
+    end
+  end
+
+  def test_build_2x2_to_32_sort_outputs
+    states = build_2x2_to_32_states
+    assert_equal(57, states.map { |_, _, part_states| part_states.size }.sum)
+    assert_equal states, build_2x2_to_32_states(sort_outputs: true)
+  end
+
+  def test_build_2x2_to_32_threaded
+    states = build_2x2_to_32_states
+    assert_equal states, build_2x2_to_32_states(threads: 1)
+    assert_equal states, build_2x2_to_32_states(threads: 3)
+  end
+
+  def test_build_2x2_to_32_spill
+    states = build_2x2_to_32_states
+    assert_equal states, build_2x2_to_32_states(working_memory: 1)
+    assert_equal states, build_2x2_to_32_states(
+      sort_outputs: true, working_memory: 1
+    )
+    assert_equal states, build_2x2_to_32_states(threads: 2, working_memory: 1)
+  end
+
+  def test_build_2x2_to_32_pipeline
+    states = build_2x2_to_32_states
+    assert_equal states, build_2x2_to_32_states(threads: 2, pipeline: true)
+    assert_equal states, build_2x2_to_32_states(
+      threads: 2, pipeline: true, working_memory: 1
+    )
+  end
+
+  def test_build_2x2_to_32_resume
+    states = build_2x2_to_32_states
+    [{}, { threads: 2 }, { threads: 2, pipeline: true }].each do |options|
+      # Stop after the first part, as if the build had crashed.
+      resumed_states = build_2x2_to_32_states(**options) do |builder, model|
+        builder.build_layer_part(4, 1)
+        assert model.part.find_by(sum: 4, max_value: 1).checkpoint_txt.any?
+        builder.build(resume: true)
+      end
+      assert_equal states, resumed_states
+
+      # If a fragment does not match the checkpoint, the batch runs again.
+      resumed_states = build_2x2_to_32_states(**options) do |builder, model|
+        builder.build_layer_part(4, 1)
+        fragment = model.part.flat_map { |part| part.fragment_vbyte.to_a }
+          .find { |f| f.input_sum == 4 && File.size(f.to_s) > 0 }
+        File.truncate(fragment.to_s, 1)
+        builder.build(resume: true)
+      end
+      assert_equal states, resumed_states
+
+      # So does a batch whose checkpoint is malformed.
+      resumed_states = build_2x2_to_32_states(**options) do |builder, model|
+        builder.build_layer_part(4, 1)
+        checkpoint = model.part.find_by(sum: 4, max_value: 1)
+          .checkpoint_txt.first.to_s
+        File.write(checkpoint, "x#{File.read(checkpoint)}")
+        builder.build(resume: true)
+      end
+      assert_equal states, resumed_states
+    end
+  end
+
+  def test_merge_states_threaded
+    Dir.mktmpdir do |tmp|
+      input_pathnames = write_merge_inputs(tmp, 5)
+      merges = [1, 2, 7].map do |threads|
+        merge_input_files(input_pathnames, tmp, "output-#{threads}",
+          threads: threads)
+      end
+      assert merges[0][0] > 64
+      assert_equal merges[0], merges[1]
+      assert_equal merges[0], merges[2]
+      assert_equal 5 + 3, Dir.glob(File.join(tmp, '*')).size
+    end
+  end
+
+  def test_merge_states_max_files
+    Dir.mktmpdir do |tmp|
+      input_pathnames = write_merge_inputs(tmp, 12)
+      merge = merge_input_files(input_pathnames, tmp, 'output')
+      [3, 4, 5].each do |max_files|
+        assert_equal merge, merge_input_files(input_pathnames, tmp,
+          "output-#{max_files}", max_files: max_files)
+      end
+      assert_equal 12 + 4, Dir.glob(File.join(tmp, '*')).size
+    end
+  end
+
+  def write_merge_inputs(tmp, num_inputs)
+    random = Random.new(42)
+    Array.new(num_inputs) do |i|
+      pathname = File.join(tmp, "input-#{i}.vbyte")
+      values = Array.new(2000) { random.rand(1..10_000) }.sort.uniq
+      vbyte_writer = VByteWriter.new(pathname)
+      values.each { |value| vbyte_writer.write(value) }
+      vbyte_writer.close
+      pathname
+    end
+  end
+
+  def merge_input_files(input_pathnames, tmp, name, threads: 1, max_files: 0)
+    output_pathname = File.join(tmp, "#{name}.vbyte")
+    vbyte_index = VByteIndex.new
+    num_states = Twenty48.merge_states(StringVector.new(input_pathnames),
+      output_pathname, 64, vbyte_index, threads, max_files)
+    index = vbyte_index.map { |entry| [entry.byte_offset, entry.previous] }
+    [num_states, File.binread(output_pathname), index]
+  end
 end
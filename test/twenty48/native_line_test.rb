@@ -25,10 +25,34 @@ class NativeLineTest < Twenty48NativeTest
     make_line(line_array).has_adjacent_pair(value)
   end
 
+  def test_has_adjacent_pair
+    assert adjacent_pair?([1, 1], 1)
+    assert adjacent_pair?([2, 0, 2], 2)
+    refute adjacent_pair?([2, 1, 2], 2)
+    assert adjacent_pair?([0, 3, 3, 0], 3)
+    assert adjacent_pair?([1, 2, 0, 2], 2)
+
+    # The pair need not start at the first tile with the value.
+    assert adjacent_pair?([10, 9, 10, 10], 10)
+    refute adjacent_pair?([10, 9, 10, 9], 10)
+  end
+
   def test_to_i
     assert_equal 0x01, Line2.new([0, 1]).to_i
     assert_equal 0x10, Line2.new([1, 0]).to_i
     assert_equal 0x02, Line2.new([0, 2]).to_i
     assert_equal 0x20, Line2.new([2, 0]).to_i
   end
+
+  def test_reverse
+    assert_equal [1, 0], Line2.new([0, 1]).reverse.to_a
+    assert_equal [3, 2, 1], Line3.new([1, 2, 3]).reverse.to_a
+    assert_equal [0, 2, 0, 1], Line4.new([1, 0, 2, 0]).reverse.to_a
+  end
+
+  def test_lookup_reverse_move
+    assert_equal 0x0002, Line4.lookup_reverse_move(0x1100)
+    assert_equal 0x0012, Line4.lookup_reverse_move(0x1011)
+    assert_equal 0x0022, Line4.lookup_reverse_move(0x1120)
+  end
 end
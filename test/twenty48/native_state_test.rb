@@ -15,6 +15,60 @@ class NativeStateTest < Twenty48NativeTest
     assert_equal 2 + 4 + 8, make_state([0, 1, 2, 3]).sum
   end
 
+  def test_state_sum_4x4
+    assert_equal 0, make_state([0] * 16).sum
+    assert_equal 2 + 4 + 2**15 + 8,
+      make_state([1, 0, 0, 2, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 3]).sum
+  end
+
+  def test_max_value
+    assert_equal 0, make_state([0, 0, 0, 0]).max_value
+    assert_equal 3, make_state([0, 1, 0, 3]).max_value
+    assert_equal 9, make_state([1, 2, 3, 4, 5, 6, 7, 8, 9]).max_value
+    assert_equal 11,
+      make_state([1, 0, 0, 2, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 3]).max_value
+  end
+
+  def test_adjacent_pairs
+    assert_equal 0, make_state([0, 0, 0, 0]).adjacent_pairs
+    assert_equal 1 << 1, make_state([1, 1, 2, 3]).adjacent_pairs
+    assert_equal 0b110,
+      make_state([1, 0, 1, 2, 3, 0, 2, 0, 4]).adjacent_pairs
+    assert_equal 0, make_state([1, 2, 1, 2, 1, 2, 1, 2, 1]).adjacent_pairs
+  end
+
+  def test_lose
+    assert make_state([0, 0, 0, 0]).lose
+    refute make_state([0, 0, 0, 1]).lose
+    refute make_state([1, 1, 2, 3]).lose
+    refute make_state([1, 2, 1, 3]).lose
+    assert make_state([1, 2, 2, 1]).lose
+    assert make_state([1, 2, 3, 4, 5, 6, 7, 8, 9]).lose
+    refute make_state([1, 2, 3, 4, 5, 3, 7, 8, 9]).lose
+    refute make_state([1, 2, 3, 4, 0, 6, 7, 8, 9]).lose
+  end
+
+  def test_can_move
+    state = make_state([0, 1, 0, 2])
+    refute state.can_move(DIRECTION_UP)
+    assert state.can_move(DIRECTION_LEFT)
+    refute state.can_move(DIRECTION_RIGHT)
+    refute state.can_move(DIRECTION_DOWN)
+
+    state = make_state([1, 1, 0, 2])
+    assert state.can_move(DIRECTION_LEFT)
+    assert state.can_move(DIRECTION_RIGHT)
+    refute state.can_move(DIRECTION_UP)
+    assert state.can_move(DIRECTION_DOWN)
+  end
+
+  def test_legal_moves
+    assert_equal 0, make_state([1, 2, 2, 1]).legal_moves
+    assert_equal 0xf, make_state([1, 1, 1, 1]).legal_moves
+    assert_equal 1 << DIRECTION_LEFT | 1 << DIRECTION_DOWN,
+      make_state([0, 0, 1, 0, 0, 2, 0, 0, 0]).legal_moves
+  end
+
   # TODO: migrate some tests
   #   state_t<2, 3> state_2_3;
   # std::cout << "is_lose: " << state_2_3.is_lose() << std::endl;
@@ -1,13 +1,13 @@
 # frozen_string_literal: true
 
 require_relative 'helper'
-require_relative 'common/generic_resolver_shallow_tests'
-require_relative 'common/resolver_lose_shallow_tests'
+require_relative 'common/generic_resolver_tests'
+require_relative 'common/resolver_lose_tests'
 
 class NativeResolverValueTest < Twenty48NativeTest
   include Twenty48
-  include CommonGenericResolverShallowTests
-  include CommonResolverLoseShallowTests
+  include CommonGenericResolverTests
+  include CommonResolverLoseTests
 
   DISCOUNT = 0.95
 
@@ -38,38 +38,101 @@ class NativeResolverValueTest < Twenty48NativeTest
     valuer.value(make_state(state_array)) == 0
   end
 
-  # Valuer temporarily (?) limited to depth 1. These tests may be useful if
-  # we enable larger depths.
-  #
-  # def test_value_3x3_to_8_resolve_2
-  #   valuer = make_resolver(3, 3, 2)
-  #   assert_nan valuer.value(make_state([
-  #     0, 0, 2,
-  #     0, 0, 0,
-  #     2, 0, 0
-  #   ]))
-  # end
-  #
-  # def test_value_2x2_to_16_resolve_4
-  #   valuer = make_resolver(2, 4, 4)
-  #
-  #   # See notes in test_moves_to_definite_win_2x2_to_16_resolve_3 about why
-  #   # this state is an interesting one. The optimal action is to go left,
-  #   # which results in a win in 4 moves with probability 0.9.
-  #   assert_close 0.9 * DISCOUNT**4, valuer.value(make_state([
-  #     0, 1,
-  #     2, 3
-  #   ]))
-  # end
-  #
-  # def test_value_3x3_to_16_resolve_2
-  #   valuer = make_resolver(3, 4, 2)
-  #
-  #   # We can neither win nor lose in two moves from this state.
-  #   assert_nan valuer.value(make_state([
-  #     0, 0, 0,
-  #     0, 0, 2,
-  #     2, 1, 1
-  #   ]))
-  # end
+  def test_value_cached
+    valuer = Twenty48::NativeValuer.create(
+      board_size: 2,
+      max_exponent: 5,
+      max_depth: 1,
+      discount: DISCOUNT,
+      cache_size: 16
+    )
+    assert_equal 16, valuer.get_cache_size
+
+    lose = make_state([1, 2, 2, 1])
+    assert_equal 0, valuer.value(lose)
+    assert_equal 0, valuer.value(lose)
+    assert_nan valuer.value(make_state([1, 1, 2, 3]))
+    assert_equal 1, valuer.get_cache_hits
+    assert_equal 2, valuer.get_cache_misses
+
+    valuer.clear_cache
+    assert_equal 0, valuer.value(lose)
+    assert_equal 0, valuer.get_cache_hits
+    assert_equal 1, valuer.get_cache_misses
+  end
+
+  def test_value_3x3_to_8_resolve_2
+    valuer = make_resolver(3, 3, 2)
+    assert_nan valuer.value(make_state([
+      0, 0, 2,
+      0, 0, 0,
+      2, 0, 0
+    ]))
+  end
+
+  def test_value_3x3_to_16_resolve_2
+    valuer = make_resolver(3, 4, 2)
+
+    # We can neither win nor lose in two moves from this state.
+    assert_nan valuer.value(make_state([
+      0, 0, 0,
+      0, 0, 2,
+      2, 1, 1
+    ]))
+  end
+
+  def test_value_3x3_to_32_resolve_2_lose
+    valuer = make_resolver(3, 5, 2)
+
+    # Only left and up move, and each leaves the board full with no merges,
+    # whichever tile is placed. Right and down do not move at all.
+    [
+      [0, 2, 4, 3, 1, 3, 4, 3, 1],
+      [0, 1, 4, 3, 2, 3, 4, 3, 1],
+      [0, 2, 3, 3, 1, 4, 4, 3, 1]
+    ].each do |state_array|
+      assert_equal 0, valuer.value(make_state(state_array))
+    end
+  end
+
+  def test_value_2x2_to_16_resolve_4
+    valuer = make_resolver(2, 4, 4)
+
+    # See notes in test_moves_to_definite_win_2x2_to_16_resolve_3 about why
+    # this state is an interesting one. The optimal action is to go left,
+    # which results in a win in 4 moves with probability 0.9, so its expected
+    # value is 0.9 * DISCOUNT**4. The valuer only resolves definite wins and
+    # losses, however, and this state is neither within 4 moves.
+    assert_nan valuer.value(make_state([
+      0, 1,
+      2, 3
+    ]))
+  end
+
+  def test_value_4x4_to_2048_resolve_1
+    valuer = make_resolver(4, 11, 1)
+
+    # The board is full, but the right column is 1024, 512, 1024, 1024, so
+    # moving up or down merges the last two and wins.
+    assert_close DISCOUNT, valuer.value(make_state([
+      1, 8, 3, 10,
+      2, 3, 6, 9,
+      6, 7, 3, 10,
+      3, 4, 8, 10
+    ]))
+  end
+
+  def test_value_deep_cached
+    valuer = Twenty48::NativeValuer.create(
+      board_size: 2,
+      max_exponent: 4,
+      max_depth: 3,
+      discount: DISCOUNT,
+      cache_size: 1024
+    )
+    state = make_state([1, 1, 2, 3])
+    assert_close DISCOUNT**3, valuer.value(state)
+    assert_close DISCOUNT**3, valuer.value(state)
+    assert valuer.get_cache_hits.positive?
+  end
 end